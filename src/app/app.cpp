@@ -22,10 +22,13 @@
 
 #include "app.h"
 
+#include <algorithm>
+
 #include <QApplication>
 #include <QQmlApplicationEngine>
 #include <QQuickWindow>
 #include <QStyleHints>
+#include <QThread>
 #ifndef Q_OS_WASM
 #include <QThreadPool>
 #endif
@@ -128,25 +131,48 @@ int App::run(int argc, char** argv)
 
     commandLineParser.processBuiltinArgs(*app);
 
+    m_runMode = runMode;
+    m_startupTimelineEnabled = commandLineParser.options().app.startupTimelinePrinted.value_or(false);
+    m_startupTimer.start();
+
     // ====================================================
     // Setup modules: Resources, Exports, Imports, UiTypes
     // ====================================================
-    globalModule.registerResources();
-    globalModule.registerExports();
-    globalModule.registerUiTypes();
+    measure(&globalModule, "registerResources", []() { globalModule.registerResources(); });
+    measure(&globalModule, "registerExports", []() { globalModule.registerExports(); });
+    measure(&globalModule, "registerUiTypes", []() { globalModule.registerUiTypes(); });
 
     for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->registerResources();
+        measure(m, "registerResources", [m]() { m->registerResources(); });
     }
 
     for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->registerExports();
+        measure(m, "registerExports", [m]() { m->registerExports(); });
     }
 
-    globalModule.resolveImports();
+    measure(&globalModule, "resolveImports", []() { globalModule.resolveImports(); });
     for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->registerUiTypes();
-        m->resolveImports();
+        measure(m, "registerUiTypes", [m]() { m->registerUiTypes(); });
+        measure(m, "resolveImports", [m]() { m->resolveImports(); });
+    }
+
+    // ====================================================
+    // Setup modules: defer the init of the modules that allow it
+    // ====================================================
+    //! NOTE In the console mode (converter, diagnostic, autobot) only a part of the modules is used,
+    //! so these are initialized on the first resolve of one of their exports
+    if (runMode == framework::IApplication::RunMode::ConsoleApp) {
+        for (mu::modularity::IModuleSetup* m : m_modules) {
+            if (m->isInitOnDemandAllowed()) {
+                m_deferredModules[m->moduleName()] = m;
+            }
+        }
+
+        if (!m_deferredModules.empty()) {
+            mu::modularity::ioc()->setResolveHook([this](const std::string& moduleName) {
+                initModuleOnDemand(moduleName);
+            });
+        }
     }
 
     // ====================================================
@@ -158,9 +184,10 @@ int App::run(int argc, char** argv)
     // ====================================================
     // Setup modules: onPreInit
     // ====================================================
-    globalModule.onPreInit(runMode);
+    m_stage = ModuleStage::PreInited;
+    setupModule(&globalModule, m_stage);
     for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->onPreInit(runMode);
+        setupModule(m, m_stage);
     }
 
 #ifdef MUE_BUILD_APPSHELL_MODULE
@@ -188,26 +215,29 @@ int App::run(int argc, char** argv)
     // ====================================================
     // Setup modules: onInit
     // ====================================================
-    globalModule.onInit(runMode);
+    m_stage = ModuleStage::Inited;
+    setupModule(&globalModule, m_stage);
     for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->onInit(runMode);
+        setupModule(m, m_stage);
     }
 
     // ====================================================
     // Setup modules: onAllInited
     // ====================================================
-    globalModule.onAllInited(runMode);
+    m_stage = ModuleStage::AllInited;
+    setupModule(&globalModule, m_stage);
     for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->onAllInited(runMode);
+        setupModule(m, m_stage);
     }
 
     // ====================================================
     // Setup modules: onStartApp (on next event loop)
     // ====================================================
     QMetaObject::invokeMethod(qApp, [this]() {
-        globalModule.onStartApp();
+        m_stage = ModuleStage::Started;
+        setupModule(&globalModule, m_stage);
         for (mu::modularity::IModuleSetup* m : m_modules) {
-            m->onStartApp();
+            setupModule(m, m_stage);
         }
     }, Qt::QueuedConnection);
 
@@ -339,6 +369,13 @@ int App::run(int argc, char** argv)
 
     PROFILER_PRINT;
 
+    //! NOTE No more on demand init during the deinit
+    mu::modularity::ioc()->setResolveHook(nullptr);
+
+    if (m_startupTimelineEnabled) {
+        printStartupTimeline();
+    }
+
     // Wait Thread Poll
 #ifndef Q_OS_WASM
     QThreadPool* globalThreadPool = QThreadPool::globalInstance();
@@ -358,13 +395,17 @@ int App::run(int argc, char** argv)
     globalModule.invokeQueuedCalls();
 
     for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->onDeinit();
+        if (!isModuleDeferred(m)) {
+            m->onDeinit();
+        }
     }
 
     globalModule.onDeinit();
 
     for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->onDestroy();
+        if (!isModuleDeferred(m)) {
+            m->onDestroy();
+        }
     }
 
     globalModule.onDestroy();
@@ -372,6 +413,8 @@ int App::run(int argc, char** argv)
     // Delete modules
     qDeleteAll(m_modules);
     m_modules.clear();
+    m_moduleStages.clear();
+    m_deferredModules.clear();
     mu::modularity::ioc()->reset();
 
     delete app;
@@ -379,6 +422,110 @@ int App::run(int argc, char** argv)
     return retCode;
 }
 
+void App::setupModule(modularity::IModuleSetup* module, ModuleStage stage)
+{
+    if (isModuleDeferred(module)) {
+        return;
+    }
+
+    //! NOTE The stage is set before the call, because an on demand init can get here again through the IoC
+    ModuleStage& current = m_moduleStages[module];
+
+    if (current < ModuleStage::PreInited && stage >= ModuleStage::PreInited) {
+        current = ModuleStage::PreInited;
+        measure(module, "onPreInit", [this, module]() { module->onPreInit(m_runMode); });
+    }
+
+    if (current < ModuleStage::Inited && stage >= ModuleStage::Inited) {
+        current = ModuleStage::Inited;
+        measure(module, "onInit", [this, module]() { module->onInit(m_runMode); });
+    }
+
+    if (current < ModuleStage::AllInited && stage >= ModuleStage::AllInited) {
+        current = ModuleStage::AllInited;
+        measure(module, "onAllInited", [this, module]() { module->onAllInited(m_runMode); });
+    }
+
+    if (current < ModuleStage::Started && stage >= ModuleStage::Started) {
+        current = ModuleStage::Started;
+        measure(module, "onStartApp", [module]() { module->onStartApp(); });
+    }
+}
+
+void App::initModuleOnDemand(const std::string& moduleName)
+{
+    //! NOTE The modules are inited on the main thread only,
+    //! the other threads are started by the modules that are inited already
+    if (QThread::currentThread() != qApp->thread()) {
+        return;
+    }
+
+    auto it = m_deferredModules.find(moduleName);
+    if (it == m_deferredModules.end()) {
+        return;
+    }
+
+    modularity::IModuleSetup* module = it->second;
+    m_deferredModules.erase(it);
+
+    //! NOTE Bring the module to the stage that the other modules have already passed
+    setupModule(module, m_stage);
+}
+
+bool App::isModuleDeferred(const modularity::IModuleSetup* module) const
+{
+    auto it = m_deferredModules.find(module->moduleName());
+    return it != m_deferredModules.end() && it->second == module;
+}
+
+void App::measure(const modularity::IModuleSetup* module, const std::string& step, const std::function<void()>& func)
+{
+    if (!m_startupTimelineEnabled) {
+        func();
+        return;
+    }
+
+    size_t index = m_startupTimeline.size();
+    m_startupTimeline.push_back({ module->moduleName(), step, m_timelineDepth, m_startupTimer.elapsed(), 0 });
+
+    ++m_timelineDepth;
+    func();
+    --m_timelineDepth;
+
+    TimelineStep& s = m_startupTimeline[index];
+    s.durationMs = m_startupTimer.elapsed() - s.startMs;
+}
+
+void App::printStartupTimeline() const
+{
+    std::map<std::string, qint64> totals;
+    for (const TimelineStep& s : m_startupTimeline) {
+        //! NOTE Nested steps are already counted by their parent
+        if (s.depth == 0) {
+            totals[s.module] += s.durationMs;
+        }
+    }
+
+    LOGI() << "Startup timeline (start, duration, module::step):";
+    for (const TimelineStep& s : m_startupTimeline) {
+        LOGI() << std::string(s.depth * 2, ' ') << s.startMs << " ms, " << s.durationMs << " ms, " << s.module << "::" << s.step;
+    }
+
+    std::vector<std::pair<std::string, qint64> > sorted(totals.begin(), totals.end());
+    std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+        return a.second > b.second;
+    });
+
+    LOGI() << "Startup time by module:";
+    for (const auto& pair : sorted) {
+        LOGI() << pair.second << " ms, " << pair.first;
+    }
+
+    for (const auto& pair : m_deferredModules) {
+        LOGI() << "not initialized: " << pair.first;
+    }
+}
+
 void App::applyCommandLineOptions(const CommandLineParser::Options& options, framework::IApplication::RunMode runMode)
 {
     uiConfiguration()->setPhysicalDotsPerInch(options.ui.physicalDotsPerInch);
@@ -446,6 +593,10 @@ void App::applyCommandLineOptions(const CommandLineParser::Options& options, fra
     if (options.app.loggerLevel) {
         globalModule.setLoggerLevel(options.app.loggerLevel.value());
     }
+
+    if (options.app.traceFilePath) {
+        globalModule.setTraceFilePath(options.app.traceFilePath.value());
+    }
 }
 
 int App::processConverter(const CommandLineParser::ConverterTask& task)
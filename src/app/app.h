@@ -24,6 +24,12 @@
 #define MU_APP_APP_H
 
 #include <QList>
+#include <QElapsedTimer>
+
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
 
 #include "modularity/imodulesetup.h"
 #include "modularity/ioc.h"
@@ -75,6 +81,29 @@ public:
     int run(int argc, char** argv);
 
 private:
+    enum class ModuleStage {
+        Registered = 0,
+        PreInited,
+        Inited,
+        AllInited,
+        Started
+    };
+
+    struct TimelineStep {
+        std::string module;
+        std::string step;
+        int depth = 0;
+        qint64 startMs = 0;
+        qint64 durationMs = 0;
+    };
+
+    void setupModule(modularity::IModuleSetup* module, ModuleStage stage);
+    void initModuleOnDemand(const std::string& moduleName);
+    bool isModuleDeferred(const modularity::IModuleSetup* module) const;
+
+    void measure(const modularity::IModuleSetup* module, const std::string& step, const std::function<void()>& func);
+    void printStartupTimeline() const;
+
     void applyCommandLineOptions(const CommandLineParser::Options& options, framework::IApplication::RunMode runMode);
     int processConverter(const CommandLineParser::ConverterTask& task);
     int processDiagnostic(const CommandLineParser::Diagnostic& task);
@@ -82,6 +111,16 @@ private:
     void processAutobot(const CommandLineParser::Autobot& task);
 
     QList<modularity::IModuleSetup*> m_modules;
+
+    framework::IApplication::RunMode m_runMode = framework::IApplication::RunMode::GuiApp;
+    ModuleStage m_stage = ModuleStage::Registered;
+    std::map<const modularity::IModuleSetup*, ModuleStage> m_moduleStages;
+    std::map<std::string, modularity::IModuleSetup*> m_deferredModules;
+
+    bool m_startupTimelineEnabled = false;
+    QElapsedTimer m_startupTimer;
+    std::vector<TimelineStep> m_startupTimeline;
+    int m_timelineDepth = 0;
 };
 }
 
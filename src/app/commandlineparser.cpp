@@ -66,6 +66,9 @@ void CommandLineParser::init()
 
     m_parser.addOption(QCommandLineOption("long-version", "Print detailed version information"));
     m_parser.addOption(QCommandLineOption({ "d", "debug" }, "Debug mode"));
+    m_parser.addOption(QCommandLineOption("trace", "Record a Chrome trace (chrome://tracing, Perfetto) and save it to 'file' on exit",
+                                          "file"));
+    m_parser.addOption(QCommandLineOption("startup-timeline", "Print the time spent on setting up each module"));
 
     m_parser.addOption(QCommandLineOption({ "D", "monitor-resolution" }, "Specify monitor resolution", "DPI"));
     m_parser.addOption(QCommandLineOption({ "T", "trim-image" },
@@ -200,6 +203,14 @@ void CommandLineParser::parse(int argc, char** argv)
         m_options.app.loggerLevel = haw::logger::Debug;
     }
 
+    if (m_parser.isSet("trace")) {
+        m_options.app.traceFilePath = fromUserInputPath(m_parser.value("trace")).toStdString();
+    }
+
+    if (m_parser.isSet("startup-timeline")) {
+        m_options.app.startupTimelinePrinted = true;
+    }
+
     if (m_parser.isSet("D")) {
         std::optional<double> val = doubleValue("D");
         if (val) {
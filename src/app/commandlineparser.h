@@ -83,6 +83,8 @@ public:
         struct {
             std::optional<bool> revertToFactorySettings;
             std::optional<haw::logger::Level> loggerLevel;
+            std::optional<std::string> traceFilePath;
+            std::optional<bool> startupTimelinePrinted;
         } app;
 
         struct {
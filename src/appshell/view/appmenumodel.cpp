@@ -365,6 +365,7 @@ MenuItem* AppMenuModel::makeDiagnosticMenu()
     if (globalConfiguration()->devModeEnabled()) {
         MenuItemList engravingItems {
             makeMenuItem("diagnostic-show-engraving-elements"),
+            makeMenuItem("diagnostic-allocators-dump"),
             makeSeparator(),
             makeMenuItem("show-element-bounding-rects"),
             makeMenuItem("color-element-shapes"),
@@ -62,6 +62,11 @@ std::string AutobotModule::moduleName() const
     return "autobot";
 }
 
+bool AutobotModule::isInitOnDemandAllowed() const
+{
+    return true;
+}
+
 void AutobotModule::registerExports()
 {
     m_configuration = std::make_shared<AutobotConfiguration>();
@@ -0,0 +1,146 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "benchmarkrunner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <numeric>
+
+#include "io/file.h"
+#include "serialization/json.h"
+#include "types/datetime.h"
+#include "muversion.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::engraving::benchmarks;
+
+BenchmarkRunner* BenchmarkRunner::instance()
+{
+    static BenchmarkRunner r;
+    return &r;
+}
+
+BenchmarkRunner::BenchmarkRunner()
+{
+    const char* iterations = std::getenv("MU_BENCHMARK_ITERATIONS");
+    if (iterations) {
+        m_iterations = std::max(1, std::atoi(iterations));
+    }
+}
+
+int BenchmarkRunner::iterations() const
+{
+    return m_iterations;
+}
+
+const BenchmarkResult& BenchmarkRunner::run(const std::string& name, const std::string& corpus, const Func& func, const Func& setup,
+                                            const Func& teardown)
+{
+    using namespace std::chrono;
+
+    std::vector<double> timesMs;
+    timesMs.reserve(m_iterations);
+
+    for (int i = 0; i < m_iterations; ++i) {
+        if (setup) {
+            setup();
+        }
+
+        steady_clock::time_point start = steady_clock::now();
+        func();
+        steady_clock::time_point end = steady_clock::now();
+
+        timesMs.push_back(duration<double, std::milli>(end - start).count());
+
+        if (teardown) {
+            teardown();
+        }
+    }
+
+    std::sort(timesMs.begin(), timesMs.end());
+
+    BenchmarkResult result;
+    result.name = name;
+    result.corpus = corpus;
+    result.iterations = m_iterations;
+    result.minMs = timesMs.front();
+    result.maxMs = timesMs.back();
+    result.medianMs = timesMs.at(timesMs.size() / 2);
+    result.meanMs = std::accumulate(timesMs.begin(), timesMs.end(), 0.0) / static_cast<double>(timesMs.size());
+
+    LOGI() << name << " [" << corpus << "]: median " << result.medianMs << " ms, min " << result.minMs << " ms, max " << result.maxMs
+           << " ms (" << m_iterations << " iterations)";
+
+    m_results.push_back(result);
+    return m_results.back();
+}
+
+const std::vector<BenchmarkResult>& BenchmarkRunner::results() const
+{
+    return m_results;
+}
+
+io::path_t BenchmarkRunner::resultsPath() const
+{
+    const char* path = std::getenv("MU_BENCHMARK_RESULTS");
+    if (path && path[0] != '\0') {
+        return path;
+    }
+
+    return "engraving_benchmarks.json";
+}
+
+bool BenchmarkRunner::saveResults(const io::path_t& path) const
+{
+    JsonArray results;
+    for (const BenchmarkResult& r : m_results) {
+        JsonObject obj;
+        obj["name"] = r.name;
+        obj["corpus"] = r.corpus;
+        obj["iterations"] = r.iterations;
+        obj["min_ms"] = r.minMs;
+        obj["median_ms"] = r.medianMs;
+        obj["mean_ms"] = r.meanMs;
+        obj["max_ms"] = r.maxMs;
+        results.append(obj);
+    }
+
+    JsonObject root;
+    root["suite"] = "engraving_benchmarks";
+    root["version"] = framework::MUVersion::fullVersion();
+    root["revision"] = framework::MUVersion::revision();
+    root["date"] = DateTime::currentDateTime().toString(DateFormat::ISODate);
+    root["results"] = results;
+
+    Ret ret = io::File::writeFile(path, JsonDocument(root).toJson());
+    if (!ret) {
+        LOGE() << "failed save benchmark results to: " << path << ", err: " << ret.toString();
+        return false;
+    }
+
+    LOGI() << "benchmark results saved to: " << path;
+    return true;
+}
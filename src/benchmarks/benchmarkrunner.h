@@ -0,0 +1,73 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_ENGRAVING_BENCHMARKRUNNER_H
+#define MU_ENGRAVING_BENCHMARKRUNNER_H
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "io/path.h"
+
+namespace mu::engraving::benchmarks {
+struct BenchmarkResult {
+    std::string name;
+    std::string corpus;
+    int iterations = 0;
+    double minMs = 0.0;
+    double medianMs = 0.0;
+    double meanMs = 0.0;
+    double maxMs = 0.0;
+};
+
+//! NOTE Runs a workload a fixed number of times and collects the timings.
+//! Environment:
+//!   MU_BENCHMARK_ITERATIONS - number of measured iterations (default 5)
+//!   MU_BENCHMARK_RESULTS    - path of the JSON results file (default engraving_benchmarks.json)
+class BenchmarkRunner
+{
+public:
+    static BenchmarkRunner* instance();
+
+    using Func = std::function<void ()>;
+
+    int iterations() const;
+
+    //! NOTE `setup` is called before every iteration and `teardown` after it, neither is measured
+    const BenchmarkResult& run(const std::string& name, const std::string& corpus, const Func& func, const Func& setup = nullptr,
+                               const Func& teardown = nullptr);
+
+    const std::vector<BenchmarkResult>& results() const;
+
+    io::path_t resultsPath() const;
+    bool saveResults(const io::path_t& path) const;
+
+private:
+    BenchmarkRunner();
+
+    int m_iterations = 5;
+    std::vector<BenchmarkResult> m_results;
+};
+}
+
+#endif // MU_ENGRAVING_BENCHMARKRUNNER_H
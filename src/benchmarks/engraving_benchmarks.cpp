@@ -0,0 +1,612 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <random>
+
+#include <QBuffer>
+#include <QImage>
+#include <QPdfWriter>
+#include <QTemporaryDir>
+
+#include "io/buffer.h"
+#include "modularity/ioc.h"
+#include "draw/painter.h"
+
+#include "compat/scoreaccess.h"
+#include "infrastructure/mscreader.h"
+#include "infrastructure/mscwriter.h"
+#include "rw/mscloader.h"
+#include "rw/mscsaver.h"
+
+#include "dom/chord.h"
+#include "dom/factory.h"
+#include "dom/masterscore.h"
+#include "dom/measure.h"
+#include "dom/mscore.h"
+#include "dom/note.h"
+#include "dom/page.h"
+#include "dom/segment.h"
+#include "dom/skyline.h"
+#include "dom/stafftext.h"
+#include "dom/textlayoutcache.h"
+
+#include "playback/playbackmodel.h"
+#include "rendering/iscorerenderer.h"
+
+#include "importexport/imagesexport/internal/svggenerator.h"
+#include "importexport/midi/internal/midiexport/exportmidi.h"
+#include "importexport/midi/internal/midiimport/importmidi_operations.h"
+#include "importexport/musicxml/internal/musicxml/exportxml.h"
+
+#include "mpe/tests/mocks/articulationprofilesrepositorymock.h"
+
+#include "benchmarkrunner.h"
+#include "scoregenerator.h"
+
+namespace mu::engraving {
+extern Err importMusicXml(MasterScore*, QIODevice*, const QString&);
+}
+
+namespace mu::iex::midi {
+extern engraving::Err importMidi(engraving::MasterScore*, const QString& name);
+}
+
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::_;
+
+using namespace mu;
+using namespace mu::engraving;
+using namespace mu::engraving::benchmarks;
+
+//! NOTE These are not tests: every case runs a workload on the synthetic corpus,
+//! prints the timings and appends them to the results file written at the end of the suite.
+//! MU_BENCHMARK_CORPUS=<name> restricts the run to one corpus entry (small, medium, large).
+class Engraving_Benchmarks : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        const char* corpusDir = std::getenv("MU_BENCHMARK_CORPUS_DIR");
+        if (corpusDir && corpusDir[0] != '\0') {
+            ScoreGenerator::saveCorpus(corpusDir);
+        }
+    }
+
+    static void TearDownTestSuite()
+    {
+        BenchmarkRunner::instance()->saveResults(BenchmarkRunner::instance()->resultsPath());
+    }
+
+protected:
+    static std::vector<CorpusEntry> corpus()
+    {
+        const char* only = std::getenv("MU_BENCHMARK_CORPUS");
+        if (!only || only[0] == '\0') {
+            return ScoreGenerator::corpus();
+        }
+
+        std::vector<CorpusEntry> result;
+        for (const CorpusEntry& entry : ScoreGenerator::corpus()) {
+            if (entry.name == only) {
+                result.push_back(entry);
+            }
+        }
+        return result;
+    }
+
+    static ByteArray saveToMscz(MasterScore* score)
+    {
+        ByteArray msczData;
+        io::Buffer buf(&msczData);
+        MscWriter::Params params;
+        params.device = &buf;
+        params.filePath = "benchmark.mscz";
+        params.mode = MscIoMode::Zip;
+
+        MscWriter writer(params);
+        writer.open();
+
+        MscSaver saver;
+        saver.writeMscz(score, writer, false, false);
+        writer.close();
+
+        return msczData;
+    }
+
+    static MasterScore* loadFromMscz(const ByteArray& msczData)
+    {
+        ByteArray data = msczData;
+        io::Buffer buf(&data);
+        MscReader::Params params;
+        params.device = &buf;
+        params.filePath = "benchmark.mscz";
+        params.mode = MscIoMode::Zip;
+
+        MscReader reader(params);
+        reader.open();
+
+        MasterScore* score = compat::ScoreAccess::createMasterScoreWithBaseStyle();
+        MscLoader loader;
+        SettingsCompat settingsCompat;
+        Ret ret = loader.loadMscz(score, reader, settingsCompat, true);
+        EXPECT_TRUE(ret);
+
+        return score;
+    }
+
+    static Note* middleNote(MasterScore* score)
+    {
+        Measure* measure = score->firstMeasure();
+        for (size_t i = 0; i < score->nmeasures() / 2 && measure->nextMeasure(); ++i) {
+            measure = measure->nextMeasure();
+        }
+
+        Segment* segment = measure->first(SegmentType::ChordRest);
+        EngravingItem* item = segment ? segment->element(0) : nullptr;
+        return item && item->isChord() ? toChord(item)->upNote() : nullptr;
+    }
+};
+
+TEST_F(Engraving_Benchmarks, Layout_Full)
+{
+    for (const CorpusEntry& entry : corpus()) {
+        MasterScore* score = ScoreGenerator::generate(entry);
+        ASSERT_TRUE(score);
+
+        BenchmarkRunner::instance()->run("Layout_Full", entry.name, [score]() {
+            score->doLayout();
+        });
+
+        delete score;
+    }
+}
+
+TEST_F(Engraving_Benchmarks, Relayout_AfterEdit)
+{
+    for (const CorpusEntry& entry : corpus()) {
+        MasterScore* score = ScoreGenerator::generate(entry);
+        Note* note = middleNote(score);
+        ASSERT_TRUE(note);
+
+        //! NOTE A typical small edit: change the pitch of one note, this lays out only the affected range
+        BenchmarkRunner::instance()->run("Relayout_AfterEdit", entry.name, [score, note]() {
+            score->startCmd();
+            note->undoChangeProperty(Pid::PITCH, note->pitch() + 1);
+            score->endCmd();
+        }, nullptr, [score]() {
+            score->undoRedo(true, nullptr);
+        });
+
+        BenchmarkRunner::instance()->run("Relayout_Undo", entry.name, [score]() {
+            score->undoRedo(true, nullptr);
+        }, [score, note]() {
+            score->startCmd();
+            note->undoChangeProperty(Pid::PITCH, note->pitch() + 1);
+            score->endCmd();
+        });
+
+        delete score;
+    }
+}
+
+TEST_F(Engraving_Benchmarks, ConcertPitch_Toggle)
+{
+    for (const CorpusEntry& entry : corpus()) {
+        MasterScore* score = ScoreGenerator::generate(entry);
+
+        BenchmarkRunner::instance()->run("ConcertPitch_Toggle", entry.name, [score]() {
+            score->startCmd();
+            score->cmdConcertPitchChanged(true);
+            score->endCmd();
+        }, nullptr, [score]() {
+            score->undoRedo(true, nullptr);
+        });
+
+        delete score;
+    }
+}
+
+TEST_F(Engraving_Benchmarks, Mscz_Save)
+{
+    for (const CorpusEntry& entry : corpus()) {
+        MasterScore* score = ScoreGenerator::generate(entry);
+
+        BenchmarkRunner::instance()->run("Mscz_Save", entry.name, [score]() {
+            ByteArray data = saveToMscz(score);
+            EXPECT_FALSE(data.empty());
+        });
+
+        delete score;
+    }
+}
+
+TEST_F(Engraving_Benchmarks, Mscz_Load)
+{
+    for (const CorpusEntry& entry : corpus()) {
+        MasterScore* origin = ScoreGenerator::generate(entry);
+        ByteArray msczData = saveToMscz(origin);
+        delete origin;
+
+        MasterScore* score = nullptr;
+        BenchmarkRunner::instance()->run("Mscz_Load", entry.name, [&score, &msczData]() {
+            score = loadFromMscz(msczData);
+        }, nullptr, [&score]() {
+            delete score;
+            score = nullptr;
+        });
+
+        BenchmarkRunner::instance()->run("Mscz_LoadAndLayout", entry.name, [&score, &msczData]() {
+            score = loadFromMscz(msczData);
+            score->doLayout();
+        }, nullptr, [&score]() {
+            delete score;
+            score = nullptr;
+        });
+    }
+}
+
+TEST_F(Engraving_Benchmarks, Layout_Texts)
+{
+    static const std::vector<String> TEXTS = {
+        u"Allegro <b>con</b> brio", u"<i>dolce</i>", u"pizz.", u"arco", u"<i>cresc.</i>", u"a tempo"
+    };
+
+    for (const CorpusEntry& entry : corpus()) {
+        MasterScore* score = ScoreGenerator::generate(entry);
+
+        //! NOTE A staff text in every measure of every staff, the same few texts repeat throughout the score
+        size_t textIdx = 0;
+        for (Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+            Segment* segment = m->first(SegmentType::ChordRest);
+            for (staff_idx_t staffIdx = 0; segment && staffIdx < score->nstaves(); ++staffIdx) {
+                StaffText* text = Factory::createStaffText(segment);
+                text->setTrack(staffIdx * VOICES);
+                text->setXmlText(TEXTS.at(textIdx++ % TEXTS.size()));
+                segment->add(text);
+            }
+        }
+
+        //! NOTE Every text is measured from the fonts, as on the first layout after startup
+        BenchmarkRunner::instance()->run("Layout_TextsUncached", entry.name, [score]() {
+            score->doLayout();
+        }, []() {
+            TextLayoutCache::instance()->clear();
+        });
+
+        BenchmarkRunner::instance()->run("Layout_TextsCached", entry.name, [score]() {
+            score->doLayout();
+        });
+
+        delete score;
+    }
+}
+
+TEST_F(Engraving_Benchmarks, PlaybackModel_Load)
+{
+    std::shared_ptr<NiceMock<mpe::ArticulationProfilesRepositoryMock> > repositoryMock
+        = std::make_shared<NiceMock<mpe::ArticulationProfilesRepositoryMock> >();
+    ON_CALL(*repositoryMock, defaultProfile(_)).WillByDefault(Return(std::make_shared<mpe::ArticulationsProfile>()));
+
+    for (const CorpusEntry& entry : corpus()) {
+        MasterScore* score = ScoreGenerator::generate(entry);
+
+        BenchmarkRunner::instance()->run("PlaybackModel_Load", entry.name, [score, repositoryMock]() {
+            PlaybackModel model;
+            model.setprofilesRepository(repositoryMock);
+            model.load(score);
+        });
+
+        delete score;
+    }
+}
+
+TEST_F(Engraving_Benchmarks, MusicXml_Export)
+{
+    for (const CorpusEntry& entry : corpus()) {
+        MasterScore* score = ScoreGenerator::generate(entry);
+
+        BenchmarkRunner::instance()->run("MusicXml_Export", entry.name, [score]() {
+            QByteArray data;
+            QBuffer buf(&data);
+            buf.open(QIODevice::WriteOnly);
+            EXPECT_TRUE(saveXml(score, &buf));
+        });
+
+        delete score;
+    }
+}
+
+TEST_F(Engraving_Benchmarks, MusicXml_Import)
+{
+    for (const CorpusEntry& entry : corpus()) {
+        MasterScore* origin = ScoreGenerator::generate(entry);
+        QByteArray xmlData;
+        QBuffer xmlBuf(&xmlData);
+        xmlBuf.open(QIODevice::WriteOnly);
+        ASSERT_TRUE(saveXml(origin, &xmlBuf));
+        delete origin;
+
+        MasterScore* score = nullptr;
+        BenchmarkRunner::instance()->run("MusicXml_Import", entry.name, [&score, &xmlData]() {
+            QBuffer buf(&xmlData);
+            buf.open(QIODevice::ReadOnly);
+            EXPECT_EQ(importMusicXml(score, &buf, "benchmark.musicxml"), Err::NoError);
+        }, [&score]() {
+            score = compat::ScoreAccess::createMasterScoreWithBaseStyle();
+        }, [&score]() {
+            delete score;
+            score = nullptr;
+        });
+    }
+}
+
+TEST_F(Engraving_Benchmarks, Midi_Import)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    for (const CorpusEntry& entry : corpus()) {
+        const QString path = dir.filePath(QString::fromStdString(entry.name) + ".mid");
+
+        MasterScore* origin = ScoreGenerator::generate(entry);
+        iex::midi::ExportMidi exportMidi(origin);
+        ASSERT_TRUE(exportMidi.write(path, true, true));
+        delete origin;
+
+        //! NOTE The opened MIDI file is forgotten after every iteration,
+        //! so the file is read and all the tracks are analysed every time, as on the first import
+        MasterScore* score = nullptr;
+        BenchmarkRunner::instance()->run("Midi_Import", entry.name, [&score, &path]() {
+            EXPECT_EQ(iex::midi::importMidi(score, path), Err::NoError);
+        }, [&score]() {
+            score = compat::ScoreAccess::createMasterScoreWithBaseStyle();
+        }, [&score, &path]() {
+            iex::midi::midiImportOperations.excludeMidiFile(path);
+            delete score;
+            score = nullptr;
+        });
+    }
+}
+
+//! NOTE The image workloads paint the pages the way the PNG, SVG and PDF writers do,
+//! with their default resolution, but without the notation layer around the score.
+//! pageIdx -1 means all pages
+static rendering::IScoreRenderer::PaintOptions pagePaintOptions(int pageIdx, int deviceDpi)
+{
+    rendering::IScoreRenderer::PaintOptions opt;
+    opt.fromPage = pageIdx;
+    opt.toPage = pageIdx;
+    opt.deviceDpi = deviceDpi;
+    opt.isSetViewport = true;
+    opt.isMultiPage = false;
+    opt.isPrinting = true;
+    return opt;
+}
+
+static void resetPrinting(MasterScore* score, double pixelRatio)
+{
+    score->setPrinting(false);
+    MScore::pdfPrinting = false;
+    MScore::svgPrinting = false;
+    MScore::pixelRatio = pixelRatio;
+}
+
+TEST_F(Engraving_Benchmarks, Png_Export)
+{
+    auto renderer = modularity::ioc()->resolve<rendering::IScoreRenderer>("benchmarks");
+    ASSERT_TRUE(renderer);
+    const double pixelRatio = MScore::pixelRatio;
+
+    for (const CorpusEntry& entry : corpus()) {
+        MasterScore* score = ScoreGenerator::generate(entry);
+
+        BenchmarkRunner::instance()->run("Png_Export", entry.name, [score, renderer]() {
+            for (int pageIdx = 0; pageIdx < static_cast<int>(score->npages()); ++pageIdx) {
+                rendering::IScoreRenderer::PaintOptions opt = pagePaintOptions(pageIdx, static_cast<int>(DPI));
+                opt.printPageBackground = false;
+
+                const SizeF pageSizeInch = renderer->pageSizeInch(score, opt);
+                QImage image(std::lrint(pageSizeInch.width() * DPI), std::lrint(pageSizeInch.height() * DPI),
+                             QImage::Format_ARGB32_Premultiplied);
+                image.fill(Qt::white);
+
+                {
+                    draw::Painter painter(&image, "benchmark");
+                    renderer->paintScore(&painter, score, opt);
+                }
+
+                QByteArray data;
+                QBuffer buf(&data);
+                buf.open(QIODevice::WriteOnly);
+                EXPECT_TRUE(image.save(&buf, "png"));
+            }
+        });
+
+        resetPrinting(score, pixelRatio);
+        delete score;
+    }
+}
+
+TEST_F(Engraving_Benchmarks, Svg_Export)
+{
+    auto renderer = modularity::ioc()->resolve<rendering::IScoreRenderer>("benchmarks");
+    ASSERT_TRUE(renderer);
+    const double pixelRatio = MScore::pixelRatio;
+
+    for (const CorpusEntry& entry : corpus()) {
+        MasterScore* score = ScoreGenerator::generate(entry);
+
+        BenchmarkRunner::instance()->run("Svg_Export", entry.name, [score, renderer]() {
+            MScore::svgPrinting = true;
+
+            for (int pageIdx = 0; pageIdx < static_cast<int>(score->npages()); ++pageIdx) {
+                const RectF pageRect = score->pages().at(pageIdx)->abbox();
+
+                QByteArray data;
+                QBuffer buf(&data);
+                buf.open(QIODevice::WriteOnly);
+
+                SvgGenerator printer;
+                printer.setOutputDevice(&buf);
+                printer.setSize(QSize(static_cast<int>(pageRect.width()), static_cast<int>(pageRect.height())));
+                printer.setViewBox(QRectF(0, 0, pageRect.width(), pageRect.height()));
+
+                rendering::IScoreRenderer::PaintOptions opt = pagePaintOptions(pageIdx, printer.logicalDpiX());
+                opt.isSetViewport = false;
+
+                draw::Painter painter(&printer, "benchmark");
+                renderer->paintScore(&painter, score, opt);
+                painter.endDraw();
+
+                EXPECT_FALSE(data.isEmpty());
+            }
+        });
+
+        resetPrinting(score, pixelRatio);
+        delete score;
+    }
+}
+
+TEST_F(Engraving_Benchmarks, Pdf_Export)
+{
+    auto renderer = modularity::ioc()->resolve<rendering::IScoreRenderer>("benchmarks");
+    ASSERT_TRUE(renderer);
+    const double pixelRatio = MScore::pixelRatio;
+
+    for (const CorpusEntry& entry : corpus()) {
+        MasterScore* score = ScoreGenerator::generate(entry);
+
+        BenchmarkRunner::instance()->run("Pdf_Export", entry.name, [score, renderer]() {
+            QByteArray data;
+            QBuffer buf(&data);
+            buf.open(QIODevice::WriteOnly);
+
+            QPdfWriter pdfWriter(&buf);
+            pdfWriter.setResolution(static_cast<int>(DPI));
+            pdfWriter.setPageSize(QPageSize(renderer->pageSizeInch(score).toQSizeF(), QPageSize::Inch));
+            pdfWriter.setPageMargins(QMarginsF());
+
+            rendering::IScoreRenderer::PaintOptions opt = pagePaintOptions(-1, pdfWriter.logicalDpiX());
+            opt.onNewPage = [&pdfWriter]() { pdfWriter.newPage(); };
+
+            draw::Painter painter(&pdfWriter, "benchmark");
+            renderer->paintScore(&painter, score, opt);
+            painter.endDraw();
+
+            EXPECT_FALSE(data.isEmpty());
+        });
+
+        resetPrinting(score, pixelRatio);
+        delete score;
+    }
+}
+
+//! NOTE Synthetic shapes of one system staff: every segment gets a few small shapes
+//! (noteheads, stems, accidentals...), and some of them are long (slurs, hairpins, lines)
+static std::vector<RectF> systemShapes(size_t count, bool shuffled)
+{
+    std::mt19937 rng(static_cast<std::mt19937::result_type>(count));
+    std::uniform_real_distribution<double> offset(0.0, 1.0);
+    std::uniform_real_distribution<double> height(-30.0, 30.0);
+    std::uniform_real_distribution<double> width(0.5, 3.0);
+
+    std::vector<RectF> shapes;
+    shapes.reserve(count);
+
+    double x = 0.0;
+    for (size_t i = 0; i < count; ++i) {
+        if (i % 5 == 0) {
+            x += 3.0;
+        }
+        double w = offset(rng) < 0.05 ? 40.0 : width(rng);
+        shapes.emplace_back(x + offset(rng), height(rng), w, 4.0);
+    }
+
+    if (shuffled) {
+        std::shuffle(shapes.begin(), shapes.end(), rng);
+    }
+
+    return shapes;
+}
+
+TEST_F(Engraving_Benchmarks, Skyline_Build)
+{
+    for (size_t count : { 1000, 10000, 50000 }) {
+        const std::string corpus = "shapes-" + std::to_string(count);
+
+        //! NOTE Left to right, as the system layout adds segment shapes
+        std::vector<RectF> ordered = systemShapes(count, false);
+        BenchmarkRunner::instance()->run("Skyline_BuildOrdered", corpus, [&ordered]() {
+            Skyline skyline;
+            for (const RectF& r : ordered) {
+                skyline.add(r);
+            }
+            EXPECT_TRUE(skyline.north().valid());
+        });
+
+        //! NOTE Random order, as elements laid out later (spanners, autoplaced text) are added
+        std::vector<RectF> shuffled = systemShapes(count, true);
+        BenchmarkRunner::instance()->run("Skyline_BuildShuffled", corpus, [&shuffled]() {
+            Skyline skyline;
+            for (const RectF& r : shuffled) {
+                skyline.add(r);
+            }
+            EXPECT_TRUE(skyline.north().valid());
+        });
+    }
+}
+
+TEST_F(Engraving_Benchmarks, Skyline_Autoplace)
+{
+    for (size_t count : { 1000, 10000, 50000 }) {
+        const std::string corpus = "shapes-" + std::to_string(count);
+
+        std::vector<RectF> shapes = systemShapes(count, false);
+        std::vector<RectF> placed = systemShapes(1000, true);
+
+        //! NOTE Every autoplaced element is checked against the staff below and then added.
+        //! Autoplace reads the staff skylines through the non-const accessors, which merge the postponed rectangles
+        BenchmarkRunner::instance()->run("Skyline_Autoplace", corpus, [&shapes, &placed]() {
+            Skyline upper;
+            Skyline lower;
+            for (const RectF& r : shapes) {
+                upper.add(r);
+                lower.add(r.translated(PointF(0.0, 80.0)));
+            }
+
+            double dist = std::numeric_limits<double>::lowest();
+            for (const RectF& r : placed) {
+                upper.add(r);
+                dist = std::max(dist, upper.south().minDistance(lower.north()));
+            }
+            EXPECT_LT(dist, 0.0);
+        });
+    }
+}
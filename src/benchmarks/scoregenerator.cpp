@@ -0,0 +1,146 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "scoregenerator.h"
+
+#include "io/file.h"
+#include "io/dir.h"
+#include "io/buffer.h"
+
+#include "compat/scoreaccess.h"
+#include "infrastructure/mscwriter.h"
+#include "rw/mscsaver.h"
+
+#include "dom/durationtype.h"
+#include "dom/masterscore.h"
+#include "dom/mcursor.h"
+#include "dom/staff.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::engraving;
+using namespace mu::engraving::benchmarks;
+
+static const std::vector<String> INSTRUMENTS = {
+    u"flute", u"oboe", u"clarinet", u"bassoon", u"horn", u"trumpet", u"trombone",
+    u"violin", u"violin", u"viola", u"violoncello", u"contrabass"
+};
+
+//! NOTE Rhythm patterns of one 4/4 measure, cycled through measures and staves
+static const std::vector<std::vector<DurationType> > PATTERNS = {
+    { DurationType::V_QUARTER, DurationType::V_QUARTER, DurationType::V_QUARTER, DurationType::V_QUARTER },
+    { DurationType::V_EIGHTH, DurationType::V_EIGHTH, DurationType::V_EIGHTH, DurationType::V_EIGHTH,
+      DurationType::V_EIGHTH, DurationType::V_EIGHTH, DurationType::V_EIGHTH, DurationType::V_EIGHTH },
+    { DurationType::V_HALF, DurationType::V_QUARTER, DurationType::V_QUARTER },
+    { DurationType::V_16TH, DurationType::V_16TH, DurationType::V_16TH, DurationType::V_16TH,
+      DurationType::V_QUARTER, DurationType::V_HALF },
+    { DurationType::V_WHOLE },
+};
+
+std::vector<CorpusEntry> ScoreGenerator::corpus()
+{
+    return {
+        { "small", 2, 32 },
+        { "medium", 12, 200 },
+        { "large", 36, 600 },
+    };
+}
+
+MasterScore* ScoreGenerator::generate(const CorpusEntry& entry)
+{
+    MasterScore* score = compat::ScoreAccess::createMasterScoreWithBaseStyle();
+
+    MCursor c(score);
+    c.setTimeSig(Fraction(4, 4));
+
+    for (size_t i = 0; i < entry.partCount; ++i) {
+        c.addPart(INSTRUMENTS.at(i % INSTRUMENTS.size()));
+    }
+
+    c.move(0, Fraction(0, 1));
+    c.addKeySig(Key::C);
+    c.addTimeSig(Fraction(4, 4));
+
+    for (staff_idx_t staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
+        c.move(static_cast<int>(staffIdx * VOICES), Fraction(0, 1));
+
+        //! NOTE Simple LCG, to keep the pitches identical between runs and platforms
+        uint32_t seed = static_cast<uint32_t>(staffIdx) + 1;
+        int basePitch = 55 + static_cast<int>(staffIdx % 3) * 5;
+
+        for (size_t m = 0; m < entry.measureCount; ++m) {
+            const std::vector<DurationType>& pattern = PATTERNS.at((m + staffIdx) % PATTERNS.size());
+            for (DurationType type : pattern) {
+                seed = seed * 1664525u + 1013904223u;
+                int pitch = basePitch + static_cast<int>((seed >> 16) % 15);
+                c.addChord(pitch, TDuration(type));
+            }
+        }
+    }
+
+    score->setUpTempoMap();
+    score->rebuildMidiMapping();
+    score->setPlaylistDirty();
+    score->doLayout();
+
+    return score;
+}
+
+bool ScoreGenerator::saveCorpus(const io::path_t& dirPath)
+{
+    Ret ret = io::Dir::mkpath(dirPath);
+    if (!ret) {
+        LOGE() << "failed create dir: " << dirPath << ", err: " << ret.toString();
+        return false;
+    }
+
+    for (const CorpusEntry& entry : corpus()) {
+        io::path_t filePath = dirPath.appendingComponent(entry.name + ".mscz");
+        MasterScore* score = generate(entry);
+
+        ByteArray msczData;
+        {
+            io::Buffer buf(&msczData);
+            MscWriter::Params params;
+            params.device = &buf;
+            params.filePath = filePath;
+            params.mode = MscIoMode::Zip;
+
+            MscWriter writer(params);
+            writer.open();
+
+            MscSaver saver;
+            saver.writeMscz(score, writer, false, false);
+        }
+
+        delete score;
+
+        ret = io::File::writeFile(filePath, msczData);
+        if (!ret) {
+            LOGE() << "failed save: " << filePath << ", err: " << ret.toString();
+            return false;
+        }
+    }
+
+    return true;
+}
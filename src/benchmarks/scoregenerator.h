@@ -0,0 +1,57 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_ENGRAVING_SCOREGENERATOR_H
+#define MU_ENGRAVING_SCOREGENERATOR_H
+
+#include <string>
+#include <vector>
+
+#include "io/path.h"
+
+namespace mu::engraving {
+class MasterScore;
+}
+
+namespace mu::engraving::benchmarks {
+//! NOTE Synthetic scores are generated deterministically, so the same corpus
+//! is measured on every machine and every commit without storing large files in the repository
+struct CorpusEntry {
+    std::string name;
+    size_t partCount = 0;
+    size_t measureCount = 0;
+};
+
+class ScoreGenerator
+{
+public:
+    static std::vector<CorpusEntry> corpus();
+
+    static MasterScore* generate(const CorpusEntry& entry);
+
+    //! NOTE Saves the generated corpus as mscz files (MU_BENCHMARK_CORPUS_DIR),
+    //! so the same scores can be fed to the converter and the import/export modules
+    static bool saveCorpus(const io::path_t& dirPath);
+};
+}
+
+#endif // MU_ENGRAVING_SCOREGENERATOR_H
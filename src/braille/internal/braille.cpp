@@ -491,7 +491,7 @@ void BrailleEngravingItems::join(const std::vector<BrailleEngravingItems*>& lst,
     }
 }
 
-QString BrailleEngravingItems::brailleStr()
+QString BrailleEngravingItems::brailleStr() const
 {
     return m_braille_str;
 }
@@ -68,7 +68,7 @@ public:
     void join(BrailleEngravingItems*, bool newline = true, bool del = true);
     void join(const std::vector<BrailleEngravingItems*>&, bool newline = true, bool del = true);
 
-    QString brailleStr();
+    QString brailleStr() const;
     std::vector<std::pair<EngravingItem*, std::pair<int, int> > >* items();
 
     void setBrailleStr(const QString& str);
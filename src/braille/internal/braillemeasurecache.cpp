@@ -0,0 +1,112 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "braillemeasurecache.h"
+
+#include <unordered_set>
+
+#include "containers.h"
+
+#include "engraving/dom/measure.h"
+#include "engraving/dom/score.h"
+
+using namespace mu::engraving;
+
+const BrailleEngravingItems* BrailleMeasureCache::find(const Measure* measure) const
+{
+    auto it = m_entries.find(measure);
+    if (it == m_entries.end()) {
+        return nullptr;
+    }
+
+    const Entry& entry = it->second;
+
+    //! NOTE A measure may have been deleted and another one created at the same address
+    if (entry.revision != m_revision || entry.tick != measure->tick() || entry.ticks != measure->ticks()) {
+        return nullptr;
+    }
+
+    return &entry.items;
+}
+
+void BrailleMeasureCache::insert(const Measure* measure, const BrailleEngravingItems& items)
+{
+    Entry& entry = m_entries[measure];
+    entry.revision = m_revision;
+    entry.tick = measure->tick();
+    entry.ticks = measure->ticks();
+    entry.items = items;
+}
+
+void BrailleMeasureCache::invalidate(const ScoreChangesRange& range, const Score* score)
+{
+    if (!range.isValidBoundary() || !range.changedStyleIdSet.empty()) {
+        invalidateAll();
+        return;
+    }
+
+    //! NOTE Measures were inserted or removed: the following measures are moved,
+    //! and the removed ones stay alive in the undo stack, so their entries are dropped here
+    const bool measuresChanged = mu::contains(range.changedTypes, ElementType::MEASURE);
+
+    std::unordered_set<const Measure*> scoreMeasures;
+    if (measuresChanged && score) {
+        for (const Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+            scoreMeasures.insert(m);
+        }
+    }
+
+    //! NOTE Ties, slurs and hairpins are written in the neighbouring measures too
+    const Fraction from = Fraction::fromTicks(range.tickFrom);
+    const Fraction to = Fraction::fromTicks(range.tickTo);
+
+    for (auto it = m_entries.begin(); it != m_entries.end();) {
+        const Entry& entry = it->second;
+        const Fraction prevTick = entry.tick - entry.ticks;
+        const Fraction nextEndTick = entry.tick + entry.ticks + entry.ticks;
+
+        bool changed = nextEndTick > from && (measuresChanged || prevTick <= to);
+        bool removed = measuresChanged && score && !mu::contains(scoreMeasures, it->first);
+
+        if (changed || removed) {
+            it = m_entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void BrailleMeasureCache::invalidateAll()
+{
+    m_entries.clear();
+    ++m_revision;
+}
+
+size_t BrailleMeasureCache::size() const
+{
+    return m_entries.size();
+}
+
+int BrailleMeasureCache::revision() const
+{
+    return m_revision;
+}
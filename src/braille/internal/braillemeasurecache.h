@@ -0,0 +1,67 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_BRAILLE_BRAILLEMEASURECACHE_H
+#define MU_BRAILLE_BRAILLEMEASURECACHE_H
+
+#include <unordered_map>
+
+#include "engraving/types/fraction.h"
+#include "engraving/dom/types.h"
+
+#include "braille.h"
+
+namespace mu::engraving {
+class Measure;
+class Score;
+
+//! NOTE Braille of measures, as shown in the braille panel.
+//! Entries are keyed by the measure and the revision of the cache, which is bumped
+//! whenever everything has to be translated again (another score, style or table changes).
+//! Edits invalidate only the measures in the changed range; inserting or removing measures
+//! also invalidates the measures after it and drops the ones no longer in the score.
+class BrailleMeasureCache
+{
+public:
+    const BrailleEngravingItems* find(const Measure* measure) const;
+    void insert(const Measure* measure, const BrailleEngravingItems& items);
+
+    void invalidate(const ScoreChangesRange& range, const Score* score);
+    void invalidateAll();
+
+    size_t size() const;
+    int revision() const;
+
+private:
+    struct Entry {
+        int revision = 0;
+        Fraction tick;
+        Fraction ticks;
+        BrailleEngravingItems items;
+    };
+
+    std::unordered_map<const Measure*, Entry> m_entries;
+    int m_revision = 0;
+};
+}
+
+#endif // MU_BRAILLE_BRAILLEMEASURECACHE_H
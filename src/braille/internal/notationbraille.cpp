@@ -20,6 +20,8 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+
 #include "io/iodevice.h"
 #include "io/buffer.h"
 
@@ -27,6 +29,8 @@
 
 #include "translation.h"
 
+#include "async/async.h"
+
 #include "engraving/dom/masterscore.h"
 #include "engraving/dom/spanner.h"
 #include "engraving/dom/segment.h"
@@ -66,18 +70,44 @@ void NotationBraille::init()
     updateTableForLyricsFromPreferences();
     brailleConfiguration()->brailleTableChanged().onNotify(this, [this]() {
         updateTableForLyricsFromPreferences();
+        m_measureCache.invalidateAll();
     });
 
     globalContext()->currentNotationChanged().onNotify(this, [this]() {
-        if (notation()) {
-            notation()->notationChanged().onNotify(this, [this]() {
-                doBraille(true);
-            });
-
-            notation()->interaction()->selectionChanged().onNotify(this, [this]() {
-                doBraille();
-            });
-        }
+        onCurrentNotationChanged();
+    });
+}
+
+void NotationBraille::onCurrentNotationChanged()
+{
+    if (m_notation) {
+        m_notation->undoStack()->changesChannel().resetOnReceive(this);
+        m_notation->notationChanged().resetOnNotify(this);
+        m_notation->interaction()->selectionChanged().resetOnNotify(this);
+    }
+
+    m_notation = notation();
+
+    m_measureCache.invalidateAll();
+    m_pretranslateTicks.clear();
+    current_measure = nullptr;
+
+    if (!m_notation) {
+        return;
+    }
+
+    m_notation->undoStack()->changesChannel().onReceive(this, [this](const ChangesRange& range) {
+        m_measureCache.invalidate(range, score());
+    });
+
+    //! NOTE The edited measures are already invalidated through the changes channel,
+    //! so the current measure is shown again from the cache unless it was edited
+    m_notation->notationChanged().onNotify(this, [this]() {
+        doBraille(true);
+    });
+
+    m_notation->interaction()->selectionChanged().onNotify(this, [this]() {
+        doBraille();
     });
 }
 
@@ -139,11 +169,10 @@ void NotationBraille::doBraille(bool force)
                 current_measure = nullptr;
             } else {
                 if (m != current_measure || force) {
-                    brailleEngravingItems()->clear();
-                    Braille lb(score());
-                    lb.convertMeasure(m, brailleEngravingItems());
+                    m_bei = measureBraille(m);
                     setBrailleInfo(brailleEngravingItems()->brailleStr());
                     current_measure = m;
+                    pretranslateMeasuresAround(m);
                 }
                 std::pair<int, int> pos = brailleEngravingItems()->getBraillePos(e);
                 if (pos.first != -1) {
@@ -154,6 +183,78 @@ void NotationBraille::doBraille(bool force)
     }
 }
 
+//! NOTE Translating a measure goes through liblouis for every item,
+//! so the result is cached until the measure changes
+const BrailleEngravingItems& NotationBraille::measureBraille(Measure* measure)
+{
+    if (const BrailleEngravingItems* cached = m_measureCache.find(measure)) {
+        return *cached;
+    }
+
+    BrailleEngravingItems items;
+    Braille lb(score());
+    lb.convertMeasure(measure, &items);
+    m_measureCache.insert(measure, items);
+
+    return *m_measureCache.find(measure);
+}
+
+//! NOTE The measures the user is likely to move to next are translated in advance,
+//! one per event loop iteration, so that navigation stays responsive.
+//! This runs on the main thread: neither the score nor liblouis may be used concurrently.
+void NotationBraille::pretranslateMeasuresAround(const Measure* measure)
+{
+    static constexpr int MEASURES_AHEAD = 4;
+    static constexpr int MEASURES_BEHIND = 2;
+
+    m_pretranslateTicks.clear();
+
+    const Measure* next = measure->nextMeasure();
+    for (int i = 0; i < MEASURES_AHEAD && next; ++i, next = next->nextMeasure()) {
+        m_pretranslateTicks.push_back(next->tick());
+    }
+
+    const Measure* prev = measure->prevMeasure();
+    for (int i = 0; i < MEASURES_BEHIND && prev; ++i, prev = prev->prevMeasure()) {
+        m_pretranslateTicks.push_back(prev->tick());
+    }
+
+    //! NOTE Taken from the back
+    std::reverse(m_pretranslateTicks.begin(), m_pretranslateTicks.end());
+
+    if (!m_pretranslateScheduled && !m_pretranslateTicks.empty()) {
+        m_pretranslateScheduled = true;
+        async::Async::call(this, [this]() {
+            pretranslateNextMeasure();
+        });
+    }
+}
+
+void NotationBraille::pretranslateNextMeasure()
+{
+    m_pretranslateScheduled = false;
+
+    if (m_pretranslateTicks.empty() || !notation() || !brailleConfiguration()->braillePanelEnabled()) {
+        m_pretranslateTicks.clear();
+        return;
+    }
+
+    Fraction tick = m_pretranslateTicks.back();
+    m_pretranslateTicks.pop_back();
+
+    Measure* measure = score()->tick2measure(tick);
+    if (measure && measure->tick() == tick && !m_measureCache.find(measure)) {
+        measureBraille(measure);
+    }
+
+    if (!m_pretranslateTicks.empty()) {
+        m_pretranslateScheduled = true;
+        async::Async::call(this, [this]() {
+            pretranslateNextMeasure();
+        });
+    }
+}
+
 mu::engraving::Score* NotationBraille::score()
 {
     return notation()->elements()->msScore()->score();
@@ -36,6 +36,7 @@
 #include "async/notification.h"
 
 #include "braille/internal/braille.h"
+#include "braille/internal/braillemeasurecache.h"
 #include "context/iglobalcontext.h"
 #include "notation/inotationconfiguration.h"
 #include "ibrailleconfiguration.h"
@@ -80,6 +81,12 @@ private:
 
     Measure* current_measure = nullptr;
 
+    void onCurrentNotationChanged();
+
+    const BrailleEngravingItems& measureBraille(Measure* measure);
+    void pretranslateMeasuresAround(const Measure* measure);
+    void pretranslateNextMeasure();
+
     void setBrailleInfo(const QString& info);
     void setCurrentShortcut(const QString& sequence);
 
@@ -93,7 +100,12 @@ private:
     ValCh<std::string> m_shortcut;
     ValCh<bool> m_enabled;
 
+    notation::INotationPtr m_notation;
+
     BrailleEngravingItems m_bei;
+    BrailleMeasureCache m_measureCache;
+    std::vector<Fraction> m_pretranslateTicks;
+    bool m_pretranslateScheduled = false;
     async::Notification m_selectionChanged;
 };
 }
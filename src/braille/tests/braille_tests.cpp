@@ -28,7 +28,9 @@
 #include "engraving/tests/utils/scorecomp.h"
 
 #include "engraving/dom/masterscore.h"
+#include "engraving/dom/measure.h"
 #include "../internal/braille.h"
+#include "../internal/braillemeasurecache.h"
 
 using namespace mu;
 using namespace mu::engraving;
@@ -244,3 +246,82 @@ TEST_F(Braille_Tests, hairpins) {
 TEST_F(Braille_Tests, sectionBreak) {
     brailleSaveTest("testSectionBreak");
 }
+
+TEST_F(Braille_Tests, measureCache) {
+    MasterScore* score = ScoreRW::readScore(BRAILLE_DIR + u"testTie_Example_10.1_MBC2015.mscx", false);
+    ASSERT_TRUE(score);
+    score->doLayout();
+
+    Measure* first = score->firstMeasure();
+    ASSERT_TRUE(first && first->nextMeasure() && first->nextMeasure()->nextMeasure());
+    Measure* second = first->nextMeasure();
+    Measure* third = second->nextMeasure();
+
+    BrailleMeasureCache cache;
+    EXPECT_FALSE(cache.find(first));
+
+    BrailleEngravingItems items;
+    items.setBrailleStr("first");
+    cache.insert(first, items);
+    items.setBrailleStr("second");
+    cache.insert(second, items);
+    items.setBrailleStr("third");
+    cache.insert(third, items);
+
+    ASSERT_TRUE(cache.find(second));
+    EXPECT_EQ(cache.find(second)->brailleStr(), "second");
+    EXPECT_EQ(cache.size(), 3u);
+
+    // an edit in the third measure invalidates it and its neighbour only
+    ScoreChangesRange range;
+    range.tickFrom = third->tick().ticks();
+    range.tickTo = third->tick().ticks();
+    range.staffIdxFrom = 0;
+    range.staffIdxTo = 0;
+    cache.invalidate(range, score);
+
+    EXPECT_TRUE(cache.find(first));
+    EXPECT_FALSE(cache.find(second));
+    EXPECT_FALSE(cache.find(third));
+
+    // changes without a range (e.g. style) invalidate everything
+    cache.invalidate(ScoreChangesRange(), score);
+    EXPECT_FALSE(cache.find(first));
+    EXPECT_EQ(cache.size(), 0u);
+
+    delete score;
+}
+
+TEST_F(Braille_Tests, measureCacheRemovedMeasures) {
+    MasterScore* score = ScoreRW::readScore(BRAILLE_DIR + u"testTie_Example_10.1_MBC2015.mscx", false);
+    ASSERT_TRUE(score);
+    score->doLayout();
+
+    Measure* removed = score->firstMeasure()->nextMeasure();
+    Measure* last = score->lastMeasure();
+    ASSERT_TRUE(removed && last && removed->nextMeasure() != last);
+    const int removedTick = removed->tick().ticks();
+
+    BrailleMeasureCache cache;
+    BrailleEngravingItems items;
+    cache.insert(removed, items);
+    cache.insert(last, items);
+
+    score->startCmd();
+    score->deleteMeasures(removed, removed);
+    score->endCmd();
+
+    // the removed measure stays alive in the undo stack, its entry is dropped;
+    // the last measure is far from the change, but it was moved
+    ScoreChangesRange range;
+    range.tickFrom = removedTick;
+    range.tickTo = removedTick;
+    range.staffIdxFrom = 0;
+    range.staffIdxTo = 0;
+    range.changedTypes = { ElementType::MEASURE };
+    cache.invalidate(range, score);
+
+    EXPECT_EQ(cache.size(), 0u);
+
+    delete score;
+}
@@ -49,6 +49,11 @@ std::string CloudModule::moduleName() const
     return "cloud";
 }
 
+bool CloudModule::isInitOnDemandAllowed() const
+{
+    return true;
+}
+
 void CloudModule::registerExports()
 {
     m_cloudConfiguration = std::make_shared<CloudConfiguration>();
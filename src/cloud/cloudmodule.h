@@ -34,6 +34,7 @@ class CloudModule : public modularity::IModuleSetup
 {
 public:
     std::string moduleName() const override;
+    bool isInitOnDemandAllowed() const override;
     void registerExports() override;
     void resolveImports() override;
     void registerResources() override;
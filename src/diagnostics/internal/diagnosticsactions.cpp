@@ -63,6 +63,11 @@ const UiActionList DiagnosticsActions::m_actions = {
              mu::context::UiCtxAny,
              mu::context::CTX_ANY,
              TranslatableString("action", "Engraving &elements")
+             ),
+    UiAction("diagnostic-allocators-dump",
+             mu::context::UiCtxAny,
+             mu::context::CTX_ANY,
+             TranslatableString::untranslatable("Allocators d&ump")
              )
 };
 
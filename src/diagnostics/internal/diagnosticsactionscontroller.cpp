@@ -21,6 +21,7 @@
  */
 #include "diagnosticsactionscontroller.h"
 
+#include "allocator.h"
 #include "types/uri.h"
 
 #include "view/diagnosticaccessiblemodel.h"
@@ -45,6 +46,10 @@ void DiagnosticsActionsController::init()
     dispatcher()->reg(this, "diagnostic-show-accessible-tree", [this]() { openUri(ACCESSIBLE_TREE_URI); });
     dispatcher()->reg(this, "diagnostic-accessible-tree-dump", []() { DiagnosticAccessibleModel::dumpTree(); });
     dispatcher()->reg(this, "diagnostic-show-engraving-elements", [this]() { openUri(ENGRAVING_ELEMENTS_URI, false); });
+    dispatcher()->reg(this, "diagnostic-allocators-dump", []() {
+        AllocatorsRegister::instance()->printStatistic("=== Allocators ===");
+        AllocatorsRegister::instance()->printState("=== Arenas ===");
+    });
     dispatcher()->reg(this, "diagnostic-save-diagnostic-files", this, &DiagnosticsActionsController::saveDiagnosticFiles);
 }
 
@@ -177,6 +177,22 @@ IAccessible::Role AccessibleItem::accessibleRole() const
     return m_role;
 }
 
+bool AccessibleItem::isInfoCacheValid(const InfoCache& cache, const AccessibleRoot* root) const
+{
+    return root && cache.revision == root->infoRevision() && cache.isRangeSelection == root->isRangeSelection();
+}
+
+void AccessibleItem::setInfoCache(InfoCache& cache, const QString& value, const AccessibleRoot* root) const
+{
+    if (!root) {
+        return;
+    }
+
+    cache.value = value;
+    cache.revision = root->infoRevision();
+    cache.isRangeSelection = root->isRangeSelection();
+}
+
 QString AccessibleItem::accessibleName() const
 {
     if (!m_element) {
@@ -184,6 +200,10 @@ QString AccessibleItem::accessibleName() const
     }
 
     AccessibleRoot* root = accessibleRoot();
+    if (isInfoCacheValid(m_nameCache, root)) {
+        return m_nameCache.value;
+    }
+
     QString commandInfo = root ? root->commandInfo() : "";
     QString staffInfo = root ? root->staffInfo() : "";
     QString barsAndBeats = m_element->formatBarsAndBeats();
@@ -198,7 +218,10 @@ QString AccessibleItem::accessibleName() const
                    .arg(!barsAndBeats.isEmpty() ? ("; " + barsAndBeats) : "")
                    .arg(root->isRangeSelection() ? ("; " + qtrc("engraving", "selected")) : "");
 
-    return readable(name);
+    name = readable(name);
+    setInfoCache(m_nameCache, name, root);
+
+    return name;
 }
 
 QString AccessibleItem::accessibleDescription() const
@@ -208,11 +231,20 @@ QString AccessibleItem::accessibleDescription() const
     }
 
     AccessibleRoot* root = accessibleRoot();
+    if (isInfoCacheValid(m_descriptionCache, root)) {
+        return m_descriptionCache.value;
+    }
+
+    QString description;
     if (root->isRangeSelection()) {
-        return readable(root->rangeSelectionInfo());
+        description = readable(root->rangeSelectionInfo());
+    } else {
+        description = readable(m_element->accessibleExtraInfo());
     }
 
-    return readable(m_element->accessibleExtraInfo());
+    setInfoCache(m_descriptionCache, description, root);
+
+    return description;
 }
 
 QVariant AccessibleItem::accessibleValue() const
@@ -96,6 +96,15 @@ public:
 private:
     TextCursor* textCursor() const;
 
+    struct InfoCache {
+        QString value;
+        uint64_t revision = 0;
+        bool isRangeSelection = false;
+    };
+
+    bool isInfoCacheValid(const InfoCache& cache, const AccessibleRoot* root) const;
+    void setInfoCache(InfoCache& cache, const QString& value, const AccessibleRoot* root) const;
+
 protected:
 
     EngravingItem* m_element = nullptr;
@@ -105,6 +114,10 @@ protected:
 
     mu::async::Channel<IAccessible::Property, Val> m_accessiblePropertyChanged;
     mu::async::Channel<IAccessible::State, bool> m_accessibleStateChanged;
+
+    //! NOTE The screen reader asks for the name and description many times, they are built once per root revision
+    mutable InfoCache m_nameCache;
+    mutable InfoCache m_descriptionCache;
 };
 using AccessibleItemPtr = std::shared_ptr<AccessibleItem>;
 using AccessibleItemWeakPtr = std::weak_ptr<AccessibleItem>;
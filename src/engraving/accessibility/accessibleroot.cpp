@@ -35,6 +35,11 @@ using namespace mu::accessibility;
 AccessibleRoot::AccessibleRoot(RootItem* e, Role role)
     : AccessibleItem(e, role)
 {
+    m_focusedElementNameChanged.onNotify(this, [this]() {
+        if (auto focusedElement = m_focusedElement.lock()) {
+            focusedElement->accessiblePropertyChanged().send(accessibility::IAccessible::Property::Name, Val());
+        }
+    });
 }
 
 AccessibleRoot::~AccessibleRoot()
@@ -52,6 +57,9 @@ void AccessibleRoot::setFocusedElement(AccessibleItemPtr e, bool voiceStaffInfoC
     AccessibleItemWeakPtr old = m_focusedElement;
     updateStaffInfo(e, old, voiceStaffInfoChange);
 
+    //! NOTE The focus is notified right away, the name will be requested for the new element anyway
+    m_focusedElementNameChanged.cancel();
+
     if (auto oldItem = old.lock()) {
         oldItem->notifyAboutFocus(false);
     }
@@ -70,10 +78,19 @@ AccessibleItemWeakPtr AccessibleRoot::focusedElement() const
 void AccessibleRoot::notifyAboutFocusedElementNameChanged()
 {
     m_staffInfo = "";
+    invalidateInfo();
 
-    if (auto focusedElement = m_focusedElement.lock()) {
-        focusedElement->accessiblePropertyChanged().send(accessibility::IAccessible::Property::Name, Val());
-    }
+    m_focusedElementNameChanged.notify();
+}
+
+uint64_t AccessibleRoot::infoRevision() const
+{
+    return m_infoRevision;
+}
+
+void AccessibleRoot::invalidateInfo()
+{
+    ++m_infoRevision;
 }
 
 mu::RectF AccessibleRoot::toScreenRect(const RectF& rect, bool* ok) const
@@ -124,6 +141,7 @@ void AccessibleRoot::updateStaffInfo(const AccessibleItemWeakPtr newAccessibleIt
                                      bool voiceStaffInfoChange)
 {
     m_staffInfo = "";
+    invalidateInfo();
 
     if (!voiceStaffInfoChange) {
         return;
@@ -161,6 +179,10 @@ QString AccessibleRoot::commandInfo() const
 
 void AccessibleRoot::setCommandInfo(const QString& command)
 {
+    if (m_commandInfo != command) {
+        invalidateInfo();
+    }
+
     m_commandInfo = command;
 
     if (!m_commandInfo.isEmpty()) {
@@ -22,13 +22,16 @@
 #ifndef MU_ENGRAVING_ACCESSIBLEROOT_H
 #define MU_ENGRAVING_ACCESSIBLEROOT_H
 
+#include "async/asyncable.h"
+#include "async/coalescedchannel.h"
+
 #include "accessibleitem.h"
 #include "../dom/rootitem.h"
 
 namespace mu::engraving {
 using AccessibleMapToScreenFunc = std::function<RectF(const RectF&)>;
 
-class AccessibleRoot : public AccessibleItem
+class AccessibleRoot : public AccessibleItem, public async::Asyncable
 {
     OBJECT_ALLOCATOR(engraving, AccessibleRoot)
 public:
@@ -40,6 +43,10 @@ public:
 
     void notifyAboutFocusedElementNameChanged();
 
+    //! NOTE The names and descriptions of the items are cached until the revision changes
+    uint64_t infoRevision() const;
+    void invalidateInfo();
+
     void setMapToScreenFunc(const AccessibleMapToScreenFunc& func);
     RectF toScreenRect(const RectF& rect, bool* ok = nullptr) const;
 
@@ -70,6 +77,11 @@ private:
 
     QString m_staffInfo;
     QString m_commandInfo;
+
+    uint64_t m_infoRevision = 1;
+
+    //! NOTE A range edit may ask for it many times, the screen reader is notified once
+    async::CoalescedNotification m_focusedElementNameChanged { "accessibility.focusedElementNameChanged" };
 };
 }
 
@@ -2976,6 +2976,7 @@ void GraceNotesGroup::addToShape()
             Shape& s = _appendedSegment->staffShape(vStaffIdx);
             s.add(grace->shape().translated(grace->pos()));
         }
+        _appendedSegment->shapesChanged();
     }
 }
 
@@ -34,6 +34,11 @@
 
 #include "rw/xmlreader.h"
 
+#ifndef ENGRAVING_NO_ACCESSIBILITY
+#include "accessibility/accessibleroot.h"
+#include "compat/dummyelement.h"
+#endif
+
 #include "accidental.h"
 #include "articulation.h"
 #include "barline.h"
@@ -106,6 +111,29 @@ static UndoMacro::ChangesInfo changesInfo(const UndoStack* stack)
     return actualMacro->changesInfo();
 }
 
+static void invalidateAccessibleInfo(Score* score, const ScoreChangesRange& range)
+{
+#ifndef ENGRAVING_NO_ACCESSIBILITY
+    if (!range.isValid() && range.changedPropertyIdSet.empty() && range.changedStyleIdSet.empty()) {
+        return;
+    }
+
+    //! NOTE The names contain the bars and beats, the staff and the part names,
+    //! so a change may affect the names of any item in any score
+    for (Score* s : score->masterScore()->scoreList()) {
+        for (RootItem* rootItem : { s->rootItem(), s->dummy()->rootItem() }) {
+            AccessibleItemPtr accessible = rootItem ? rootItem->accessible() : nullptr;
+            if (AccessibleRoot* root = dynamic_cast<AccessibleRoot*>(accessible.get())) {
+                root->invalidateInfo();
+            }
+        }
+    }
+#else
+    UNUSED(score);
+    UNUSED(range);
+#endif
+}
+
 static std::pair<int, int> changedTicksRange(const CmdState& cmdState, const std::vector<const EngravingItem*>& changedItems)
 {
     int startTick = cmdState.startTick().ticks();
@@ -134,6 +162,7 @@ void CmdState::reset()
 {
     layoutFlags         = LayoutFlag::NO_FLAGS;
     _updateMode         = UpdateMode::DoNothing;
+    _updateAll          = false;
     _startTick          = Fraction(-1, 1);
     _endTick            = Fraction(-1, 1);
 
@@ -255,6 +284,9 @@ void CmdState::_setUpdateMode(UpdateMode m)
 
 void CmdState::setUpdateMode(UpdateMode m)
 {
+    if (m == UpdateMode::UpdateAll) {
+        _updateAll = true;
+    }
     if (int(m) > int(_updateMode)) {
         _setUpdateMode(m);
     }
@@ -287,6 +319,7 @@ void Score::startCmd()
         return;
     }
     undoStack()->beginMacro(this);
+    masterScore()->setArenaForCmd(true);
 }
 
 //---------------------------------------------------------
@@ -304,6 +337,8 @@ void Score::undoRedo(bool undo, EditData* ed)
     //! 2. for the redo operation, the list of changed elements will be available after redo()
     UndoMacro::ChangesInfo changes = changesInfo(undoStack());
 
+    ObjectArena::Scope arenaScope(masterScore()->arena());
+
     cmdState().reset();
     if (undo) {
         undoStack()->undo(ed);
@@ -328,6 +363,7 @@ void Score::undoRedo(bool undo, EditData* ed)
         range.changedStyleIdSet = std::move(changes.changedStyleIdSet);
     }
 
+    invalidateAccessibleInfo(this, range);
     changesChannel().send(range);
 }
 
@@ -365,6 +401,7 @@ void Score::endCmd(bool rollback, bool layoutAllParts)
 
     const bool noUndo = undoStack()->current()->empty(); // nothing to undo?
     undoStack()->endMacro(noUndo);
+    masterScore()->setArenaForCmd(false);
 
     if (dirty()) {
         masterScore()->setPlaylistDirty(); // TODO: flag individual operations
@@ -373,6 +410,7 @@ void Score::endCmd(bool rollback, bool layoutAllParts)
     cmdState().reset();
 
     if (!rollback) {
+        invalidateAccessibleInfo(this, range);
         changesChannel().send(range);
     }
 }
@@ -415,7 +453,7 @@ void Score::update(bool resetCmdState, bool layoutAllParts)
 
     TRACEFUNC;
 
-    bool updateAll = false;
+    bool layoutDone = false;
     {
         MasterScore* ms = masterScore();
         CmdState& cs = ms->cmdState();
@@ -428,7 +466,7 @@ void Score::update(bool resetCmdState, bool layoutAllParts)
                 }
                 s->doLayoutRange(cs.startTick(), cs.endTick());
             }
-            updateAll = true;
+            layoutDone = true;
         }
     }
 
@@ -440,20 +478,39 @@ void Score::update(bool resetCmdState, bool layoutAllParts)
     {
         MasterScore* ms = masterScore();
         CmdState& cs = ms->cmdState();
-        if (updateAll || cs.updateAll()) {
+        if (cs.updateAll()) {
             for (Score* s : scoreList()) {
                 for (MuseScoreView* v : s->m_viewer) {
                     v->updateAll();
                 }
+                s->m_updateState.refresh = RectF();
+                s->m_updateState._refreshAll = false;
+                s->m_updateState.changedRegion = RectF();
+            }
+        } else if (layoutDone || cs.updateRange()) {
+            // only the area changed by the layout or added by the command is redrawn
+            for (Score* s : scoreList()) {
+                UpdateState& us = s->m_updateState;
+                us.changedRegion = RectF();
+                if (us._refreshAll) {
+                    for (MuseScoreView* v : s->m_viewer) {
+                        v->updateAll();
+                    }
+                } else if (!us.refresh.isNull()) {
+                    double d = s->style().spatium() * .5;
+                    us.refresh.adjust(-d, -d, 2 * d, 2 * d);
+                    for (MuseScoreView* v : s->m_viewer) {
+                        v->dataChanged(us.refresh);
+                    }
+                    us.changedRegion = us.refresh;
+                }
+                us.refresh = RectF();
+                us._refreshAll = false;
             }
-        } else if (cs.updateRange()) {
-            // updateRange updates only current score
-            double d = style().spatium() * .5;
-            m_updateState.refresh.adjust(-d, -d, 2 * d, 2 * d);
-            for (MuseScoreView* v : m_viewer) {
-                v->dataChanged(m_updateState.refresh);
+        } else {
+            for (Score* s : scoreList()) {
+                s->m_updateState.changedRegion = RectF();
             }
-            m_updateState.refresh = RectF();
         }
         const InputState& is = inputState();
         if (is.noteEntryMode() && is.segment()) {
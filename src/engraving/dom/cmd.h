@@ -39,6 +39,8 @@ public:
     bool _playNote   { false };     ///< play selected note after command
     bool _playChord  { false };     ///< play whole chord for the selected note
     bool _selectionChanged { false };
+    bool _refreshAll { false };     ///< redraw the whole canvas, the layout has not reported the area it changed
+    mu::RectF changedRegion;           ///< area redrawn by the last update, canvas coordinates; null if the whole canvas
     std::list<EngravingObject*> _deleteList;
 };
 
@@ -53,6 +55,7 @@ public:
 class CmdState
 {
     UpdateMode _updateMode { UpdateMode::DoNothing };
+    bool _updateAll { false };                // complete screen refresh requested, also if a layout is done
     Fraction _startTick { -1, 1 };            // start tick for mode LayoutTick
     Fraction _endTick   { -1, 1 };              // end tick for mode LayoutTick
     staff_idx_t _startStaff = mu::nidx;
@@ -77,7 +80,7 @@ public:
     void setUpdateMode(UpdateMode m);
     void _setUpdateMode(UpdateMode m);
     bool layoutRange() const { return _updateMode == UpdateMode::Layout; }
-    bool updateAll() const { return int(_updateMode) >= int(UpdateMode::UpdateAll); }
+    bool updateAll() const { return _updateAll; }
     bool updateRange() const { return _updateMode == UpdateMode::Update; }
     void setTick(const Fraction& t);
     void setStaff(staff_idx_t staff);
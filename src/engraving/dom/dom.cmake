@@ -331,6 +331,8 @@ set(DOM_SRC
     ${CMAKE_CURRENT_LIST_DIR}/textedit.h
     ${CMAKE_CURRENT_LIST_DIR}/textframe.cpp
     ${CMAKE_CURRENT_LIST_DIR}/textframe.h
+    ${CMAKE_CURRENT_LIST_DIR}/textlayoutcache.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/textlayoutcache.h
     ${CMAKE_CURRENT_LIST_DIR}/textline.cpp
     ${CMAKE_CURRENT_LIST_DIR}/textline.h
     ${CMAKE_CURRENT_LIST_DIR}/textlinebase.cpp
@@ -41,6 +41,7 @@
 #include "score.h"
 #include "segment.h"
 #include "staff.h"
+#include "textlayoutcache.h"
 #include "utils.h"
 
 #include "log.h"
@@ -1300,7 +1301,7 @@ TextSegment::TextSegment(const String& s, const mu::draw::Font& f, double x, dou
 
 double TextSegment::width() const
 {
-    return mu::draw::FontMetrics::width(m_font, text);
+    return TextLayoutCache::instance()->run(text, m_font).width;
 }
 
 //---------------------------------------------------------
@@ -1318,7 +1319,7 @@ RectF TextSegment::boundingRect() const
 
 RectF TextSegment::tightBoundingRect() const
 {
-    return mu::draw::FontMetrics::tightBoundingRect(m_font, text);
+    return TextLayoutCache::instance()->run(text, m_font).tightBoundingRect;
 }
 
 //---------------------------------------------------------
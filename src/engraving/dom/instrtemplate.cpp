@@ -52,6 +52,8 @@ std::vector<InstrumentGenre*> instrumentGenres;
 std::vector<InstrumentFamily*> instrumentFamilies;
 std::vector<ScoreOrder> instrumentOrders;
 
+static InstrumentTemplatesLoader s_instrumentTemplatesLoader;
+
 //---------------------------------------------------------
 //   InstrumentIndex
 //---------------------------------------------------------
@@ -99,6 +101,8 @@ static InstrumentFamily* searchInstrumentFamily(const String& name)
 
 InstrumentGroup* searchInstrumentGroup(const String& name)
 {
+    ensureInstrumentTemplatesLoaded();
+
     for (InstrumentGroup* g : instrumentGroups) {
         if (g->id == name) {
             return g;
@@ -656,6 +660,26 @@ void clearInstrumentTemplates()
     instrumentOrders.clear();
 }
 
+//---------------------------------------------------------
+//   setInstrumentTemplatesLoader
+//---------------------------------------------------------
+
+void setInstrumentTemplatesLoader(const InstrumentTemplatesLoader& loader)
+{
+    s_instrumentTemplatesLoader = loader;
+}
+
+//---------------------------------------------------------
+//   ensureInstrumentTemplatesLoaded
+//---------------------------------------------------------
+
+void ensureInstrumentTemplatesLoaded()
+{
+    if (s_instrumentTemplatesLoader) {
+        s_instrumentTemplatesLoader();
+    }
+}
+
 //---------------------------------------------------------
 //   loadInstrumentTemplates
 //---------------------------------------------------------
@@ -723,6 +747,8 @@ bool loadInstrumentTemplates(const io::path_t& instrTemplatesPath)
 
 InstrumentTemplate* searchTemplate(const String& name)
 {
+    ensureInstrumentTemplatesLoaded();
+
     for (InstrumentGroup* g : instrumentGroups) {
         for (InstrumentTemplate* it : g->instrumentTemplates) {
             if (it->id == name) {
@@ -739,6 +765,8 @@ InstrumentTemplate* searchTemplate(const String& name)
 
 InstrumentTemplate* searchTemplateForMusicXmlId(const String& mxmlId)
 {
+    ensureInstrumentTemplatesLoaded();
+
     for (InstrumentGroup* g : instrumentGroups) {
         for (InstrumentTemplate* it : g->instrumentTemplates) {
             if (it->musicXMLid == mxmlId) {
@@ -751,6 +779,8 @@ InstrumentTemplate* searchTemplateForMusicXmlId(const String& mxmlId)
 
 InstrumentTemplate* searchTemplateForInstrNameList(const std::list<String>& nameList, bool useDrumset)
 {
+    ensureInstrumentTemplatesLoaded();
+
     InstrumentTemplate* bestMatch = nullptr; // default if no matches
     int bestMatchStrength = 0; // higher for better matches
     for (InstrumentGroup* g : instrumentGroups) {
@@ -794,6 +824,8 @@ InstrumentTemplate* searchTemplateForInstrNameList(const std::list<String>& name
 
 InstrumentTemplate* searchTemplateForMidiProgram(int bank, int program, bool useDrumset)
 {
+    ensureInstrumentTemplatesLoaded();
+
     for (InstrumentGroup* g : instrumentGroups) {
         for (InstrumentTemplate* it : g->instrumentTemplates) {
             if (it->useDrumset != useDrumset) {
@@ -817,6 +849,8 @@ InstrumentTemplate* searchTemplateForMidiProgram(int bank, int program, bool use
 
 InstrumentIndex searchTemplateIndexForTrackName(const String& trackName)
 {
+    ensureInstrumentTemplatesLoaded();
+
     int instIndex = 0;
     int grpIndex = 0;
     for (InstrumentGroup* g : instrumentGroups) {
@@ -837,6 +871,8 @@ InstrumentIndex searchTemplateIndexForTrackName(const String& trackName)
 
 InstrumentIndex searchTemplateIndexForId(const String& id)
 {
+    ensureInstrumentTemplatesLoaded();
+
     int instIndex = 0;
     int grpIndex = 0;
     for (InstrumentGroup* g : instrumentGroups) {
@@ -949,6 +985,8 @@ ClefType defaultClef(int program)
         return ClefType::F8_VB;
     }
 
+    ensureInstrumentTemplatesLoaded();
+
     for (InstrumentGroup* g : instrumentGroups) {
         for (InstrumentTemplate* it : g->instrumentTemplates) {
             if (it->channel[0].bank() == 0 && it->channel[0].program() == program) {
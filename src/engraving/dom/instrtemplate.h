@@ -23,6 +23,7 @@
 #ifndef __INSTRTEMPLATE_H__
 #define __INSTRTEMPLATE_H__
 
+#include <functional>
 #include <list>
 
 #include "io/path.h"
@@ -175,6 +176,12 @@ extern std::vector<InstrumentGroup*> instrumentGroups;
 extern std::vector<ScoreOrder> instrumentOrders;
 extern void clearInstrumentTemplates();
 extern bool loadInstrumentTemplates(const io::path_t& instrTemplatesPath);
+
+//! NOTE The templates may be loaded lazily: the loader is called before any access to the lists above,
+//! it must return immediately if the templates are already loaded (or being loaded)
+using InstrumentTemplatesLoader = std::function<void ()>;
+extern void setInstrumentTemplatesLoader(const InstrumentTemplatesLoader& loader);
+extern void ensureInstrumentTemplatesLoaded();
 extern InstrumentTemplate* searchTemplate(const String& name);
 extern InstrumentIndex searchTemplateIndexForTrackName(const String& trackName);
 extern InstrumentIndex searchTemplateIndexForId(const String& id);
@@ -205,6 +205,8 @@ String Instrument::recognizeId() const
     String fallback;
     int bestMatchStrength = 0;     // higher when fallback ID provides better match for instrument data
 
+    ensureInstrumentTemplatesLoaded();
+
     for (InstrumentGroup* g : instrumentGroups) {
         for (InstrumentTemplate* it : g->instrumentTemplates) {
             if (it->musicXMLid != musicXmlId()) {
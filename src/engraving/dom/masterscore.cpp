@@ -55,7 +55,15 @@ MasterScore::MasterScore(std::weak_ptr<engraving::EngravingProject> project)
     : Score()
 {
     m_project = project;
+
+    if (ObjectAllocator::enabled()) {
+        m_arena = ObjectArena::create("score");
+    }
+
     _undoStack   = new UndoStack();
+    if (configuration()) {
+        _undoStack->setMemoryLimit(configuration()->undoHistoryMemoryLimit());
+    }
     _tempomap    = new TempoMap;
     _sigmap      = new TimeSigMap();
     _expandedRepeatList  = new RepeatList(this);
@@ -107,6 +115,25 @@ MasterScore::~MasterScore()
     delete _tempomap;
     delete _undoStack;
     DeleteAll(_excerpts);
+
+    //! NOTE The elements deleted later, by ~Score, are still freed correctly,
+    //! the memory of the arena is released after the last of them
+    ObjectArena::close(m_arena);
+}
+
+//---------------------------------------------------------
+//   setArenaForCmd
+//    the elements created while a command is active are allocated from the arena of the score
+//---------------------------------------------------------
+
+void MasterScore::setArenaForCmd(bool cmdActive)
+{
+    if (cmdActive) {
+        m_arenaBeforeCmd = ObjectArena::setCurrent(m_arena);
+    } else {
+        ObjectArena::setCurrent(m_arenaBeforeCmd);
+        m_arenaBeforeCmd = nullptr;
+    }
 }
 
 //---------------------------------------------------------
@@ -22,6 +22,8 @@
 #ifndef MU_ENGRAVING_MASTERSCORE_H
 #define MU_ENGRAVING_MASTERSCORE_H
 
+#include "global/objectarena.h"
+
 #include "infrastructure/ifileinfoprovider.h"
 
 #include "instrument.h"
@@ -102,6 +104,10 @@ class MasterScore : public Score
 
     std::weak_ptr<EngravingProject> m_project;
 
+    //! NOTE Memory of the elements of the score and its excerpts (only if the custom allocator is enabled)
+    ObjectArena* m_arena = nullptr;
+    ObjectArena* m_arenaBeforeCmd = nullptr;
+
     // FIXME: Move to EngravingProject
     // We can't yet, because m_project is not set on every MasterScore
     IFileInfoProviderPtr m_fileInfoProvider;
@@ -133,6 +139,9 @@ public:
 
     std::weak_ptr<EngravingProject> project() const { return m_project; }
 
+    ObjectArena* arena() const { return m_arena; }
+    void setArenaForCmd(bool cmdActive);
+
     bool isMaster() const override { return true; }
     bool readOnly() const override { return _readOnly; }
     void setReadOnly(bool ro) { _readOnly = ro; }
@@ -24,6 +24,7 @@
 
 #include <algorithm>
 #include <list>
+#include <map>
 #include <utility> // std::pair
 
 #include "jump.h"
@@ -119,8 +120,7 @@ const std::vector<const Measure*>& RepeatSegment::measureList() const
 RepeatList::RepeatList(Score* s)
 {
     _score = s;
-    idx1  = 0;
-    idx2  = 0;
+    updateIndex();
 }
 
 //---------------------------------------------------------
@@ -161,6 +161,8 @@ void RepeatList::update(bool expand)
         flatten();
     }
 
+    updateIndex();
+
     _scoreChanged = false;
 }
 
@@ -172,6 +174,7 @@ void RepeatList::updateTempo()
 {
     const TempoMap* tl = _score->tempomap();
     if (tl->empty()) {
+        updateIndex();
         return;
     }
 
@@ -186,6 +189,67 @@ void RepeatList::updateTempo()
         utick        += s->len();
         t            += tl->tick2time(s->tick + s->len()) - ct;
     }
+
+    updateIndex();
+}
+
+//---------------------------------------------------------
+//   updateIndex
+//---------------------------------------------------------
+
+void RepeatList::updateIndex()
+{
+    auto index = std::make_shared<Index>();
+    index->segments.reserve(size());
+
+    //! NOTE The score ticks of a segment may be played several times (repeats, jumps),
+    //! tick2utick returns the first time, so each range of ticks goes to the first segment that plays it
+    std::map<int, IndexTickRange> ranges;
+
+    for (size_t i = 0; i < size(); ++i) {
+        const RepeatSegment* rs = at(i);
+        IndexSegment seg;
+        seg.tick = rs->tick;
+        seg.utick = rs->utick;
+        seg.len = rs->len();
+        seg.utime = rs->utime;
+        seg.timeOffset = rs->timeOffset;
+        index->segments.push_back(seg);
+
+        int from = seg.tick;
+        const int to = seg.tick + seg.len;
+
+        auto it = ranges.upper_bound(from);
+        if (it != ranges.begin() && std::prev(it)->second.tickTo > from) {
+            from = std::prev(it)->second.tickTo;
+        }
+
+        while (from < to) {
+            int gapTo = (it != ranges.end()) ? std::min(to, it->first) : to;
+            if (from < gapTo) {
+                ranges[from] = { from, gapTo, i };
+            }
+
+            if (it == ranges.end() || it->first >= to) {
+                break;
+            }
+
+            from = std::max(from, it->second.tickTo);
+            ++it;
+        }
+    }
+
+    index->tickRanges.reserve(ranges.size());
+    for (const auto& pair : ranges) {
+        index->tickRanges.push_back(pair.second);
+    }
+
+    std::atomic_store(&_index, std::shared_ptr<const Index>(std::move(index)));
+}
+
+std::shared_ptr<const RepeatList::Index> RepeatList::index() const
+{
+    return std::atomic_load(&_index);
 }
 
 //---------------------------------------------------------
@@ -194,23 +258,28 @@ void RepeatList::updateTempo()
 
 int RepeatList::utick2tick(int tick) const
 {
-    size_t n = size();
-    if (n == 0) {
+    std::shared_ptr<const Index> index = this->index();
+    const std::vector<IndexSegment>& segments = index->segments;
+
+    if (segments.empty()) {
         return tick;
     }
     if (tick < 0) {
         return 0;
     }
-    unsigned ii = (idx1 < n) && (tick >= at(idx1)->utick) ? idx1 : 0;
-    for (unsigned i = ii; i < n; ++i) {
-        if ((tick >= at(i)->utick) && ((i + 1 == n) || (tick < at(i + 1)->utick))) {
-            idx1 = i;
-            return tick - (at(i)->utick - at(i)->tick);
-        }
+
+    //! NOTE The last segment that starts at or before the tick
+    auto it = std::upper_bound(segments.cbegin(), segments.cend(), tick, [](int tick, const IndexSegment& seg) {
+        return tick < seg.utick;
+    });
+
+    if (it == segments.cbegin()) {
+        ASSERT_X(String(u"tick %1 not found in RepeatList").arg(tick));
+        return 0;
     }
 
-    ASSERT_X(String(u"tick %1 not found in RepeatList").arg(tick));
-    return 0;
+    --it;
+    return tick - (it->utick - it->tick);
 }
 
 //---------------------------------------------------------
@@ -219,15 +288,27 @@ int RepeatList::utick2tick(int tick) const
 
 int RepeatList::tick2utick(int tick) const
 {
-    if (empty()) {
+    std::shared_ptr<const Index> index = this->index();
+    const std::vector<IndexSegment>& segments = index->segments;
+
+    if (segments.empty()) {
         return 0;
     }
-    for (const RepeatSegment* s : *this) {
-        if (tick >= s->tick && tick < (s->tick + s->len())) {
-            return s->utick + (tick - s->tick);
+
+    const std::vector<IndexTickRange>& ranges = index->tickRanges;
+    auto it = std::upper_bound(ranges.cbegin(), ranges.cend(), tick, [](int tick, const IndexTickRange& range) {
+        return tick < range.tickFrom;
+    });
+
+    if (it != ranges.cbegin()) {
+        --it;
+        if (tick < it->tickTo) {
+            const IndexSegment& seg = segments.at(it->segmentIdx);
+            return seg.utick + (tick - seg.tick);
         }
     }
-    return back()->utick + (tick - back()->tick);
+
+    return segments.back().utick + (tick - segments.back().tick);
 }
 
 //---------------------------------------------------------
@@ -236,16 +317,21 @@ int RepeatList::tick2utick(int tick) const
 
 double RepeatList::utick2utime(int tick) const
 {
-    size_t n = size();
-    unsigned ii = (idx1 < n) && (tick >= at(idx1)->utick) ? idx1 : 0;
-    for (unsigned i = ii; i < n; ++i) {
-        if ((tick >= at(i)->utick) && ((i + 1 == n) || (tick < at(i + 1)->utick))) {
-            int t     = tick - (at(i)->utick - at(i)->tick);
-            double tt = _score->tempomap()->tick2time(t) + at(i)->timeOffset;
-            return tt;
-        }
+    std::shared_ptr<const Index> index = this->index();
+    const std::vector<IndexSegment>& segments = index->segments;
+
+    auto it = std::upper_bound(segments.cbegin(), segments.cend(), tick, [](int tick, const IndexSegment& seg) {
+        return tick < seg.utick;
+    });
+
+    if (it == segments.cbegin()) {
+        return 0.0;
     }
-    return 0.0;
+
+    --it;
+    int t     = tick - (it->utick - it->tick);
+    double tt = _score->tempomap()->tick2time(t) + it->timeOffset;
+    return tt;
 }
 
 //---------------------------------------------------------
@@ -254,21 +340,24 @@ double RepeatList::utick2utime(int tick) const
 
 int RepeatList::utime2utick(double secs) const
 {
-    size_t repeatSegmentsCount = size();
-    unsigned ii = (idx2 < repeatSegmentsCount) && (secs >= at(idx2)->utime) ? idx2 : 0;
-    for (unsigned i = ii; i < repeatSegmentsCount; ++i) {
-        if ((secs >= at(i)->utime) && ((i + 1 == repeatSegmentsCount) || (secs < at(i + 1)->utime))) {
-            idx2 = i;
-            return _score->tempomap()->time2tick(secs - at(i)->timeOffset) + (at(i)->utick - at(i)->tick);
+    std::shared_ptr<const Index> index = this->index();
+    const std::vector<IndexSegment>& segments = index->segments;
+
+    auto it = std::upper_bound(segments.cbegin(), segments.cend(), secs, [](double secs, const IndexSegment& seg) {
+        return secs < seg.utime;
+    });
+
+    if (it == segments.cbegin()) {
+        if (!segments.empty()) {
+            ASSERT_X(String(u"time %1 not found in RepeatList").arg(secs));
         }
-    }
+        // else: requesting from an empty map can be expected as a valid scenario
 
-    if (!empty()) {
-        ASSERT_X(String(u"time %1 not found in RepeatList").arg(secs));
+        return 0;
     }
-    // else: requesting from an empty map can be expected as a valid scenario
 
-    return 0;
+    --it;
+    return _score->tempomap()->time2tick(secs - it->timeOffset) + (it->utick - it->tick);
 }
 
 ///
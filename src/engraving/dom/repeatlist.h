@@ -23,6 +23,7 @@
 #ifndef __REPEATLIST_H__
 #define __REPEATLIST_H__
 
+#include <memory>
 #include <set>
 #include <vector>
 
@@ -80,7 +81,32 @@ class RepeatList : public std::vector<RepeatSegment*>
     OBJECT_ALLOCATOR(engraving, RepeatList)
 
     Score* _score = nullptr;
-    mutable unsigned idx1, idx2;     // cached values
+
+    //! NOTE Immutable copy of the segments for the tick <-> utick <-> time lookups (binary search),
+    //! replaced as a whole when the list or the tempo changes, so the readers on other threads don't race with the updates
+    struct IndexSegment {
+        int tick = 0;
+        int utick = 0;
+        int len = 0;
+        double utime = 0.0;
+        double timeOffset = 0.0;
+    };
+
+    struct IndexTickRange {
+        int tickFrom = 0;
+        int tickTo = 0;             // excluded
+        size_t segmentIdx = 0;      // the first segment (in the playback order) that plays the range
+    };
+
+    struct Index {
+        std::vector<IndexSegment> segments;         // in the playback order, so sorted by utick and by utime
+        std::vector<IndexTickRange> tickRanges;     // sorted by tick, not overlapping
+    };
+
+    std::shared_ptr<const Index> _index;
+
+    void updateIndex();
+    std::shared_ptr<const Index> index() const;
 
     bool _expanded = false;
     bool _scoreChanged = true;
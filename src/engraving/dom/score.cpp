@@ -5306,6 +5306,18 @@ void Score::addRefresh(const mu::RectF& r)
     cmdState().setUpdateMode(UpdateMode::Update);
 }
 
+//---------------------------------------------------------
+//   addLayoutRefresh
+//    add the canvas area changed by the layout,
+//    reported by the renderer
+//---------------------------------------------------------
+
+void Score::addLayoutRefresh(const mu::RectF& r)
+{
+    m_updateState.refresh.unite(r);
+    m_updateState._refreshAll = false;
+}
+
 //---------------------------------------------------------
 //   staffIdx
 //
@@ -5538,10 +5550,16 @@ void Score::doLayoutRange(const Fraction& st, const Fraction& et)
 {
     TRACEFUNC;
 
+    ObjectArena::Scope arenaScope(masterScore()->arena());
+
     m_engravingFont = engravingFonts()->fontByName(style().value(Sid::MusicalSymbolFont).value<String>().toStdString());
     m_layoutOptions.noteHeadWidth = m_engravingFont->width(SymId::noteheadBlack, style().spatium() / SPATIUM20);
 
+    // the viewers are completely redrawn, unless the renderer reports the area it has changed
+    m_updateState._refreshAll = true;
+    m_updateState.changedRegion = RectF();
     renderer()->layoutScore(this, st, et);
+    ++m_layoutRevision;
 
     if (m_resetAutoplace) {
         m_resetAutoplace = false;
@@ -495,6 +495,9 @@ public:
     virtual void addLayoutFlags(LayoutFlags);
     virtual void setInstrumentsChanged(bool);
     void addRefresh(const mu::RectF&);
+    void addLayoutRefresh(const mu::RectF&);
+    //! NOTE The canvas area changed by the last update(), null if the whole canvas may have changed
+    const mu::RectF& changedRegion() const { return m_updateState.changedRegion; }
 
     void cmdToggleAutoplace(bool all);
 
@@ -766,6 +769,8 @@ public:
 
     void doLayout();
     void doLayoutRange(const Fraction& st, const Fraction& et);
+    //! NOTE Incremented on every layout, lets caches of layout geometry know when they are outdated
+    uint64_t layoutRevision() const { return m_layoutRevision; }
 
     SynthesizerState& synthesizerState() { return m_synthesizerState; }
     void setSynthesizerState(const SynthesizerState& s);
@@ -1034,6 +1039,7 @@ private:
     int m_pageNumberOffset = 0;          // Offset for page numbers.
 
     UpdateState m_updateState;
+    uint64_t m_layoutRevision = 0;
 
     MeasureBaseList m_measures;            // here are the notes
     std::vector<Part*> m_parts;
@@ -22,6 +22,7 @@
 
 #include "segment.h"
 
+#include <atomic>
 #include <climits>
 
 #include "translation.h"
@@ -183,6 +184,7 @@ Segment::Segment(const Segment& s)
         _elist.push_back(ne);
     }
     _shapes  = s._shapes;
+    shapesChanged();
 }
 
 void Segment::setParent(Measure* parent)
@@ -255,6 +257,17 @@ void Segment::init()
     _elist.assign(tracks, 0);
     _preAppendedItems.assign(tracks, 0);
     _shapes.assign(staves, Shape());
+    shapesChanged();
+}
+
+//---------------------------------------------------------
+//   shapesChanged
+//---------------------------------------------------------
+
+void Segment::shapesChanged()
+{
+    static std::atomic<size_t> revision { 0 };
+    _shapesRevision = ++revision;
 }
 
 //---------------------------------------------------------
@@ -511,6 +524,7 @@ void Segment::insertStaff(staff_idx_t staff)
         _preAppendedItems.insert(_preAppendedItems.begin() + track, 0);
     }
     _shapes.insert(_shapes.begin() + staff, Shape());
+    shapesChanged();
 
     for (EngravingItem* e : _annotations) {
         if (moveDownWhenAddingStaves(e, staff)) {
@@ -530,6 +544,7 @@ void Segment::removeStaff(staff_idx_t staff)
     _elist.erase(_elist.begin() + track, _elist.begin() + track + VOICES);
     _preAppendedItems.erase(_preAppendedItems.begin() + track, _preAppendedItems.begin() + track + VOICES);
     _shapes.erase(_shapes.begin() + staff);
+    shapesChanged();
 
     for (EngravingItem* e : _annotations) {
         staff_idx_t staffIdx = e->staffIdx();
@@ -2244,6 +2259,7 @@ void Segment::createShapes()
 
 void Segment::createShape(staff_idx_t staffIdx)
 {
+    shapesChanged();
     Shape& s = _shapes[staffIdx];
     s.setSqueezeFactor(1);
     s.clear();
@@ -2345,6 +2361,7 @@ void Segment::createShape(staff_idx_t staffIdx)
 
 void Segment::addPreAppendedToShape()
 {
+    shapesChanged();
     track_idx_t tracks = score()->ntracks();
     for (unsigned track = 0; track < tracks; ++track) {
         if (!_preAppendedItems[track]) {
@@ -2530,7 +2547,7 @@ double Segment::spacing() const
 //    calculate the minimum distance to ns avoiding collisions
 //---------------------------------------------------------
 
-double Segment::minHorizontalCollidingDistance(Segment* ns) const
+double Segment::minHorizontalCollidingDistance(const Segment* ns) const
 {
     if (isBeginBarLineType() && ns->isStartRepeatBarLineType()) {
         return 0.0;
@@ -2615,7 +2632,7 @@ double Segment::elementsBottomOffsetFromSkyline(staff_idx_t staffIndex) const
 //    calculate the minimum layout distance to Segment ns
 //---------------------------------------------------------
 
-double Segment::minHorizontalDistance(Segment* ns, bool systemHeaderGap) const
+double Segment::minHorizontalDistance(const Segment* ns, bool systemHeaderGap) const
 {
     if (isBeginBarLineType() && ns->isStartRepeatBarLineType()) {
         return 0.0;
@@ -2852,6 +2869,19 @@ void Segment::stretchSegmentsToWidth(std::vector<Spring>& springs, double width)
 }
 
 double Segment::computeDurationStretch(Segment* prevSeg, Fraction minTicks, Fraction maxTicks)
+{
+    return computeDurationStretch(prevSeg, shortestChordRest(), prevSeg ? prevSeg->shortestChordRest() : Fraction(0, 1),
+                                  minTicks, maxTicks);
+}
+
+//---------------------------------------------------------
+//   computeDurationStretch
+//    with the shortest chordrests of this and the previous segment
+//    already known
+//---------------------------------------------------------
+
+double Segment::computeDurationStretch(const Segment* prevSeg, Fraction shortest, Fraction prevShortest, Fraction minTicks,
+                                       Fraction maxTicks) const
 {
     auto doComputeDurationStretch = [&] (Fraction curTicks) -> double
     {
@@ -2894,16 +2924,15 @@ double Segment::computeDurationStretch(Segment* prevSeg, Fraction minTicks, Frac
         return str;
     };
 
-    bool hasAdjacent = isChordRestType() && shortestChordRest() == ticks();
-    bool prevHasAdjacent = prevSeg && (prevSeg->isChordRestType() && prevSeg->shortestChordRest() == prevSeg->ticks());
+    bool hasAdjacent = isChordRestType() && shortest == ticks();
+    bool prevHasAdjacent = prevSeg && (prevSeg->isChordRestType() && prevShortest == prevSeg->ticks());
     // The actual duration of a segment, i.e. ticks(), can be shorter than its shortest note if
     // another voice comes in. In such case, hasAdjacent = false. This info is key to correct spacing.
     double durStretch;
     if (hasAdjacent || measure()->isMMRest()) { // Normal segments
         durStretch = doComputeDurationStretch(ticks());
     } else { // The following calculations are key to correct spacing of polyrythms
-        Fraction curShortest = shortestChordRest();
-        Fraction prevShortest = prevSeg ? prevSeg->shortestChordRest() : Fraction(0, 1);
+        Fraction curShortest = shortest;
         if (prevSeg && !prevHasAdjacent && prevShortest < curShortest) {
             durStretch = doComputeDurationStretch(prevShortest) * (ticks() / prevShortest).toDouble();
         } else {
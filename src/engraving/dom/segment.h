@@ -100,6 +100,7 @@ class Segment final : public EngravingItem
     std::vector<EngravingItem*> _elist;         // EngravingItem storage, size = staves * VOICES.
     std::vector<EngravingItem*> _preAppendedItems; // Container for items appended to the left of this segment (example: grace notes), size = staves * VOICES.
     std::vector<Shape> _shapes;           // size = staves
+    size_t _shapesRevision = 0;
     double m_spacing{ 0 };
 
     CrossBeamType _crossBeamType; // Will affect segment-to-segment horizontal spacing
@@ -207,6 +208,8 @@ public:
     double stretch() const { return _stretch; }
     void setStretch(double v) { _stretch = v; }
     double computeDurationStretch(Segment* prevSeg, Fraction minTicks, Fraction maxTicks);
+    double computeDurationStretch(const Segment* prevSeg, Fraction shortest, Fraction prevShortest, Fraction minTicks,
+                                  Fraction maxTicks) const;
 
     Fraction rtick() const override { return _tick; }
     void setRtick(const Fraction& v) { assert(v >= Fraction(0, 1)); _tick = v; }
@@ -270,13 +273,17 @@ public:
     const std::vector<Shape>& shapes() const { return _shapes; }
     const Shape& staffShape(staff_idx_t staffIdx) const { return _shapes[staffIdx]; }
     Shape& staffShape(staff_idx_t staffIdx) { return _shapes[staffIdx]; }
+    //! NOTE Changes whenever the shapes may have changed, and is never the same for two segments.
+    //! Whoever modifies a shape got from staffShape() must call shapesChanged()
+    size_t shapesRevision() const { return _shapesRevision; }
+    void shapesChanged();
     void createShapes();
     void createShape(staff_idx_t staffIdx);
     double minRight() const;
     double minLeft(const Shape&) const;
     double minLeft() const;
-    double minHorizontalDistance(Segment*, bool isSystemGap) const;
-    double minHorizontalCollidingDistance(Segment* ns) const;
+    double minHorizontalDistance(const Segment*, bool isSystemGap) const;
+    double minHorizontalCollidingDistance(const Segment* ns) const;
 
     double widthOffset() const { return _widthOffset; }
     void setWidthOffset(double w) { _widthOffset = w; }
@@ -22,6 +22,10 @@
 
 #include "skyline.h"
 
+#include <algorithm>
+#include <limits>
+#include <queue>
+
 #include "arpeggio.h"
 #include "beam.h"
 #include "chord.h"
@@ -41,6 +45,11 @@ namespace mu::engraving {
 static const double MAXIMUM_Y = 1000000.0;
 static const double MINIMUM_Y = -1000000.0;
 
+// how far from the end of the line a rectangle may be added directly
+static constexpr int MAX_DIRECT_INSERT_DISTANCE = 1024;
+// up to how many collected rectangles are added directly instead of being swept
+static constexpr size_t MAX_DIRECT_PENDING_COUNT = 8;
+
 // #define SKL_DEBUG
 
 #ifdef SKL_DEBUG
@@ -146,6 +155,174 @@ SkylineLine::SegConstIter SkylineLine::find(double x) const
     return const_cast<SkylineLine*>(this)->find(x);
 }
 
+//---------------------------------------------------------
+//   appendSegment
+//    Appends a segment to the end of the line, joining it
+//    with the last one if it has the same height
+//---------------------------------------------------------
+
+static void appendSegment(std::vector<SkylineSegment>& line, double x, double y, double w)
+{
+    if (!line.empty()) {
+        SkylineSegment& last = line.back();
+        if (last.y == y || w < 0.0000001) {
+            last.w += w;
+            return;
+        }
+    }
+    line.emplace_back(x, y, w);
+}
+
+//---------------------------------------------------------
+//   sweep
+//    Builds a line from unsorted rectangles in O(n log n):
+//    walks the rectangles in x order, keeping the ones
+//    which cover the current position in a heap
+//---------------------------------------------------------
+
+std::vector<SkylineSegment> SkylineLine::sweep(std::vector<SkylineSegment>& rects) const
+{
+    std::vector<SkylineSegment> result;
+    if (rects.empty()) {
+        return result;
+    }
+
+    std::sort(rects.begin(), rects.end(), [](const SkylineSegment& a, const SkylineSegment& b) { return a.x < b.x; });
+
+    const double emptyY = north ? MAXIMUM_Y : MINIMUM_Y;
+    const double infinity = std::numeric_limits<double>::infinity();
+
+    // the top of the heap is the highest (north) or the lowest (south) rectangle
+    auto lower = [this](const SkylineSegment* a, const SkylineSegment* b) {
+        return north ? a->y > b->y : a->y < b->y;
+    };
+    std::priority_queue<const SkylineSegment*, std::vector<const SkylineSegment*>, decltype(lower)> active(lower);
+
+    result.reserve(rects.size() * 2);
+
+    size_t next = 0;
+    double x = 0.0;
+    while (next < rects.size() || !active.empty()) {
+        if (active.empty() && rects[next].x > x) {
+            appendSegment(result, x, emptyY, rects[next].x - x);
+            x = rects[next].x;
+        }
+        while (next < rects.size() && rects[next].x <= x) {
+            active.push(&rects[next++]);
+        }
+        while (!active.empty() && active.top()->x + active.top()->w <= x) {
+            active.pop();
+        }
+        if (active.empty()) {
+            continue;
+        }
+
+        // the top rectangle stays on the line until it ends or another one starts
+        const SkylineSegment* top = active.top();
+        const double xr = std::min(top->x + top->w, next < rects.size() ? rects[next].x : infinity);
+        appendSegment(result, x, top->y, xr - x);
+        x = xr;
+    }
+
+    return result;
+}
+
+//---------------------------------------------------------
+//   merge
+//    Both lines start at 0, the result covers the longer one
+//---------------------------------------------------------
+
+std::vector<SkylineSegment> SkylineLine::merge(const std::vector<SkylineSegment>& a, const std::vector<SkylineSegment>& b) const
+{
+    const double emptyY = north ? MAXIMUM_Y : MINIMUM_Y;
+    const double infinity = std::numeric_limits<double>::infinity();
+
+    std::vector<SkylineSegment> result;
+    result.reserve(a.size() + b.size());
+
+    auto ia = a.cbegin();
+    auto ib = b.cbegin();
+    double aStart = 0.0;
+    double bStart = 0.0;
+    double x = 0.0;
+    while (ia != a.cend() || ib != b.cend()) {
+        const double aEnd = ia != a.cend() ? aStart + ia->w : infinity;
+        const double bEnd = ib != b.cend() ? bStart + ib->w : infinity;
+        const double ya = ia != a.cend() ? ia->y : emptyY;
+        const double yb = ib != b.cend() ? ib->y : emptyY;
+
+        const double xr = std::min(aEnd, bEnd);
+        appendSegment(result, x, north ? std::min(ya, yb) : std::max(ya, yb), xr - x);
+        x = xr;
+
+        if (aEnd <= xr) {
+            aStart = aEnd;
+            ++ia;
+        }
+        if (bEnd <= xr) {
+            bStart = bEnd;
+            ++ib;
+        }
+    }
+
+    return result;
+}
+
+//---------------------------------------------------------
+//   flush
+//    Merges the pending rectangles into the line
+//---------------------------------------------------------
+
+void Skyline::flush()
+{
+    _north.flush();
+    _south.flush();
+}
+
+void SkylineLine::flush()
+{
+    if (pending.empty()) {
+        return;
+    }
+
+    // a few rectangles, e.g. added by autoplace between two queries, are cheaper to insert in place
+    if (pending.size() <= MAX_DIRECT_PENDING_COUNT) {
+        for (const SkylineSegment& r : pending) {
+            addAt(find(r.x), r.x, r.y, r.w);
+        }
+        pending.clear();
+        return;
+    }
+
+    std::vector<SkylineSegment> added = sweep(pending);
+    pending.clear();
+
+    if (seg.empty()) {
+        seg = std::move(added);
+    } else {
+        seg = merge(seg, added);
+    }
+}
+
+//---------------------------------------------------------
+//   segments
+//    Returns the merged segments without changing the line:
+//    the pending rectangles, if any, are merged into a copy
+//    stored in \p buffer
+//---------------------------------------------------------
+
+const std::vector<SkylineSegment>& SkylineLine::segments(std::vector<SkylineSegment>& buffer) const
+{
+    if (pending.empty()) {
+        return seg;
+    }
+
+    SkylineLine line(*this);
+    line.flush();
+    buffer = std::move(line.seg);
+    return buffer;
+}
+
 //---------------------------------------------------------
 //   add
 //---------------------------------------------------------
@@ -187,6 +364,27 @@ void SkylineLine::add(double x, double y, double w)
     DP("===add  %f %f %f\n", x, y, w);
 
     SegIter i = find(x);
+
+    // Inserting in the middle of the line shifts all the segments after it,
+    // so such rectangles are collected and merged in one pass on the next read.
+    // Rectangles near the end of the line, which is the usual case when the line
+    // is built from left to right, are still added directly.
+    if (w > 0.0 && std::distance(i, seg.end()) > MAX_DIRECT_INSERT_DISTANCE) {
+        pending.emplace_back(x, y, w);
+        return;
+    }
+
+    addAt(i, x, y, w);
+}
+
+//---------------------------------------------------------
+//   addAt
+//    Adds a rectangle to the line, starting from the
+//    segment \p i which contains x
+//---------------------------------------------------------
+
+void SkylineLine::addAt(SegIter i, double x, double y, double w)
+{
     double cx = seg.empty() ? 0.0 : i->x;
     for (; i != seg.end(); ++i) {
         double cy = i->y;
@@ -267,6 +465,12 @@ void Skyline::clear()
     _south.clear();
 }
 
+void SkylineLine::clear()
+{
+    seg.clear();
+    pending.clear();
+}
+
 //-------------------------------------------------------------------
 //   minDistance
 //    a is located below this skyline.
@@ -280,17 +484,22 @@ double Skyline::minDistance(const Skyline& s) const
 
 double SkylineLine::minDistance(const SkylineLine& sl) const
 {
+    std::vector<SkylineSegment> buffer;
+    std::vector<SkylineSegment> otherBuffer;
+    const std::vector<SkylineSegment>& segs = segments(buffer);
+    const std::vector<SkylineSegment>& otherSegs = sl.segments(otherBuffer);
+
     double dist = MINIMUM_Y;
 
     double x1 = 0.0;
     double x2 = 0.0;
-    auto k   = sl.begin();
-    for (auto i = begin(); i != end(); ++i) {
-        while (k != sl.end() && (x2 + k->w) < x1) {
+    auto k   = otherSegs.cbegin();
+    for (auto i = segs.cbegin(); i != segs.cend(); ++i) {
+        while (k != otherSegs.cend() && (x2 + k->w) < x1) {
             x2 += k->w;
             ++k;
         }
-        if (k == sl.end()) {
+        if (k == otherSegs.cend()) {
             break;
         }
         for (;;) {
@@ -300,14 +509,14 @@ double SkylineLine::minDistance(const SkylineLine& sl) const
             if (x2 + k->w < x1 + i->w) {
                 x2 += k->w;
                 ++k;
-                if (k == sl.end()) {
+                if (k == otherSegs.cend()) {
                     break;
                 }
             } else {
                 break;
             }
         }
-        if (k == sl.end()) {
+        if (k == otherSegs.cend()) {
             break;
         }
         x1 += i->w;
@@ -335,7 +544,8 @@ void SkylineLine::paint(Painter& painter) const
     double y = 0.0;
 
     bool pvalid = false;
-    for (const SkylineSegment& s : *this) {
+    std::vector<SkylineSegment> buffer;
+    for (const SkylineSegment& s : segments(buffer)) {
         x2 = x1 + s.w;
         if (valid(s)) {
             if (pvalid && !RealIsEqual(y, s.y)) {
@@ -355,6 +565,7 @@ void SkylineLine::paint(Painter& painter) const
 
 bool SkylineLine::valid() const
 {
+    // rectangles are only postponed when the line already has segments
     return !seg.empty();
 }
 
@@ -380,7 +591,8 @@ void Skyline::dump(const char* p, bool n) const
 void SkylineLine::dump() const
 {
     double x = 0.0;
-    for (const SkylineSegment& s : *this) {
+    std::vector<SkylineSegment> buffer;
+    for (const SkylineSegment& s : segments(buffer)) {
         printf("   x %f y %f w %f\n", x, s.y, s.w);
         x += s.w;
     }
@@ -393,14 +605,16 @@ void SkylineLine::dump() const
 double SkylineLine::max() const
 {
     double val;
+    std::vector<SkylineSegment> buffer;
+    const std::vector<SkylineSegment>& segs = segments(buffer);
     if (north) {
         val = MAXIMUM_Y;
-        for (const SkylineSegment& s : *this) {
+        for (const SkylineSegment& s : segs) {
             val = std::min(val, s.y);
         }
     } else {
         val = MINIMUM_Y;
-        for (const SkylineSegment& s : *this) {
+        for (const SkylineSegment& s : segs) {
             val = std::max(val, s.y);
         }
     }
@@ -50,12 +50,20 @@ struct SkylineSegment {
 
 //---------------------------------------------------------
 //   SkylineLine
+//    Rectangles added far from the end of the line are
+//    collected and merged into it by flush(): the whole
+//    batch is swept once in x order and the result is
+//    merged with the existing segments in a single pass.
+//    The const readers never merge, so a const line can be
+//    read from several threads; if the line was not
+//    flushed, they work on a merged copy
 //---------------------------------------------------------
 
 class SkylineLine
 {
     const bool north;
     std::vector<SkylineSegment> seg;
+    std::vector<SkylineSegment> pending;
     typedef std::vector<SkylineSegment>::iterator SegIter;
     typedef std::vector<SkylineSegment>::const_iterator SegConstIter;
 
@@ -63,6 +71,11 @@ class SkylineLine
     void append(double x, double y, double w);
     SegIter find(double x);
     SegConstIter find(double x) const;
+    void addAt(SegIter i, double x, double y, double w);
+
+    const std::vector<SkylineSegment>& segments(std::vector<SkylineSegment>& buffer) const;
+    std::vector<SkylineSegment> sweep(std::vector<SkylineSegment>& rects) const;
+    std::vector<SkylineSegment> merge(const std::vector<SkylineSegment>& a, const std::vector<SkylineSegment>& b) const;
 
 public:
     SkylineLine(bool n)
@@ -72,7 +85,8 @@ public:
     void add(double x, double y, double w);
     void add(const RectF& r) { add(ShapeElement(r)); }
 
-    void clear() { seg.clear(); }
+    void flush();
+    void clear();
     void paint(mu::draw::Painter& painter) const;
     void dump() const;
     double minDistance(const SkylineLine&) const;
@@ -81,10 +95,17 @@ public:
     bool valid(const SkylineSegment& s) const;
     bool isNorth() const { return north; }
 
-    SegIter begin() { return seg.begin(); }
-    SegConstIter begin() const { return seg.begin(); }
-    SegIter end() { return seg.end(); }
-    SegConstIter end() const { return seg.end(); }
+    SegIter begin()
+    {
+        flush();
+        return seg.begin();
+    }
+
+    SegIter end()
+    {
+        flush();
+        return seg.end();
+    }
 };
 
 //---------------------------------------------------------
@@ -101,14 +122,25 @@ public:
         : _north(true), _south(false) {}
 
     void clear();
+    void flush();
     void add(const Shape& s);
     void add(const ShapeElement& r);
     void add(const RectF& r) { add(ShapeElement(r)); }
 
     double minDistance(const Skyline&) const;
 
-    SkylineLine& north() { return _north; }
-    SkylineLine& south() { return _south; }
+    SkylineLine& north()
+    {
+        _north.flush();
+        return _north;
+    }
+
+    SkylineLine& south()
+    {
+        _south.flush();
+        return _south;
+    }
+
     const SkylineLine& north() const { return _north; }
     const SkylineLine& south() const { return _south; }
 
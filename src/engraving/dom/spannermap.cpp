@@ -60,42 +60,30 @@ void SpannerMap::update() const
 //   findContained
 //---------------------------------------------------------
 
-const SpannerMap::IntervalList& SpannerMap::findContained(int start, int stop, bool excludeCollisions) const
+SpannerMap::IntervalList SpannerMap::findContained(int start, int stop, bool excludeCollisions) const
 {
-    if (dirty) {
-        update();
-    }
-
-    results.clear();
+    updateIfDirty();
 
     if (excludeCollisions) {
-        results = collisionFreeTree.findContained(start, stop);
-    } else {
-        results = tree.findContained(start, stop);
+        return collisionFreeTree.findContained(start, stop);
     }
 
-    return results;
+    return tree.findContained(start, stop);
 }
 
 //---------------------------------------------------------
 //   findOverlapping
 //---------------------------------------------------------
 
-const SpannerMap::IntervalList& SpannerMap::findOverlapping(int start, int stop, bool excludeCollisions) const
+SpannerMap::IntervalList SpannerMap::findOverlapping(int start, int stop, bool excludeCollisions) const
 {
-    if (dirty) {
-        update();
-    }
-
-    results.clear();
+    updateIfDirty();
 
     if (excludeCollisions) {
-        results = collisionFreeTree.findOverlapping(start, stop);
-    } else {
-        results = tree.findOverlapping(start, stop);
+        return collisionFreeTree.findOverlapping(start, stop);
     }
 
-    return results;
+    return tree.findOverlapping(start, stop);
 }
 
 void SpannerMap::collectIntervals(IntervalList& regularIntervals, IntervalList& collisionFreeIntervals) const
@@ -39,7 +39,6 @@ class SpannerMap : std::multimap<int, Spanner*>
     mutable bool dirty;
     mutable interval_tree::IntervalTree<Spanner*> tree;
     mutable interval_tree::IntervalTree<Spanner*> collisionFreeTree;
-    mutable std::vector<interval_tree::Interval<Spanner*> > results;
 
 public:
     typedef typename std::multimap<int, Spanner*>::const_reverse_iterator const_reverse_it;
@@ -49,8 +48,10 @@ public:
 
     SpannerMap();
 
-    const IntervalList& findContained(int start, int stop, bool excludeCollisions = false) const;
-    const IntervalList& findOverlapping(int start, int stop, bool excludeCollisions = false) const;
+    //! NOTE The lookups only read the trees once they are up to date,
+    //! so the map can be queried from several threads after updateIfDirty()
+    IntervalList findContained(int start, int stop, bool excludeCollisions = false) const;
+    IntervalList findOverlapping(int start, int stop, bool excludeCollisions = false) const;
     const std::multimap<int, Spanner*>& map() const { return *this; }
 
     void collectIntervals(IntervalList& regularIntervals, IntervalList& collisionFreeIntervals) const;
@@ -64,6 +65,7 @@ public:
     void clear() { std::multimap<int, Spanner*>::clear(); dirty = true; }
     bool empty() const { return std::multimap<int, Spanner*>::empty(); }
     void update() const;
+    void updateIfDirty() const { if (dirty) { update(); } }
     void setDirty() const { dirty = true; }     // must be called if a spanner changes start/length
 #ifndef NDEBUG
     void dump() const;
@@ -22,6 +22,7 @@
 
 #include "tempo.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include "log.h"
@@ -71,6 +72,7 @@ TempoMap::TempoMap()
     _tempo    = 2.0;          // default fixed tempo in beat per second
     _tempoSN  = 1;
     _tempoMultiplier = 1.0;
+    updateTimeIndex();
 }
 
 //---------------------------------------------------------
@@ -129,6 +131,28 @@ void TempoMap::normalize()
         tempo = e->second.tempo.val;
     }
     ++_tempoSN;
+    updateTimeIndex();
+}
+
+//---------------------------------------------------------
+//   updateTimeIndex
+//---------------------------------------------------------
+
+void TempoMap::updateTimeIndex()
+{
+    auto index = std::make_shared<TimeIndex>();
+    index->entries.reserve(size());
+    for (const auto& e : *this) {
+        index->entries.push_back({ e.first, e.second.time, e.second.pause, e.second.tempo });
+    }
+    index->multiplier = _tempoMultiplier;
+
+    std::atomic_store(&_timeIndex, std::shared_ptr<const TimeIndex>(std::move(index)));
+}
+
+std::shared_ptr<const TempoMap::TimeIndex> TempoMap::timeIndex() const
+{
+    return std::atomic_load(&_timeIndex);
 }
 
 //---------------------------------------------------------
@@ -152,6 +176,7 @@ void TempoMap::clear()
 {
     std::map<int, TEvent>::clear();
     ++_tempoSN;
+    updateTimeIndex();
 }
 
 //---------------------------------------------------------
@@ -169,6 +194,7 @@ void TempoMap::clearRange(int tick1, int tick2)
     }
     erase(first, last);
     ++_tempoSN;
+    updateTimeIndex();
 }
 
 //---------------------------------------------------------
@@ -280,29 +306,34 @@ int TempoMap::time2tick(double time, int t, int* sn) const
 
 double TempoMap::tick2time(int tick, int* sn) const
 {
+    std::shared_ptr<const TimeIndex> index = timeIndex();
+    const std::vector<TimeEntry>& entries = index->entries;
+
     double time  = 0.0;
     double delta = double(tick);
     BeatsPerSecond tempo = 2.0;
 
-    if (!empty()) {
+    if (!entries.empty()) {
         int ptick  = 0;
-        auto e = lower_bound(tick);
-        if (e == end()) {
+        auto e = std::lower_bound(entries.cbegin(), entries.cend(), tick, [](const TimeEntry& entry, int tick) {
+            return entry.tick < tick;
+        });
+        if (e == entries.cend()) {
             auto pe = e;
             --pe;
-            ptick = pe->first;
-            tempo = pe->second.tempo;
-            time  = pe->second.time;
-        } else if (e->first == tick) {
+            ptick = pe->tick;
+            tempo = pe->tempo;
+            time  = pe->time;
+        } else if (e->tick == tick) {
             ptick = tick;
-            tempo = e->second.tempo;
-            time  = e->second.time;
-        } else if (e != begin()) {
+            tempo = e->tempo;
+            time  = e->time;
+        } else if (e != entries.cbegin()) {
             auto pe = e;
             --pe;
-            ptick = pe->first;
-            tempo = pe->second.tempo;
-            time  = pe->second.time;
+            ptick = pe->tick;
+            tempo = pe->tempo;
+            time  = pe->time;
         }
         delta = double(tick - ptick);
     } else {
@@ -311,7 +342,7 @@ double TempoMap::tick2time(int tick, int* sn) const
     if (sn) {
         *sn = _tempoSN;
     }
-    time += delta / (Constants::DIVISION * tempo.val * _tempoMultiplier.val);
+    time += delta / (Constants::DIVISION * tempo.val * index->multiplier.val);
     return time;
 }
 
@@ -321,27 +352,33 @@ double TempoMap::tick2time(int tick, int* sn) const
 
 int TempoMap::time2tick(double time, int* sn) const
 {
+    std::shared_ptr<const TimeIndex> index = timeIndex();
+    const std::vector<TimeEntry>& entries = index->entries;
+
     int tick     = 0;
-    double delta = time;
-    BeatsPerSecond tempo = _tempo;
+    double delta = 0.0;
+    BeatsPerSecond tempo = 2.0;
 
-    delta = 0.0;
-    tempo = 2.0;
-    for (auto e = begin(); e != end(); ++e) {
-        // if in a pause period, wait on previous tick
-        if ((time <= e->second.time) && (time > e->second.time - e->second.pause)) {
-            delta = (time - (e->second.time - e->second.pause) + delta);
-            break;
-        }
-        if (e->second.time >= time) {
-            break;
-        }
-        delta = e->second.time;
-        tick  = e->first;
-        tempo = e->second.tempo;
+    //! NOTE The times are non-decreasing, so the first event at or after the given time is found by binary search,
+    //! the previous one (if any) defines the tempo
+    auto e = std::lower_bound(entries.cbegin(), entries.cend(), time, [](const TimeEntry& entry, double time) {
+        return entry.time < time;
+    });
+
+    if (e != entries.cbegin()) {
+        auto pe = e - 1;
+        delta = pe->time;
+        tick  = pe->tick;
+        tempo = pe->tempo;
     }
+
+    // if in a pause period, wait on previous tick
+    if (e != entries.cend() && time > e->time - e->pause) {
+        delta = (time - (e->time - e->pause) + delta);
+    }
+
     delta = time - delta;
-    tick += lrint(delta * _tempoMultiplier.val * Constants::DIVISION * tempo.val);
+    tick += lrint(delta * index->multiplier.val * Constants::DIVISION * tempo.val);
     if (sn) {
         *sn = _tempoSN;
     }
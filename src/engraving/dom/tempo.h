@@ -24,6 +24,8 @@
 #define __AL_TEMPO_H__
 
 #include <map>
+#include <memory>
+#include <vector>
 
 #include "global/allocator.h"
 #include "global/async/notification.h"
@@ -74,8 +76,26 @@ class TempoMap : public std::map<int, TEvent>
     BeatsPerSecond _tempo; // tempo if not using tempo list (beats per second)
     BeatsPerSecond _tempoMultiplier;
 
+    //! NOTE Immutable copy of the events for the tick <-> time lookups (binary search),
+    //! replaced as a whole on every change, so the readers on other threads don't race with the edits
+    struct TimeEntry {
+        int tick = 0;
+        double time = 0.0;
+        double pause = 0.0;
+        BeatsPerSecond tempo;
+    };
+
+    struct TimeIndex {
+        std::vector<TimeEntry> entries;
+        BeatsPerSecond multiplier;
+    };
+
+    std::shared_ptr<const TimeIndex> _timeIndex;
+
     void normalize();
     void del(int tick);
+    void updateTimeIndex();
+    std::shared_ptr<const TimeIndex> timeIndex() const;
 
 public:
     TempoMap();
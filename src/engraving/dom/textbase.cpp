@@ -48,6 +48,7 @@
 #include "page.h"
 #include "score.h"
 #include "textedit.h"
+#include "textlayoutcache.h"
 #include "undo.h"
 
 #include "log.h"
@@ -1011,33 +1012,52 @@ void TextBlock::layout(const TextBase* t)
         _bbox |= temp;
         _lineSpacing = std::max(_lineSpacing, fm.lineSpacing());
     } else {
-        const auto fiLast = --_fragments.end();
-        for (auto fi = _fragments.begin(); fi != _fragments.end(); ++fi) {
-            TextFragment& f = *fi;
-            f.pos.setX(x);
-            mu::draw::FontMetrics fm(f.font(t));
-            if (f.format.valign() != VerticalAlignment::AlignNormal) {
-                double voffset = fm.xHeight() / subScriptSize;           // use original height
-                if (f.format.valign() == VerticalAlignment::AlignSubScript) {
-                    voffset *= subScriptOffset;
-                } else {
-                    voffset *= superScriptOffset;
+        //! NOTE The fragments are shaped once for each text and font, the alignment is applied below
+        std::vector<mu::draw::Font> fonts;
+        fonts.reserve(_fragments.size());
+        String key;
+        for (const TextFragment& f : _fragments) {
+            fonts.push_back(f.font(t));
+            key += TextLayoutCache::runKey(f.text, fonts.back());
+            key += String::number(static_cast<int>(f.format.valign()));
+            key += u'\u001E';
+        }
+
+        TextLayoutCache* cache = TextLayoutCache::instance();
+        TextLayoutCache::BlockShape shape;
+        if (!cache->findBlock(key, shape)) {
+            shape.positions.reserve(_fragments.size());
+            size_t i = 0;
+            for (const TextFragment& f : _fragments) {
+                const mu::draw::Font& font = fonts.at(i++);
+                mu::draw::FontMetrics fm(font);
+                PointF pos(x, 0.0);
+                if (f.format.valign() != VerticalAlignment::AlignNormal) {
+                    double voffset = fm.xHeight() / subScriptSize;           // use original height
+                    if (f.format.valign() == VerticalAlignment::AlignSubScript) {
+                        voffset *= subScriptOffset;
+                    } else {
+                        voffset *= superScriptOffset;
+                    }
+                    pos.setY(voffset);
                 }
-                f.pos.setY(voffset);
-            } else {
-                f.pos.setY(0.0);
-            }
 
-            // Optimization: don't calculate character position
-            // for the next fragment if there is no next fragment
-            if (fi != fiLast) {
-                const double w  = fm.width(f.text);
-                x += w;
+                TextLayoutCache::Run run = cache->run(f.text, font);
+                x += run.width;
+
+                shape.positions.push_back(pos);
+                shape.bbox |= run.tightBoundingRect.translated(pos);
+                shape.lineSpacing = std::max(shape.lineSpacing, fm.lineSpacing());
             }
+            cache->insertBlock(key, shape);
+        }
 
-            _bbox   |= fm.tightBoundingRect(f.text).translated(f.pos);
-            _lineSpacing = std::max(_lineSpacing, fm.lineSpacing());
+        size_t i = 0;
+        for (TextFragment& f : _fragments) {
+            f.pos = shape.positions.at(i++);
         }
+        _bbox = shape.bbox;
+        _lineSpacing = shape.lineSpacing;
     }
 
     // Apply style/custom line spacing
@@ -0,0 +1,138 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "textlayoutcache.h"
+
+#include <mutex>
+
+#include "draw/fontmetrics.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+//! NOTE Dropped as a whole when full, the texts of the open scores are measured again on the next layout
+static constexpr size_t MAX_CACHED_RUNS = 20000;
+static constexpr size_t MAX_CACHED_BLOCKS = 20000;
+
+static constexpr char16_t KEY_SEPARATOR = u'\u001F';
+
+//---------------------------------------------------------
+//   instance
+//---------------------------------------------------------
+
+TextLayoutCache* TextLayoutCache::instance()
+{
+    static TextLayoutCache cache;
+    return &cache;
+}
+
+//---------------------------------------------------------
+//   runKey
+//---------------------------------------------------------
+
+String TextLayoutCache::runKey(const String& text, const mu::draw::Font& font)
+{
+    String key = text;
+    key += KEY_SEPARATOR;
+    key += font.family();
+    key += KEY_SEPARATOR;
+    key += String::number(static_cast<int>(font.type()));
+    key += KEY_SEPARATOR;
+    key += String::number(font.pointSizeF());
+    key += KEY_SEPARATOR;
+    key += String::number(font.pixelSize());
+    key += KEY_SEPARATOR;
+    key += String::number(static_cast<int>(font.weight()));
+    key += font.bold() ? u'b' : u'-';
+    key += font.italic() ? u'i' : u'-';
+    key += font.underline() ? u'u' : u'-';
+    key += font.strike() ? u's' : u'-';
+    key += font.noFontMerging() ? u'n' : u'-';
+    key += String::number(static_cast<int>(font.hinting()));
+    return key;
+}
+
+//---------------------------------------------------------
+//   run
+//---------------------------------------------------------
+
+TextLayoutCache::Run TextLayoutCache::run(const String& text, const mu::draw::Font& font)
+{
+    const String key = runKey(text, font);
+    {
+        std::shared_lock lock(m_mutex);
+        auto it = m_runs.find(key);
+        if (it != m_runs.end()) {
+            return it->second;
+        }
+    }
+
+    mu::draw::FontMetrics fm(font);
+    Run r;
+    r.width = fm.width(text);
+    r.tightBoundingRect = fm.tightBoundingRect(text);
+
+    std::unique_lock lock(m_mutex);
+    if (m_runs.size() >= MAX_CACHED_RUNS) {
+        m_runs.clear();
+    }
+    m_runs.emplace(key, r);
+    return r;
+}
+
+//---------------------------------------------------------
+//   findBlock
+//---------------------------------------------------------
+
+bool TextLayoutCache::findBlock(const String& key, BlockShape& shape) const
+{
+    std::shared_lock lock(m_mutex);
+    auto it = m_blocks.find(key);
+    if (it == m_blocks.end()) {
+        return false;
+    }
+    shape = it->second;
+    return true;
+}
+
+//---------------------------------------------------------
+//   insertBlock
+//---------------------------------------------------------
+
+void TextLayoutCache::insertBlock(const String& key, const BlockShape& shape)
+{
+    std::unique_lock lock(m_mutex);
+    if (m_blocks.size() >= MAX_CACHED_BLOCKS) {
+        m_blocks.clear();
+    }
+    m_blocks.emplace(key, shape);
+}
+
+//---------------------------------------------------------
+//   clear
+//---------------------------------------------------------
+
+void TextLayoutCache::clear()
+{
+    std::unique_lock lock(m_mutex);
+    m_runs.clear();
+    m_blocks.clear();
+}
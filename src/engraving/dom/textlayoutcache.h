@@ -0,0 +1,81 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_TEXTLAYOUTCACHE_H
+#define MU_ENGRAVING_TEXTLAYOUTCACHE_H
+
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "draw/types/font.h"
+#include "draw/types/geometry.h"
+#include "types/string.h"
+
+namespace mu::engraving {
+//---------------------------------------------------------
+//   TextLayoutCache
+//    process wide store of measured text. The font of a
+//    text already holds its style, size, spatium and mag,
+//    so texts with the same content and font share one
+//    shaped result, whichever score or element they belong to.
+//    Safe to use from the parallel layout and export.
+//---------------------------------------------------------
+
+class TextLayoutCache
+{
+public:
+    //! NOTE The metrics of one run of text in one font
+    struct Run {
+        double width = 0.0;
+        RectF tightBoundingRect;
+    };
+
+    //! NOTE The shape of a text block before the horizontal alignment:
+    //! the position of each fragment, the bbox and the line spacing
+    struct BlockShape {
+        std::vector<PointF> positions;
+        RectF bbox;
+        double lineSpacing = 0.0;
+    };
+
+    static TextLayoutCache* instance();
+
+    static String runKey(const String& text, const mu::draw::Font& font);
+
+    Run run(const String& text, const mu::draw::Font& font);
+
+    bool findBlock(const String& key, BlockShape& shape) const;
+    void insertBlock(const String& key, const BlockShape& shape);
+
+    //! NOTE The measurements depend on the installed fonts
+    void clear();
+
+private:
+    TextLayoutCache() = default;
+
+    mutable std::shared_mutex m_mutex;
+    std::unordered_map<String, Run> m_runs;
+    std::unordered_map<String, BlockShape> m_blocks;
+};
+}
+
+#endif // MU_ENGRAVING_TEXTLAYOUTCACHE_H
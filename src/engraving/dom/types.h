@@ -23,6 +23,7 @@
 #ifndef __TYPES_H__
 #define __TYPES_H__
 
+#include <algorithm>
 #include <unordered_set>
 
 #include "containers.h"
@@ -118,6 +119,8 @@ enum class CommandType {
 
     // Property
     ChangeProperty,
+    ChangeBracketProperty,
+    ChangeTextLineProperty,
 
     // Voices
     ExchangeVoice,
@@ -510,6 +513,23 @@ struct ScoreChangesRange {
     {
         return isValidBoundary() || !changedTypes.empty();
     }
+
+    //! NOTE Extends the range so that it covers the given one as well;
+    //! an unbounded side (-1 or nidx) of either range stays unbounded
+    void merge(const ScoreChangesRange& range)
+    {
+        tickFrom = (tickFrom == -1 || range.tickFrom == -1) ? -1 : std::min(tickFrom, range.tickFrom);
+        tickTo = (tickTo == -1 || range.tickTo == -1) ? -1 : std::max(tickTo, range.tickTo);
+
+        staffIdxFrom = (staffIdxFrom == mu::nidx || range.staffIdxFrom == mu::nidx)
+                       ? mu::nidx : std::min(staffIdxFrom, range.staffIdxFrom);
+        staffIdxTo = (staffIdxTo == mu::nidx || range.staffIdxTo == mu::nidx)
+                     ? mu::nidx : std::max(staffIdxTo, range.staffIdxTo);
+
+        changedTypes.insert(range.changedTypes.cbegin(), range.changedTypes.cend());
+        changedPropertyIdSet.insert(range.changedPropertyIdSet.cbegin(), range.changedPropertyIdSet.cend());
+        changedStyleIdSet.insert(range.changedStyleIdSet.cbegin(), range.changedStyleIdSet.cend());
+    }
 };
 } // namespace mu::engraving
 
@@ -34,6 +34,9 @@
 
 #include "undo.h"
 
+#include <algorithm>
+#include <set>
+
 #include "iengravingfont.h"
 
 #include "bend.h"
@@ -48,6 +51,7 @@
 #include "harppedaldiagram.h"
 #include "input.h"
 #include "instrchange.h"
+#include "instrument.h"
 #include "key.h"
 #include "keysig.h"
 #include "linkedobjects.h"
@@ -219,6 +223,110 @@ void UndoCommand::appendChildren(UndoCommand* other)
     other->childList.clear();
 }
 
+//---------------------------------------------------------
+//   memoryUsage
+//---------------------------------------------------------
+
+size_t UndoCommand::memoryUsage() const
+{
+    // node of std::list: two links + the value
+    constexpr size_t LIST_NODE_SIZE = 3 * sizeof(void*);
+
+    size_t result = sizeof(UndoCommand);
+    for (const UndoCommand* c : childList) {
+        result += LIST_NODE_SIZE + c->memoryUsage();
+    }
+    return result;
+}
+
+//---------------------------------------------------------
+//   treeMemoryUsage
+///   Estimates the memory of an element owned by a command
+///   (e.g. a removed one) together with its children in the
+///   score tree
+//---------------------------------------------------------
+
+static size_t treeMemoryUsage(const EngravingObject* obj)
+{
+    if (!obj) {
+        return 0;
+    }
+
+    size_t result = sizeof(EngravingItem);
+    for (const EngravingObject* child : obj->scanChildren()) {
+        result += treeMemoryUsage(child);
+    }
+    return result;
+}
+
+//---------------------------------------------------------
+//   propertyMemoryUsage
+///   Estimates the memory of a property value: the value
+///   is allocated on the heap, containers own their items
+//---------------------------------------------------------
+
+static size_t propertyMemoryUsage(const PropertyValue& value)
+{
+    // the shared data: the control block and the value holder
+    constexpr size_t VALUE_HOLDER_SIZE = 4 * sizeof(void*);
+
+    switch (value.type()) {
+    case P_TYPE::UNDEFINED:
+        return 0;
+    case P_TYPE::STRING:
+        return VALUE_HOLDER_SIZE + value.value<String>().size() * sizeof(char16_t);
+    case P_TYPE::INT_VEC:
+        return VALUE_HOLDER_SIZE + value.value<std::vector<int> >().size() * sizeof(int);
+    case P_TYPE::PITCH_VALUES:
+        return VALUE_HOLDER_SIZE + value.value<PitchValues>().size() * sizeof(PitchValue);
+    case P_TYPE::GROUPS:
+        return VALUE_HOLDER_SIZE + value.value<GroupNodes>().size() * sizeof(GroupNode);
+    case P_TYPE::DRAW_PATH:
+        return VALUE_HOLDER_SIZE + value.value<PainterPath>().elementCount() * sizeof(PainterPath::Element);
+    default:
+        break;
+    }
+
+    return VALUE_HOLDER_SIZE;
+}
+
+//---------------------------------------------------------
+//   removeRepeatedPropertyChanges
+///   If all children are plain property changes, keeps only
+///   the first change of every element property and deletes
+///   the rest. Returns false if there is anything else.
+//---------------------------------------------------------
+
+static bool isPlainChangeProperty(const UndoCommand* cmd)
+{
+    return cmd->type() == CommandType::ChangeProperty;
+}
+
+bool UndoCommand::removeRepeatedPropertyChanges()
+{
+    for (const UndoCommand* cmd : childList) {
+        if (!isPlainChangeProperty(cmd)) {
+            return false;
+        }
+    }
+
+    // The first change holds the value from before this command. When it gets undone,
+    // it stores the current (i.e. the latest) value, so redo still restores the final state.
+    std::set<std::pair<const EngravingObject*, Pid> > changed;
+    std::list<UndoCommand*> acceptedList;
+    for (UndoCommand* cmd : childList) {
+        const ChangeProperty* cp = static_cast<const ChangeProperty*>(cmd);
+        if (changed.insert({ cp->getElement(), cp->getId() }).second) {
+            acceptedList.push_back(cmd);
+        } else {
+            delete cmd;
+        }
+    }
+    childList = std::move(acceptedList);
+
+    return true;
+}
+
 //---------------------------------------------------------
 //   hasFilteredChildren
 //---------------------------------------------------------
@@ -311,6 +419,107 @@ UndoStack::~UndoStack()
     DeleteAll(list);
 }
 
+//---------------------------------------------------------
+//   setMemoryLimit
+//---------------------------------------------------------
+
+void UndoStack::setMemoryLimit(size_t bytes)
+{
+    if (m_memoryLimit == bytes) {
+        return;
+    }
+
+    m_memoryLimit = bytes;
+    applyMemoryLimit();
+}
+
+//---------------------------------------------------------
+//   deleteMacro
+//---------------------------------------------------------
+
+void UndoStack::deleteMacro(UndoMacro* macro, bool undo)
+{
+    m_memoryUsage -= std::min(m_memoryUsage, macro->memoryUsage());
+    macro->cleanup(undo);      // delete elements for which UndoCommand() holds ownership
+    delete macro;
+}
+
+//---------------------------------------------------------
+//   applyMemoryLimit
+///   First compacts the oldest applied macros, merging
+///   consecutive macros which change the same properties
+///   of the same elements, then drops the oldest macros.
+///   Goes down to 3/4 of the limit, so that it doesn't
+///   have to run again on every command.
+//---------------------------------------------------------
+
+static std::set<std::pair<const EngravingObject*, Pid> > changedProperties(const UndoMacro* macro)
+{
+    std::set<std::pair<const EngravingObject*, Pid> > result;
+    for (const UndoCommand* cmd : macro->commands()) {
+        if (!isPlainChangeProperty(cmd)) {
+            return {};
+        }
+        const ChangeProperty* cp = static_cast<const ChangeProperty*>(cmd);
+        result.insert({ cp->getElement(), cp->getId() });
+    }
+    return result;
+}
+
+void UndoStack::applyMemoryLimit()
+{
+    if (m_memoryLimit == 0 || m_memoryUsage <= m_memoryLimit) {
+        return;
+    }
+
+    TRACEFUNC;
+
+    const size_t target = m_memoryLimit / 4 * 3;
+
+    // never touch the latest macro: undo/redo and merging of the recent commands stay as is
+    size_t idx = 0;
+    while (m_memoryUsage > target && idx + 1 < curIdx) {
+        UndoMacro* macro = list[idx];
+        UndoMacro* next = list[idx + 1];
+
+        if (!macro->isCompacted()) {
+            m_memoryUsage -= std::min(m_memoryUsage, macro->memoryUsage());
+            macro->compact();
+            m_memoryUsage += macro->memoryUsage();
+        }
+
+        const auto properties = changedProperties(macro);
+        if (!properties.empty() && idx + 2 < curIdx && properties == changedProperties(next)) {
+            m_memoryUsage -= std::min(m_memoryUsage, macro->memoryUsage() + next->memoryUsage());
+            macro->append(std::move(*next));
+            macro->compact();
+            m_memoryUsage += macro->memoryUsage();
+
+            list.erase(list.begin() + idx + 1);
+            stateList.erase(stateList.begin() + idx + 1);
+            m_absoluteIdxList.erase(m_absoluteIdxList.begin() + idx + 1);
+            delete next;
+            --curIdx;
+            ++m_droppedCount;
+            continue;
+        }
+
+        ++idx;
+    }
+
+    while (m_memoryUsage > target && curIdx > 1) {
+        UndoMacro* macro = mu::takeFirst(list);
+        stateList.erase(stateList.begin());
+        m_absoluteIdxList.erase(m_absoluteIdxList.begin());
+        m_firstAbsoluteIdx = m_absoluteIdxList.front();
+        --curIdx;
+        ++m_droppedCount;
+        deleteMacro(macro, true);
+    }
+
+    LOGD() << "undo history: " << list.size() << " macros, " << m_memoryUsage << " bytes, dropped: " << m_droppedCount;
+}
+
 bool UndoStack::locked() const
 {
     return isLocked;
@@ -391,17 +600,17 @@ void UndoStack::remove(size_t idx)
     assert(curIdx != mu::nidx);
     // remove redo stack
     while (list.size() > curIdx) {
-        UndoCommand* cmd = mu::takeLast(list);
+        UndoMacro* cmd = mu::takeLast(list);
         stateList.pop_back();
-        cmd->cleanup(false);      // delete elements for which UndoCommand() holds ownership
-        delete cmd;
+        m_absoluteIdxList.pop_back();
+        deleteMacro(cmd, false);
 //            --curIdx;
     }
     while (list.size() > idx) {
-        UndoCommand* cmd = mu::takeLast(list);
+        UndoMacro* cmd = mu::takeLast(list);
         stateList.pop_back();
-        cmd->cleanup(true);
-        delete cmd;
+        m_absoluteIdxList.pop_back();
+        deleteMacro(cmd, true);
     }
     curIdx = idx;
 }
@@ -412,6 +621,10 @@ void UndoStack::remove(size_t idx)
 
 void UndoStack::mergeCommands(size_t startIdx)
 {
+    // startIdx is absolute: the macros before it may have been dropped meanwhile,
+    // and the ones after it may have been merged together by the memory limit
+    startIdx = std::lower_bound(m_absoluteIdxList.cbegin(), m_absoluteIdxList.cend(), startIdx) - m_absoluteIdxList.cbegin();
+
     assert(startIdx <= curIdx);
 
     if (startIdx >= list.size()) {
@@ -420,10 +633,12 @@ void UndoStack::mergeCommands(size_t startIdx)
 
     UndoMacro* startMacro = list[startIdx];
 
+    m_memoryUsage -= std::min(m_memoryUsage, startMacro->memoryUsage());
     for (size_t idx = startIdx + 1; idx < curIdx; ++idx) {
         startMacro->append(std::move(*list[idx]));
     }
     remove(startIdx + 1);   // TODO: remove from startIdx to curIdx only
+    m_memoryUsage += startMacro->memoryUsage();
 }
 
 //---------------------------------------------------------
@@ -461,16 +676,22 @@ void UndoStack::endMacro(bool rollback)
     } else {
         // remove redo stack
         while (list.size() > curIdx) {
-            UndoCommand* cmd = mu::takeLast(list);
+            UndoMacro* cmd = mu::takeLast(list);
             stateList.pop_back();
-            cmd->cleanup(false);        // delete elements for which UndoCommand() holds ownership
-            delete cmd;
+            m_absoluteIdxList.pop_back();
+            deleteMacro(cmd, false);
         }
+        m_absoluteIdxList.push_back(getCurIdx());
         list.push_back(curCmd);
         stateList.push_back(nextState++);
         ++curIdx;
+        m_memoryUsage += curCmd->memoryUsage();
     }
     curCmd = 0;
+
+    if (!rollback) {
+        applyMemoryLimit();
+    }
 }
 
 //---------------------------------------------------------
@@ -489,6 +710,8 @@ void UndoStack::reopen()
     --curIdx;
     curCmd = mu::takeAt(list, curIdx);
     stateList.erase(stateList.begin() + curIdx);
+    m_absoluteIdxList.erase(m_absoluteIdxList.begin() + curIdx);
+    m_memoryUsage -= std::min(m_memoryUsage, curCmd->memoryUsage());
     for (auto i : curCmd->commands()) {
         LOG_UNDO() << "   " << i->name();
     }
@@ -504,7 +727,7 @@ void UndoStack::undo(EditData* ed)
     // Are we currently editing text?
     if (ed && ed->element && ed->element->isTextBase()) {
         TextEditData* ted = static_cast<TextEditData*>(ed->getData(ed->element).get());
-        if (ted && ted->startUndoIdx == curIdx) {
+        if (ted && ted->startUndoIdx == getCurIdx()) {
             // No edits to undo, so do nothing
             return;
         }
@@ -643,6 +866,24 @@ const UndoMacro::SelectionInfo& UndoMacro::redoSelectionInfo() const
     return m_redoSelectionInfo;
 }
 
+size_t UndoMacro::memoryUsage() const
+{
+    size_t result = UndoCommand::memoryUsage() - sizeof(UndoCommand) + sizeof(UndoMacro);
+    result += m_undoSelectionInfo.elements.capacity() * sizeof(EngravingItem*);
+    result += m_redoSelectionInfo.elements.capacity() * sizeof(EngravingItem*);
+    return result;
+}
+
+void UndoMacro::compact()
+{
+    removeRepeatedPropertyChanges();
+
+    m_undoSelectionInfo.elements.shrink_to_fit();
+    m_redoSelectionInfo.elements.shrink_to_fit();
+
+    m_compacted = true;
+}
+
 UndoMacro::ChangesInfo UndoMacro::changesInfo() const
 {
     ChangesInfo result;
@@ -650,7 +891,9 @@ UndoMacro::ChangesInfo UndoMacro::changesInfo() const
     for (const UndoCommand* command : commands()) {
         CommandType type = command->type();
 
-        if (type == CommandType::ChangeProperty) {
+        if (type == CommandType::ChangeProperty
+            || type == CommandType::ChangeBracketProperty
+            || type == CommandType::ChangeTextLineProperty) {
             auto changeProperty = static_cast<const ChangeProperty*>(command);
             result.changedPropertyIdSet.insert(changeProperty->getId());
         } else if (type == CommandType::ChangeStyleVal) {
@@ -1080,6 +1323,16 @@ const char* RemoveElement::name() const
     return buffer;
 }
 
+//---------------------------------------------------------
+//   RemoveElement::memoryUsage
+///   While applied, the command owns the removed element
+//---------------------------------------------------------
+
+size_t RemoveElement::memoryUsage() const
+{
+    return UndoCommand::memoryUsage() - sizeof(UndoCommand) + sizeof(RemoveElement) + treeMemoryUsage(element);
+}
+
 //---------------------------------------------------------
 //   RemoveElement::isFiltered
 //---------------------------------------------------------
@@ -1158,6 +1411,20 @@ void RemovePart::cleanup(bool undo)
     }
 }
 
+//---------------------------------------------------------
+//   RemovePart::memoryUsage
+///   While applied, the command owns the removed part
+//---------------------------------------------------------
+
+size_t RemovePart::memoryUsage() const
+{
+    size_t result = UndoCommand::memoryUsage() - sizeof(UndoCommand) + sizeof(RemovePart);
+    if (m_part) {
+        result += sizeof(Part) + m_part->nstaves() * sizeof(Staff) + m_part->instruments().size() * sizeof(Instrument);
+    }
+    return result;
+}
+
 //---------------------------------------------------------
 //   SetSoloist
 //---------------------------------------------------------
@@ -2515,6 +2782,11 @@ std::vector<const EngravingObject*> ChangeProperty::objectItems() const
     return compoundObjects(element);
 }
 
+size_t ChangeProperty::memoryUsage() const
+{
+    return UndoCommand::memoryUsage() - sizeof(UndoCommand) + sizeof(ChangeProperty) + propertyMemoryUsage(property);
+}
+
 //---------------------------------------------------------
 //   ChangeBracketProperty::flip
 //---------------------------------------------------------
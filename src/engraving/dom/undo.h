@@ -106,6 +106,7 @@ class UndoCommand
 protected:
     virtual void flip(EditData*) {}
     void appendChildren(UndoCommand*);
+    bool removeRepeatedPropertyChanges();
 
 public:
     enum class Filter {
@@ -128,6 +129,11 @@ public:
     const std::list<UndoCommand*>& commands() const { return childList; }
     virtual std::vector<const EngravingObject*> objectItems() const { return {}; }
     virtual void cleanup(bool undo);
+
+    //! NOTE Approximate number of bytes this command and its children keep alive,
+    //! used to keep the undo history within its memory budget. Commands that own
+    //! elements or heap allocated values add them in their overrides
+    virtual size_t memoryUsage() const;
 // #ifndef QT_NO_DEBUG
     virtual const char* name() const { return "UndoCommand"; }
 // #endif
@@ -179,6 +185,14 @@ public:
 
     ChangesInfo changesInfo() const;
 
+    size_t memoryUsage() const override;
+
+    //! NOTE Merges repeated property changes of the same element, keeping only the
+    //! first one, which holds the value from before the macro. Only valid for a macro
+    //! that is currently applied (i.e. not undone) and consists of property changes only
+    void compact();
+    bool isCompacted() const { return m_compacted; }
+
     static bool canRecordSelectedElement(const EngravingItem* e);
 
     UNDO_NAME("UndoMacro")
@@ -190,6 +204,7 @@ private:
     SelectionInfo m_redoSelectionInfo;
 
     Score* m_score = nullptr;
+    bool m_compacted = false;
 
     static void fillSelectionInfo(SelectionInfo&, const Selection&);
     static void applySelectionInfo(const SelectionInfo&, Selection&);
@@ -205,7 +220,15 @@ class UndoStack
     size_t curIdx = 0;
     bool isLocked = false;
 
+    size_t m_memoryLimit = 0;
+    size_t m_memoryUsage = 0;
+    size_t m_droppedCount = 0;
+    std::vector<size_t> m_absoluteIdxList;     // absolute index of every macro in the list, see getCurIdx()
+    size_t m_firstAbsoluteIdx = 0;
+
     void remove(size_t idx);
+    void deleteMacro(UndoMacro* macro, bool undo);
+    void applyMemoryLimit();
 
 public:
     UndoStack();
@@ -222,7 +245,10 @@ public:
     bool canUndo() const { return curIdx > 0; }
     bool canRedo() const { return curIdx < list.size(); }
     bool isClean() const { return cleanState == stateList[curIdx]; }
-    size_t getCurIdx() const { return curIdx; }
+
+    //! NOTE The index is absolute: it doesn't change when the memory limit
+    //! drops or merges macros below it, see mergeCommands()
+    size_t getCurIdx() const { return curIdx > 0 ? m_absoluteIdxList[curIdx - 1] + 1 : m_firstAbsoluteIdx; }
     UndoMacro* current() const { return curCmd; }
     UndoMacro* last() const { return curIdx > 0 ? list[curIdx - 1] : 0; }
     UndoMacro* prev() const { return curIdx > 1 ? list[curIdx - 2] : 0; }
@@ -232,6 +258,12 @@ public:
 
     void mergeCommands(size_t startIdx);
     void cleanRedoStack() { remove(curIdx); }
+
+    //! NOTE 0 means unlimited. When the limit is exceeded, the oldest macros
+    //! are compacted first and then dropped; the latest macro is always kept
+    size_t memoryLimit() const { return m_memoryLimit; }
+    void setMemoryLimit(size_t bytes);
+    size_t memoryUsage() const { return m_memoryUsage; }
 };
 
 class InsertPart : public UndoCommand
@@ -265,6 +297,8 @@ public:
     void redo(EditData*) override;
     void cleanup(bool) override;
 
+    size_t memoryUsage() const override;
+
     UNDO_TYPE(CommandType::RemovePart)
     UNDO_NAME("RemovePart")
     UNDO_CHANGED_OBJECTS({ m_part })
@@ -642,6 +676,8 @@ public:
 
     bool isFiltered(UndoCommand::Filter f, const EngravingItem* target) const override;
 
+    size_t memoryUsage() const override;
+
     UNDO_TYPE(CommandType::RemoveElement)
     UNDO_CHANGED_OBJECTS({ element })
 };
@@ -1109,6 +1145,7 @@ public:
     UNDO_NAME("ChangeProperty")
 
     std::vector<const EngravingObject*> objectItems() const override;
+    size_t memoryUsage() const override;
 
     bool isFiltered(UndoCommand::Filter f, const EngravingItem* target) const override
     {
@@ -1128,6 +1165,8 @@ class ChangeBracketProperty : public ChangeProperty
 public:
     ChangeBracketProperty(Staff* s, size_t l, Pid i, const PropertyValue& v, PropertyFlags ps = PropertyFlags::NOSTYLE)
         : ChangeProperty(nullptr, i, v, ps), staff(s), level(l) {}
+
+    UNDO_TYPE(CommandType::ChangeBracketProperty)
     UNDO_NAME("ChangeBracketProperty")
     UNDO_CHANGED_OBJECTS({ staff })
 };
@@ -1141,6 +1180,8 @@ class ChangeTextLineProperty : public ChangeProperty
 public:
     ChangeTextLineProperty(EngravingObject* e, PropertyValue v)
         : ChangeProperty(e, Pid::SYSTEM_FLAG, v, PropertyFlags::NOSTYLE) {}
+
+    UNDO_TYPE(CommandType::ChangeTextLineProperty)
     UNDO_NAME("ChangeTextLineProperty")
 };
 
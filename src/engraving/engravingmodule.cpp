@@ -41,6 +41,7 @@
 
 #include "engraving/dom/mscore.h"
 #include "engraving/dom/masterscore.h"
+#include "engraving/dom/textlayoutcache.h"
 
 #include "rendering/dev/scorerenderer.h"
 #include "rendering/stable/scorerenderer.h"
@@ -177,6 +178,9 @@ void EngravingModule::onInit(const framework::IApplication::RunMode& mode)
         fontProvider->insertSubstitution(u"Finale Maestro Text", u"Leland Text");
         fontProvider->insertSubstitution(u"Finale Broadway Text", u"MuseJazz Text");
         fontProvider->insertSubstitution(u"ScoreFont",      u"Leland Text");// alias for current Musical Text Font
+
+        //! NOTE The text measurements depend on the available fonts
+        TextLayoutCache::instance()->clear();
     }
 
     m_configuration->init();
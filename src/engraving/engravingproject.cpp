@@ -58,18 +58,15 @@ std::shared_ptr<EngravingProject> EngravingProject::create(const MStyle& style)
 
 EngravingProject::EngravingProject()
 {
-    ObjectAllocator::used();
 }
 
 EngravingProject::~EngravingProject()
 {
     delete m_masterScore;
 
-    ObjectAllocator::unused();
-
-    AllocatorsRegister::instance()->printStatistic("=== Destroy engraving project ===");
-    //! NOTE At the moment, the allocator is working as leak detector. No need to do cleanup, at the moment it can lead to crashes
-    // AllocatorsRegister::instance()->cleanupAll("engraving");
+    if (ObjectAllocator::enabled()) {
+        AllocatorsRegister::instance()->printStatistic("=== Destroy engraving project ===");
+    }
 }
 
 void EngravingProject::init(const MStyle& style)
@@ -93,6 +93,10 @@ public:
 
     virtual bool isAccessibleEnabled() const = 0;
 
+    //! NOTE In bytes, 0 means unlimited
+    virtual size_t undoHistoryMemoryLimit() const = 0;
+    virtual async::Notification undoHistoryMemoryLimitChanged() const = 0;
+
     /// these configurations will be removed after solving https://github.com/musescore/MuseScore/issues/14294
     virtual bool guitarProImportExperimental() const = 0;
     virtual bool negativeFretsAllowed() const = 0;
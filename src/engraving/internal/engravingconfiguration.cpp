@@ -44,6 +44,8 @@ static const Settings::Key PART_STYLE_FILE_PATH("engraving", "engraving/style/pa
 
 static const Settings::Key INVERT_SCORE_COLOR("engraving", "engraving/scoreColorInversion");
 
+static const Settings::Key UNDO_HISTORY_MEMORY_LIMIT_MB("engraving", "engraving/undoHistory/memoryLimitMb");
+
 struct VoiceColorKey {
     Settings::Key key;
     Color color;
@@ -60,6 +62,13 @@ void EngravingConfiguration::init()
         "#C31989"
     };
 
+    settings()->setDefaultValue(UNDO_HISTORY_MEMORY_LIMIT_MB, Val(512));
+    settings()->setDescription(UNDO_HISTORY_MEMORY_LIMIT_MB, qtrc("engraving", "Undo history memory limit (MB), 0 for unlimited").toStdString());
+    settings()->setCanBeManuallyEdited(UNDO_HISTORY_MEMORY_LIMIT_MB, true, Val(0), Val(16384));
+    settings()->valueChanged(UNDO_HISTORY_MEMORY_LIMIT_MB).onReceive(this, [this](const Val&) {
+        m_undoHistoryMemoryLimitChanged.notify();
+    });
+
     settings()->setDefaultValue(INVERT_SCORE_COLOR, Val(false));
     settings()->valueChanged(INVERT_SCORE_COLOR).onReceive(nullptr, [this](const Val&) {
         m_scoreInversionChanged.notify();
@@ -283,6 +292,17 @@ bool EngravingConfiguration::isAccessibleEnabled() const
     return accessibilityConfiguration() ? accessibilityConfiguration()->enabled() : false;
 }
 
+size_t EngravingConfiguration::undoHistoryMemoryLimit() const
+{
+    int limitMb = settings()->value(UNDO_HISTORY_MEMORY_LIMIT_MB).toInt();
+    return limitMb > 0 ? static_cast<size_t>(limitMb) * 1024 * 1024 : 0;
+}
+
+mu::async::Notification EngravingConfiguration::undoHistoryMemoryLimitChanged() const
+{
+    return m_undoHistoryMemoryLimitChanged;
+}
+
 bool EngravingConfiguration::guitarProImportExperimental() const
 {
     return guitarProConfiguration() ? guitarProConfiguration()->experimental() : false;
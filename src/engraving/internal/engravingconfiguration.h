@@ -89,6 +89,9 @@ public:
 
     bool isAccessibleEnabled() const override;
 
+    size_t undoHistoryMemoryLimit() const override;
+    async::Notification undoHistoryMemoryLimitChanged() const override;
+
     bool guitarProImportExperimental() const override;
     bool negativeFretsAllowed() const override;
     bool tablatureParenthesesZIndexWorkaround() const override;
@@ -101,6 +104,7 @@ public:
 private:
     async::Channel<voice_idx_t, draw::Color> m_voiceColorChanged;
     async::Notification m_scoreInversionChanged;
+    async::Notification m_undoHistoryMemoryLimitChanged;
 
     ValNt<DebuggingOptions> m_debuggingOptions;
 
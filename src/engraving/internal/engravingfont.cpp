@@ -29,6 +29,7 @@
 
 #include "dom/mscore.h"
 #include "dom/shape.h"
+#include "dom/textlayoutcache.h"
 
 #include "smufl.h"
 
@@ -99,6 +100,9 @@ void EngravingFont::ensureLoad()
         return;
     }
 
+    //! NOTE Texts in this family may have been measured with a fallback font before
+    TextLayoutCache::instance()->clear();
+
     m_font.setWeight(mu::draw::Font::Normal);
     m_font.setItalic(false);
     m_font.setFamily(String::fromStdString(m_family), Font::Type::MusicSymbol);
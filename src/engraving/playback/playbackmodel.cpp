@@ -22,6 +22,8 @@
 
 #include "playbackmodel.h"
 
+#include <chrono>
+
 #include "dom/fret.h"
 #include "dom/instrument.h"
 #include "dom/masterscore.h"
@@ -33,6 +35,8 @@
 #include "dom/segment.h"
 #include "dom/tempo.h"
 
+#include "concurrency/taskscheduler.h"
+
 #include "log.h"
 
 using namespace mu;
@@ -63,6 +67,7 @@ void PlaybackModel::load(Score* score)
     }
 
     m_score = score;
+    m_curvesPools.clear();
 
     auto changesChannel = score->changesChannel();
     changesChannel.resetOnReceive(this);
@@ -87,7 +92,15 @@ void PlaybackModel::load(Score* score)
         notifyAboutChanges(oldTracks, trackChanges);
     });
 
-    update(0, m_score->lastMeasure()->endTick().ticks(), 0, m_score->ntracks());
+    {
+        TRACEFUNC_C("PlaybackModel full load");
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        update(0, m_score->lastMeasure()->endTick().ticks(), 0, m_score->ntracks());
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+        LOGI() << "full playback model load: " << elapsed.count() << " ms, tracks: " << m_playbackDataMap.size();
+    }
 
     for (const auto& pair : m_playbackDataMap) {
         m_trackAdded.send(pair.first);
@@ -113,6 +126,8 @@ void PlaybackModel::reload()
         pair.second.originEvents.clear();
     }
 
+    m_curvesPools.clear();
+
     update(tickFrom, tickTo, trackFrom, trackTo);
 
     for (auto& pair : m_playbackDataMap) {
@@ -321,8 +336,94 @@ void PlaybackModel::updateContext(const InstrumentTrackId& trackId)
     trackData.dynamicLevelMap = ctx.dynamicLevelMap(m_score);
 }
 
+std::vector<PlaybackModel::PartRenderJob> PlaybackModel::prepareRenderJobs(const std::set<staff_idx_t>& staffIdxSet)
+{
+    std::vector<PartRenderJob> result;
+
+    auto resolveTarget = [this](const InstrumentTrackId& trackId, bool withContext, PartRenderJob& job) {
+        auto dataIt = m_playbackDataMap.find(trackId);
+        if (dataIt == m_playbackDataMap.end()) {
+            return;
+        }
+
+        TrackRenderTarget& target = job.targets[trackId];
+        target.events = &dataIt->second.originEvents;
+        target.profile = defaultActiculationProfile(trackId);
+
+        if (withContext) {
+            target.ctx = &m_playbackCtxMap[trackId];
+        }
+    };
+
+    for (const Part* part : m_score->parts()) {
+        PartRenderJob job;
+
+        for (const Staff* staff : part->staves()) {
+            if (mu::contains(staffIdxSet, staff->idx())) {
+                job.staffIdxSet.insert(staff->idx());
+            }
+        }
+
+        if (job.staffIdxSet.empty()) {
+            continue;
+        }
+
+        for (const InstrumentTrackId& trackId : part->instrumentTrackIdSet()) {
+            resolveTarget(trackId, true, job);
+        }
+
+        resolveTarget(chordSymbolsTrackId(part->id()), false, job);
+
+        job.curvesPool = &m_curvesPools[part->id()];
+
+        result.push_back(std::move(job));
+    }
+
+    return result;
+}
+
+void PlaybackModel::renderPartEvents(const RepeatList& repeats, const int tickFrom, const int tickTo, PartRenderJob& job) const
+{
+    for (const RepeatSegment* repeatSegment : repeats) {
+        int tickPositionOffset = repeatSegment->utick - repeatSegment->tick;
+        int repeatStartTick = repeatSegment->tick;
+        int repeatEndTick = repeatStartTick + repeatSegment->len();
+
+        if (repeatStartTick > tickTo || repeatEndTick <= tickFrom) {
+            continue;
+        }
+
+        for (const Measure* measure : repeatSegment->measureList()) {
+            int measureStartTick = measure->tick().ticks();
+            int measureEndTick = measure->endTick().ticks();
+
+            if (measureStartTick > tickTo || measureEndTick <= tickFrom) {
+                continue;
+            }
+
+            bool isFirstSegmentOfMeasure = true;
+
+            for (const Segment* segment = measure->first(); segment; segment = segment->next()) {
+                if (!segment->isChordRestType()) {
+                    continue;
+                }
+
+                int segmentStartTick = segment->tick().ticks();
+                int segmentEndTick = segmentStartTick + segment->ticks().ticks();
+
+                if (segmentStartTick > tickTo || segmentEndTick <= tickFrom) {
+                    continue;
+                }
+
+                processSegment(tickPositionOffset, segment, job.staffIdxSet, isFirstSegmentOfMeasure, job);
+                isFirstSegmentOfMeasure = false;
+            }
+        }
+    }
+}
+
 void PlaybackModel::processSegment(const int tickPositionOffset, const Segment* segment, const std::set<staff_idx_t>& staffIdxSet,
-                                   bool isFirstSegmentOfMeasure, ChangedTrackIdSet* trackChanges)
+                                   bool isFirstSegmentOfMeasure, PartRenderJob& job) const
 {
     int segmentStartTick = segment->tick().ticks();
 
@@ -343,18 +444,20 @@ void PlaybackModel::processSegment(const int tickPositionOffset, const Segment*
 
         InstrumentTrackId trackId = chordSymbolsTrackId(item->part()->id());
 
-        ArticulationsProfilePtr profile = defaultActiculationProfile(trackId);
-        if (!profile) {
+        auto targetIt = job.targets.find(trackId);
+        if (targetIt == job.targets.cend() || !targetIt->second.profile) {
             LOGE() << "unsupported instrument family: " << item->part()->id();
             continue;
         }
 
+        const TrackRenderTarget& target = targetIt->second;
+
         if (chordSymbol->play()) {
-            m_renderer.renderChordSymbol(chordSymbol, tickPositionOffset, profile,
-                                         m_playbackDataMap[trackId].originEvents);
+            m_renderer.renderChordSymbol(chordSymbol, tickPositionOffset, target.profile, job.renderedEvents);
+            moveRenderedEvents(job, *target.events);
         }
 
-        collectChangesTracks(trackId, trackChanges);
+        job.trackChanges.insert(trackId);
     }
 
     for (const EngravingItem* item : segment->elist()) {
@@ -378,7 +481,7 @@ void PlaybackModel::processSegment(const int tickPositionOffset, const Segment*
                 const MeasureRepeat* measureRepeat = toMeasureRepeat(item);
                 const Measure* currentMeasure = measureRepeat->measure();
 
-                processMeasureRepeat(tickPositionOffset, measureRepeat, currentMeasure, staffIdx, trackChanges);
+                processMeasureRepeat(tickPositionOffset, measureRepeat, currentMeasure, staffIdx, job);
 
                 continue;
             } else {
@@ -387,30 +490,48 @@ void PlaybackModel::processSegment(const int tickPositionOffset, const Segment*
                 if (currentMeasure->measureRepeatCount(staffIdx) > 0) {
                     const MeasureRepeat* measureRepeat = currentMeasure->measureRepeatElement(staffIdx);
 
-                    processMeasureRepeat(tickPositionOffset, measureRepeat, currentMeasure, staffIdx, trackChanges);
+                    processMeasureRepeat(tickPositionOffset, measureRepeat, currentMeasure, staffIdx, job);
                     continue;
                 }
             }
         }
 
-        const PlaybackContext& ctx = m_playbackCtxMap[trackId];
-
-        ArticulationsProfilePtr profile = defaultActiculationProfile(trackId);
-        if (!profile) {
+        auto targetIt = job.targets.find(trackId);
+        if (targetIt == job.targets.cend() || !targetIt->second.profile || !targetIt->second.ctx) {
             LOGE() << "unsupported instrument family: " << item->part()->id();
             continue;
         }
 
-        m_renderer.render(item, tickPositionOffset, ctx.appliableDynamicLevel(segmentStartTick + tickPositionOffset),
-                          ctx.persistentArticulationType(segmentStartTick + tickPositionOffset), std::move(profile),
-                          m_playbackDataMap[trackId].originEvents);
+        const TrackRenderTarget& target = targetIt->second;
 
-        collectChangesTracks(trackId, trackChanges);
+        m_renderer.render(item, tickPositionOffset, target.ctx->appliableDynamicLevel(segmentStartTick + tickPositionOffset),
+                          target.ctx->persistentArticulationType(segmentStartTick + tickPositionOffset), target.profile,
+                          job.renderedEvents);
+        moveRenderedEvents(job, *target.events);
+
+        job.trackChanges.insert(trackId);
     }
 }
 
+void PlaybackModel::moveRenderedEvents(PartRenderJob& job, mpe::PlaybackEventsMap& events) const
+{
+    for (auto& pair : job.renderedEvents) {
+        mpe::PlaybackEventList& list = events[pair.first];
+
+        for (mpe::PlaybackEvent& event : pair.second) {
+            if (std::holds_alternative<mpe::NoteEvent>(event)) {
+                std::get<mpe::NoteEvent>(event).internCurves(*job.curvesPool);
+            }
+
+            list.push_back(std::move(event));
+        }
+    }
+
+    job.renderedEvents.clear();
+}
+
 void PlaybackModel::processMeasureRepeat(const int tickPositionOffset, const MeasureRepeat* measureRepeat, const Measure* currentMeasure,
-                                         const staff_idx_t staffIdx, ChangedTrackIdSet* trackChanges)
+                                         const staff_idx_t staffIdx, PartRenderJob& job) const
 {
     if (!measureRepeat || !currentMeasure) {
         return;
@@ -436,7 +557,7 @@ void PlaybackModel::processMeasureRepeat(const int tickPositionOffset, const Mea
             continue;
         }
 
-        processSegment(tickPositionOffset + repeatPositionTickOffset, seg, { staffIdx }, isFirstSegmentOfRepeatedMeasure, trackChanges);
+        processSegment(tickPositionOffset + repeatPositionTickOffset, seg, { staffIdx }, isFirstSegmentOfRepeatedMeasure, job);
         isFirstSegmentOfRepeatedMeasure = false;
     }
 }
@@ -450,7 +571,26 @@ void PlaybackModel::updateEvents(const int tickFrom, const int tickTo, const tra
         return staff.isPrimaryStaff(); // skip linked staves
     });
 
-    for (const RepeatSegment* repeatSegment : repeatList()) {
+    //! NOTE Everything that is lazily created on first access (the repeat list, the spanner lookup tree,
+    //! map entries, articulation profiles) must be resolved here, before the parts are rendered concurrently
+    const RepeatList& repeats = repeatList();
+    m_score->spannerMap().updateIfDirty();
+    std::vector<PartRenderJob> jobs = prepareRenderJobs(staffToProcessIdxSet);
+
+    TaskScheduler::instance()->parallelFor(0, jobs.size(), [this, &repeats, &jobs, tickFrom, tickTo](size_t idx) {
+        renderPartEvents(repeats, tickFrom, tickTo, jobs[idx]);
+    });
+
+    //! NOTE Merged in the score order of the parts, so the result doesn't depend on the scheduling
+    for (const PartRenderJob& job : jobs) {
+        for (const InstrumentTrackId& trackId : job.trackChanges) {
+            collectChangesTracks(trackId, trackChanges);
+        }
+    }
+
+    PlaybackEventsMap& metronomeEvents = m_playbackDataMap[METRONOME_TRACK_ID].originEvents;
+
+    for (const RepeatSegment* repeatSegment : repeats) {
         int tickPositionOffset = repeatSegment->utick - repeatSegment->tick;
         int repeatStartTick = repeatSegment->tick;
         int repeatEndTick = repeatStartTick + repeatSegment->len();
@@ -467,26 +607,7 @@ void PlaybackModel::updateEvents(const int tickFrom, const int tickTo, const tra
                 continue;
             }
 
-            bool isFirstSegmentOfMeasure = true;
-
-            for (Segment* segment = measure->first(); segment; segment = segment->next()) {
-                if (!segment->isChordRestType()) {
-                    continue;
-                }
-
-                int segmentStartTick = segment->tick().ticks();
-                int segmentEndTick = segmentStartTick + segment->ticks().ticks();
-
-                if (segmentStartTick > tickTo || segmentEndTick <= tickFrom) {
-                    continue;
-                }
-
-                processSegment(tickPositionOffset, segment, staffToProcessIdxSet, isFirstSegmentOfMeasure, trackChanges);
-                isFirstSegmentOfMeasure = false;
-            }
-
-            m_renderer.renderMetronome(m_score, measureStartTick, measureEndTick, tickPositionOffset,
-                                       m_playbackDataMap[METRONOME_TRACK_ID].originEvents);
+            m_renderer.renderMetronome(m_score, measureStartTick, measureEndTick, tickPositionOffset, metronomeEvents);
             collectChangesTracks(METRONOME_TRACK_ID, trackChanges);
         }
     }
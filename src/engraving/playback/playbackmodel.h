@@ -25,6 +25,8 @@
 
 #include <unordered_map>
 #include <map>
+#include <set>
+#include <vector>
 #include <functional>
 
 #include "async/asyncable.h"
@@ -96,6 +98,26 @@ private:
         track_idx_t trackTo = mu::nidx;
     };
 
+    //! NOTE Everything a render job needs to write the events of one track,
+    //! resolved up front so that the jobs never touch the shared maps
+    struct TrackRenderTarget
+    {
+        const PlaybackContext* ctx = nullptr;
+        mpe::PlaybackEventsMap* events = nullptr;
+        mpe::ArticulationsProfilePtr profile;
+    };
+
+    //! NOTE The events of one part are rendered by exactly one job,
+    //! so no two jobs ever write into the same track or use the same curves pool
+    struct PartRenderJob
+    {
+        std::set<staff_idx_t> staffIdxSet;
+        std::unordered_map<InstrumentTrackId, TrackRenderTarget> targets;
+        ChangedTrackIdSet trackChanges;
+        mpe::NoteCurvesPool* curvesPool = nullptr;
+        mpe::PlaybackEventsMap renderedEvents;
+    };
+
     InstrumentTrackId idKey(const EngravingItem* item) const;
     InstrumentTrackId idKey(const std::vector<const EngravingItem*>& items) const;
     InstrumentTrackId idKey(const ID& partId, const std::string& instrumentId) const;
@@ -108,10 +130,14 @@ private:
     void updateEvents(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo,
                       ChangedTrackIdSet* trackChanges = nullptr);
 
+    std::vector<PartRenderJob> prepareRenderJobs(const std::set<staff_idx_t>& staffIdxSet);
+    void renderPartEvents(const RepeatList& repeats, const int tickFrom, const int tickTo, PartRenderJob& job) const;
+
     void processSegment(const int tickPositionOffset, const Segment* segment, const std::set<staff_idx_t>& staffIdxSet,
-                        bool isFirstSegmentOfMeasure, ChangedTrackIdSet* trackChanges);
+                        bool isFirstSegmentOfMeasure, PartRenderJob& job) const;
+    void moveRenderedEvents(PartRenderJob& job, mpe::PlaybackEventsMap& events) const;
     void processMeasureRepeat(const int tickPositionOffset, const MeasureRepeat* measureRepeat, const Measure* currentMeasure,
-                              const staff_idx_t staffIdx, ChangedTrackIdSet* trackChanges);
+                              const staff_idx_t staffIdx, PartRenderJob& job) const;
 
     bool hasToReloadTracks(const ScoreChangesRange& changesRange) const;
     bool hasToReloadScore(const std::unordered_set<ElementType>& changedTypes) const;
@@ -146,6 +172,7 @@ private:
 
     std::unordered_map<InstrumentTrackId, PlaybackContext> m_playbackCtxMap;
     std::unordered_map<InstrumentTrackId, mpe::PlaybackData> m_playbackDataMap;
+    std::map<ID, mpe::NoteCurvesPool> m_curvesPools;
 
     async::Notification m_dataChanged;
     async::Channel<InstrumentTrackId> m_trackAdded;
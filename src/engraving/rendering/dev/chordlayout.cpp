@@ -1060,6 +1060,7 @@ void ChordLayout::layoutArticulations2(Chord* item, LayoutContext& ctx, bool lay
             //r.setWidth(w);
             if (!ctx.conf().isLineMode()) {
                 s->staffShape(item->staffIdx()).add(sh);
+                s->shapesChanged();
             }
             sh.translate(s->pos() + m->pos());
             m->system()->staff(item->vStaffIdx())->skyline().add(sh);
@@ -1104,6 +1105,7 @@ void ChordLayout::layoutArticulations3(Chord* item, Slur* slur, LayoutContext& c
                 if (sstaff && aa->addToSkyline()) {
                     sstaff->skyline().add(aaShape);
                     s->staffShape(item->staffIdx()).add(aaShape);
+                    s->shapesChanged();
                 }
             }
         }
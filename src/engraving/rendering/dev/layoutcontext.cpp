@@ -24,6 +24,7 @@
 #include "style/defaultstyle.h"
 
 #include "dom/mscoreview.h"
+#include "dom/page.h"
 #include "dom/score.h"
 #include "dom/spanner.h"
 
@@ -365,6 +366,24 @@ const std::set<Spanner*>& DomAccessor::unmanagedSpanners() const
     return score()->unmanagedSpanners();
 }
 
+// =============================================================
+// LayoutState
+// =============================================================
+
+void LayoutState::addChangedPage(const Page* page)
+{
+    m_changedRegion.unite(page->layoutData()->bbox(LD_ACCESS::MAYBE_NOTINITED).translated(page->pos()));
+}
+
+MeasureSpacingTable& LayoutState::spacingTable(Measure* m)
+{
+    MeasureSpacingTable& table = m_spacingTables[m];
+    if (!table.isValid(m)) {
+        table.reset(m);
+    }
+    return table;
+}
+
 // =============================================================
 // LayoutContext
 // =============================================================
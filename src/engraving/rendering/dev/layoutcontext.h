@@ -24,6 +24,7 @@
 
 #include <vector>
 #include <set>
+#include <unordered_map>
 
 #include "types/fraction.h"
 #include "types/types.h"
@@ -33,6 +34,7 @@
 #include "dom/mscore.h"
 
 #include "../layoutoptions.h"
+#include "spacingtable.h"
 
 namespace mu::engraving {
 class EngravingItem;
@@ -213,6 +215,8 @@ public:
 
     double totalBracketsWidth() const { return m_totalBracketsWidth; }
 
+    const mu::RectF& changedRegion() const { return m_changedRegion; }
+
     // Mutable
     void setFirstSystem(bool val) { m_firstSystem = val; }
     void setFirstSystemIndent(bool val) { m_firstSystemIndent = val; }
@@ -249,6 +253,11 @@ public:
 
     void setTotalBracketsWidth(double val) { m_totalBracketsWidth = val; }
 
+    void addChangedPage(const Page* page);
+
+    MeasureSpacingTable& spacingTable(Measure* m);
+    void clearSpacingTables() { m_spacingTables.clear(); }
+
 private:
 
     bool m_firstSystem = true;
@@ -277,6 +286,10 @@ private:
 
     bool m_rangeDone = false;
 
+    mu::RectF m_changedRegion;              // canvas area of the pages laid out, as they were and as they are
+
+    std::unordered_map<const Measure*, MeasureSpacingTable> m_spacingTables;  // of the system being collected
+
     // cache
     double m_totalBracketsWidth = -1.0;
 };
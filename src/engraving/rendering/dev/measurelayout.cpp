@@ -2077,31 +2077,9 @@ void MeasureLayout::computeWidth(Measure* m, LayoutContext& ctx, Fraction minTic
         m->setWidth(0.0);
         return;
     }
-    double x;
-    bool first = m->isFirstInSystem();
-
-    // left barriere:
-    //    Make sure no elements crosses the left boarder if first measure in a system.
-    //
-    Shape ls(first ? RectF(0.0, -1000000.0, 0.0, 2000000.0) : RectF(0.0, 0.0, 0.0, m->spatium() * 4));
-
-    x = s->minLeft(ls);
-
-    if (s->isStartRepeatBarLineType()) {
-        System* sys = m->system();
-        MeasureBase* pmb = m->prev();
-        if (pmb && pmb->isMeasure() && pmb->system() == sys && pmb->repeatEnd()) {
-            Segment* seg = toMeasure(pmb)->last();
-            // overlap end repeat barline with start repeat barline
-            if (seg->isEndBarLineType()) {
-                x -= ctx.conf().styleMM(Sid::endBarWidth) * m->mag();
-            }
-        }
-    }
-
     ChordLayout::updateGraceNotes(m, ctx);
 
-    x = m->computeFirstSegmentXPosition(s);
+    double x = m->computeFirstSegmentXPosition(s);
     bool isSystemHeader = s->header();
 
     m->setSqueezableSpace(0.0);
@@ -2126,8 +2104,9 @@ void MeasureLayout::computeWidth(Measure* m, LayoutContext& ctx, Segment* s, dou
     if (!fs->visible()) {           // first enabled could be a clef change on invisible staff
         fs = fs->nextActive();
     }
-    bool first  = m->isFirstInSystem();
-    const Shape ls(first ? RectF(0.0, -1000000.0, 0.0, 2000000.0) : RectF(0.0, 0.0, 0.0, m->spatium() * 4));
+
+    // the distances between the segments, kept while the system is collected
+    MeasureSpacingTable& table = ctx.mutState().spacingTable(m);
 
     static constexpr double spacingMultiplier = 1.2;
     double minNoteSpace = ctx.conf().noteHeadWidth() + spacingMultiplier * ctx.conf().styleMM(Sid::minNoteDistance);
@@ -2167,17 +2146,17 @@ void MeasureLayout::computeWidth(Measure* m, LayoutContext& ctx, Segment* s, dou
                 w = s->minHorizontalDistance(ns, true);
                 isSystemHeader = false;
             } else {
-                w = s->minHorizontalDistance(ns, false);
+                w = table.minHorizontalDistance(s, ns);
                 if (s->isChordRestType()) {
                     Segment* ps = s->prevActive();
-                    double durStretch = s->computeDurationStretch(ps, minTicks, maxTicks);
+                    double durStretch = table.durationStretch(s, ps, minTicks, maxTicks);
                     s->setStretch(durStretch * usrStretch);
                     // durStretch := spacing factor purely determined by the duration of the note.
                     // usrStretch := spacing factor determined by user settings.
                     // stretchCoeff := spacing factor used internally for computations
                     double minStretchedWidth = minNoteSpace * durStretch * usrStretch * stretchCoeff;
                     double squeezableSpace = m->squeezableSpace();
-                    squeezableSpace += s->shortestChordRest() == s->ticks() ? minStretchedWidth - w : 0.0;
+                    squeezableSpace += table.shortestChordRest(s) == s->ticks() ? minStretchedWidth - w : 0.0;
                     m->setSqueezableSpace(squeezableSpace);
                     w = std::max(w, minStretchedWidth);
                 }
@@ -2204,9 +2183,9 @@ void MeasureLayout::computeWidth(Measure* m, LayoutContext& ctx, Segment* s, dou
             }
 
             // look back for collisions with previous segments
-            // this is time consuming (ca. +5%) and probably requires more optimization
+            // this is time consuming (ca. +5%), the distances are only computed once per system
             if (s == fs) {     // don't let the second segment cross measure start (not covered by the loop below)
-                w = std::max(w, ns->minLeft(ls) - s->x());
+                w = std::max(w, table.minLeft(ns) - s->x());
             }
 
             int n = 1;
@@ -2219,9 +2198,9 @@ void MeasureLayout::computeWidth(Measure* m, LayoutContext& ctx, Segment* s, dou
                     continue;
                 }
 
-                double ww = ps->minHorizontalCollidingDistance(ns) - (s->x() - ps->x());
+                double ww = table.minHorizontalCollidingDistance(ps, ns) - (s->x() - ps->x());
                 if (ps == fs) {
-                    ww = std::max(ww, ns->minLeft(ls) - s->x());
+                    ww = std::max(ww, table.minLeft(ns) - s->x());
                 }
 
                 if (ww > w) {
@@ -2258,7 +2237,7 @@ void MeasureLayout::computeWidth(Measure* m, LayoutContext& ctx, Segment* s, dou
             extraLeadingSpace = std::max(extraLeadingSpace, -w);
             w += extraLeadingSpace;
         } else {
-            w = s->minRight();
+            w = table.minRight(s);
         }
         s->setWidth(w);
         x += w;
@@ -73,6 +73,7 @@ void PageLayout::getNextPage(LayoutContext& ctx)
         ctx.mutState().setPageOldMeasure(nullptr);
     } else {
         ctx.mutState().setPage(ctx.mutDom().pages()[ctx.state().pageIdx()]);
+        ctx.mutState().addChangedPage(ctx.state().page());
         std::vector<System*>& systems = ctx.mutState().page()->systems();
         ctx.mutState().setPageOldMeasure(systems.empty() ? nullptr : systems.back()->measures().back());
         const system_idx_t i = mu::indexOf(systems, ctx.state().curSystem());
@@ -381,6 +382,7 @@ void PageLayout::collectPage(LayoutContext& ctx)
     }
 
     ctx.mutState().page()->invalidateBspTree();
+    ctx.mutState().addChangedPage(ctx.state().page());
 }
 
 //---------------------------------------------------------
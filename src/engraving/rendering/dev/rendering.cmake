@@ -45,6 +45,8 @@ set(RENDERING_DEV_SRC
     ${CMAKE_CURRENT_LIST_DIR}/arpeggiolayout.h
     ${CMAKE_CURRENT_LIST_DIR}/horizontalspacing.cpp
     ${CMAKE_CURRENT_LIST_DIR}/horizontalspacing.h
+    ${CMAKE_CURRENT_LIST_DIR}/spacingtable.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/spacingtable.h
     ${CMAKE_CURRENT_LIST_DIR}/autoplace.cpp
     ${CMAKE_CURRENT_LIST_DIR}/autoplace.h
 )
@@ -82,11 +82,14 @@ void ScoreLayout::layoutRange(Score* score, const Fraction& st, const Fraction&
 
     if (!score->last() || (ctx.conf().isLinearMode() && !score->firstMeasure())) {
         LOGD("empty score");
+        addChangedPages(ctx);
         DeleteAll(score->systems());
         score->systems().clear();
         DeleteAll(score->pages());
         score->pages().clear();
         PageLayout::getNextPage(ctx);
+        addChangedPages(ctx);
+        score->addLayoutRefresh(ctx.state().changedRegion());
         return;
     }
 
@@ -145,7 +148,10 @@ void ScoreLayout::layoutRange(Score* score, const Fraction& st, const Fraction&
         ctx.mutState().setPrevMeasure(nullptr);
         ctx.mutState().setNextMeasure(m);         //_showVBox ? first() : firstMeasure();
         ctx.mutState().setStartTick(m->tick());
+        addChangedPages(ctx);
         layoutLinear(ctx, isLayoutAll);
+        addChangedPages(ctx);
+        score->addLayoutRefresh(ctx.state().changedRegion());
         return;
     }
 
@@ -210,6 +216,7 @@ void ScoreLayout::layoutRange(Score* score, const Fraction& st, const Fraction&
         DeleteAll(score->systems());
         score->systems().clear();
 
+        addChangedPages(ctx);
         DeleteAll(score->pages());
         score->pages().clear();
 
@@ -222,6 +229,17 @@ void ScoreLayout::layoutRange(Score* score, const Fraction& st, const Fraction&
     ctx.mutState().setCurSystem(SystemLayout::collectSystem(ctx));
 
     doLayout(ctx);
+
+    score->addLayoutRefresh(ctx.state().changedRegion());
+}
+
+//! NOTE Only the pages collected or removed by the layout are added to the changed area,
+//! the others keep their content and position. All pages are added when they are recreated.
+void ScoreLayout::addChangedPages(LayoutContext& ctx)
+{
+    for (const Page* page : ctx.dom().pages()) {
+        ctx.mutState().addChangedPage(page);
+    }
 }
 
 void ScoreLayout::doLayout(LayoutContext& ctx)
@@ -256,6 +274,7 @@ void ScoreLayout::doLayout(LayoutContext& ctx)
         // ...and the remaining pages too
         while (ctx.dom().npages() > ctx.state().pageIdx()) {
             Page* p = ctx.mutDom().pages().back();
+            ctx.mutState().addChangedPage(p);
             ctx.mutDom().pages().pop_back();
             delete p;
         }
@@ -335,6 +354,7 @@ void ScoreLayout::collectLinearSystem(LayoutContext& ctx)
 
     System* system = ctx.mutDom().systems().front();
     SystemLayout::setInstrumentNames(system, ctx, /* longNames */ true);
+    ctx.mutState().clearSpacingTables();
 
     PointF pos;
     bool firstMeasure = true;       //lc.startTick.isZero();
@@ -42,6 +42,7 @@ private:
     static void collectLinearSystem(LayoutContext& ctx);
 
     static void doLayout(LayoutContext& ctx);
+    static void addChangedPages(LayoutContext& ctx);
 };
 }
 
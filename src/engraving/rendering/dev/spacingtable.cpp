@@ -0,0 +1,180 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "spacingtable.h"
+
+#include <cmath>
+#include <limits>
+
+#include "realfn.h"
+
+#include "dom/measure.h"
+#include "dom/segment.h"
+
+using namespace mu::engraving;
+using namespace mu::engraving::rendering::dev;
+
+static constexpr double NOT_COMPUTED = std::numeric_limits<double>::quiet_NaN();
+
+//---------------------------------------------------------
+//   isValid
+//    the segments and their shapes are the ones
+//    the table was made for
+//---------------------------------------------------------
+
+bool MeasureSpacingTable::isValid(const Measure* m) const
+{
+    if (m != m_measure || m->isFirstInSystem() != m_firstInSystem || !RealIsEqual(m->spatium(), m_spatium)) {
+        return false;
+    }
+
+    size_t idx = 0;
+    for (const Segment& s : m->segments()) {
+        if (idx >= m_segments.size()
+            || &s != m_segments[idx]
+            || s.shapesRevision() != m_shapesRevisions[idx]
+            || s.segmentType() != m_types[idx]
+            || s.trailer() != static_cast<bool>(m_trailers[idx])
+            || s.ticks() != m_ticks[idx]) {
+            return false;
+        }
+        ++idx;
+    }
+
+    return idx == m_segments.size();
+}
+
+//---------------------------------------------------------
+//   reset
+//---------------------------------------------------------
+
+void MeasureSpacingTable::reset(Measure* m)
+{
+    m_measure = m;
+    m_firstInSystem = m->isFirstInSystem();
+    m_spatium = m->spatium();
+    m_leftBarrier = Shape(m_firstInSystem ? RectF(0.0, -1000000.0, 0.0, 2000000.0) : RectF(0.0, 0.0, 0.0, m_spatium * 4));
+
+    m_segments.clear();
+    m_shapesRevisions.clear();
+    m_types.clear();
+    m_trailers.clear();
+    m_ticks.clear();
+    m_shortestChordRests.clear();
+    m_indexes.clear();
+
+    for (Segment& s : m->segments()) {
+        m_indexes.emplace(&s, m_segments.size());
+        m_segments.push_back(&s);
+        m_shapesRevisions.push_back(s.shapesRevision());
+        m_types.push_back(s.segmentType());
+        m_trailers.push_back(s.trailer());
+        m_ticks.push_back(s.ticks());
+        m_shortestChordRests.push_back(s.shortestChordRest());
+    }
+
+    const size_t count = m_segments.size();
+    m_minLefts.assign(count, NOT_COMPUTED);
+    m_minRights.assign(count, NOT_COMPUTED);
+    m_nextIndexes.assign(count, mu::nidx);
+    m_minDistances.assign(count, NOT_COMPUTED);
+    m_collidingDistances.assign(count * count, NOT_COMPUTED);
+}
+
+size_t MeasureSpacingTable::indexOf(const Segment* s) const
+{
+    auto it = m_indexes.find(s);
+    return it != m_indexes.end() ? it->second : mu::nidx;
+}
+
+Fraction MeasureSpacingTable::shortestChordRest(Segment* s) const
+{
+    size_t idx = indexOf(s);
+    return idx != mu::nidx ? m_shortestChordRests[idx] : s->shortestChordRest();
+}
+
+double MeasureSpacingTable::durationStretch(Segment* s, Segment* prevSeg, Fraction minTicks, Fraction maxTicks) const
+{
+    Fraction prevShortest = prevSeg ? shortestChordRest(prevSeg) : Fraction(0, 1);
+    return s->computeDurationStretch(prevSeg, shortestChordRest(s), prevShortest, minTicks, maxTicks);
+}
+
+//---------------------------------------------------------
+//   minLeft
+//    distance needed to the start of the measure
+//---------------------------------------------------------
+
+double MeasureSpacingTable::minLeft(Segment* s)
+{
+    size_t idx = indexOf(s);
+    if (idx == mu::nidx) {
+        return s->minLeft(m_leftBarrier);
+    }
+    if (std::isnan(m_minLefts[idx])) {
+        m_minLefts[idx] = s->minLeft(m_leftBarrier);
+    }
+    return m_minLefts[idx];
+}
+
+double MeasureSpacingTable::minRight(Segment* s)
+{
+    size_t idx = indexOf(s);
+    if (idx == mu::nidx) {
+        return s->minRight();
+    }
+    if (std::isnan(m_minRights[idx])) {
+        m_minRights[idx] = s->minRight();
+    }
+    return m_minRights[idx];
+}
+
+//---------------------------------------------------------
+//   minHorizontalDistance
+//    not for the system header gap
+//---------------------------------------------------------
+
+double MeasureSpacingTable::minHorizontalDistance(Segment* s, Segment* ns)
+{
+    size_t idx = indexOf(s);
+    size_t nextIdx = indexOf(ns);
+    if (idx == mu::nidx || nextIdx == mu::nidx) {
+        return s->minHorizontalDistance(ns, false);
+    }
+    if (m_nextIndexes[idx] != nextIdx) {
+        m_nextIndexes[idx] = nextIdx;
+        m_minDistances[idx] = s->minHorizontalDistance(ns, false);
+    }
+    return m_minDistances[idx];
+}
+
+double MeasureSpacingTable::minHorizontalCollidingDistance(Segment* s, Segment* ns)
+{
+    size_t idx = indexOf(s);
+    size_t nextIdx = indexOf(ns);
+    if (idx == mu::nidx || nextIdx == mu::nidx) {
+        return s->minHorizontalCollidingDistance(ns);
+    }
+    double& distance = m_collidingDistances[idx * m_segments.size() + nextIdx];
+    if (std::isnan(distance)) {
+        distance = s->minHorizontalCollidingDistance(ns);
+    }
+    return distance;
+}
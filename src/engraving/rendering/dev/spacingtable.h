@@ -0,0 +1,90 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_SPACINGTABLE_DEV_H
+#define MU_ENGRAVING_SPACINGTABLE_DEV_H
+
+#include <unordered_map>
+#include <vector>
+
+#include "types/fraction.h"
+#include "dom/types.h"
+
+#include "dom/shape.h"
+
+namespace mu::engraving {
+class Measure;
+class Segment;
+}
+
+namespace mu::engraving::rendering::dev {
+//---------------------------------------------------------
+//   MeasureSpacingTable
+//    the parts of the horizontal spacing of a measure which
+//    depend neither on the shortest and longest note of the
+//    system nor on the stretch, in flat arrays. The measures
+//    of a system are spaced again whenever its shortest or
+//    longest note changes; the distances between the segment
+//    shapes are then taken from here.
+//---------------------------------------------------------
+
+class MeasureSpacingTable
+{
+public:
+    bool isValid(const Measure* m) const;
+    void reset(Measure* m);
+
+    Fraction shortestChordRest(Segment* s) const;
+    double durationStretch(Segment* s, Segment* prevSeg, Fraction minTicks, Fraction maxTicks) const;
+
+    double minLeft(Segment* s);
+    double minRight(Segment* s);
+    double minHorizontalDistance(Segment* s, Segment* ns);
+    double minHorizontalCollidingDistance(Segment* s, Segment* ns);
+
+private:
+    size_t indexOf(const Segment* s) const;
+
+    const Measure* m_measure = nullptr;
+    bool m_firstInSystem = false;
+    double m_spatium = 0.0;
+    Shape m_leftBarrier;                            // nothing may cross the start of the measure
+
+    // per segment, in measure order
+    std::vector<Segment*> m_segments;
+    std::vector<size_t> m_shapesRevisions;
+    std::vector<SegmentType> m_types;
+    std::vector<char> m_trailers;
+    std::vector<Fraction> m_ticks;
+    std::vector<Fraction> m_shortestChordRests;
+    std::vector<double> m_minLefts;
+    std::vector<double> m_minRights;
+    std::vector<size_t> m_nextIndexes;              // segment of the minimum distance
+    std::vector<double> m_minDistances;
+
+    // per pair of segments, rows are the left ones
+    std::vector<double> m_collidingDistances;
+
+    std::unordered_map<const Segment*, size_t> m_indexes;
+};
+}
+
+#endif // MU_ENGRAVING_SPACINGTABLE_DEV_H
@@ -98,6 +98,8 @@ System* SystemLayout::collectSystem(LayoutContext& ctx)
     Fraction lcmTick = ctx.state().curMeasure()->tick();
     SystemLayout::setInstrumentNames(system, ctx, ctx.state().startWithLongNames(), lcmTick);
 
+    ctx.mutState().clearSpacingTables();
+
     double curSysWidth = 0.0;
     double layoutSystemMinWidth = 0.0;
     bool firstMeasure = true;
@@ -1270,6 +1272,12 @@ void SystemLayout::layoutSystemElements(System* system, LayoutContext& ctx)
             }
         }
     }
+
+    //! NOTE The skylines are complete here: merge the postponed rectangles once,
+    //! so that the const readers (page layout, selection, painting) don't work on copies
+    for (SysStaff* ss : system->staves()) {
+        ss->skyline().flush();
+    }
 }
 
 void SystemLayout::doLayoutTies(System* system, std::vector<Segment*> sl, const Fraction& stick, const Fraction& etick)
@@ -1597,6 +1605,7 @@ void SystemLayout::manageNarrowSpacing(System* system, LayoutContext& ctx, doubl
                     Shape& shape = segment.staffShape(staffIdx);
                     shape.setSqueezeFactor(squeezeFactor);
                 }
+                segment.shapesChanged();
             }
             MeasureLayout::computeWidth(m, ctx, minTicks, maxTicks, stretchCoeff,  /*overrideMinMeasureWidth*/ true);
 
@@ -2786,6 +2786,7 @@ void TLayout::layout(HairpinSegment* item, LayoutContext& ctx)
                         Measure* m = s->measure();
                         RectF r = sd->layoutData()->bbox().translated(sd->pos());
                         s->staffShape(sd->staffIdx()).add(r);
+                        s->shapesChanged();
                         r = sd->layoutData()->bbox().translated(sd->pos() + s->pos() + m->pos());
                         m->system()->staff(sd->staffIdx())->skyline().add(r);
                     }
@@ -2810,6 +2811,7 @@ void TLayout::layout(HairpinSegment* item, LayoutContext& ctx)
                         Measure* m = s->measure();
                         RectF r = ed->layoutData()->bbox().translated(ed->pos());
                         s->staffShape(ed->staffIdx()).add(r);
+                        s->shapesChanged();
                         r = ed->layoutData()->bbox().translated(ed->pos() + s->pos() + m->pos());
                         m->system()->staff(ed->staffIdx())->skyline().add(r);
                     }
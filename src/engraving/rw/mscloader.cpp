@@ -76,6 +76,8 @@ mu::Ret MscLoader::loadMscz(MasterScore* masterScore, const MscReader& mscReader
 {
     TRACEFUNC;
 
+    ObjectArena::Scope arenaScope(masterScore->arena());
+
     using namespace mu::engraving;
 
     IF_ASSERT_FAILED(mscReader.isOpened()) {
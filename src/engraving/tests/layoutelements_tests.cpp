@@ -151,3 +151,33 @@ TEST_F(Engraving_LayoutElementsTests, tstLayoutCrossStaffArp)
 
     delete score;
 }
+
+TEST_F(Engraving_LayoutElementsTests, tstLayoutRefreshEditedPageOnly)
+{
+    MasterScore* score = ScoreRW::readScore(ALL_ELEMENTS_DATA_DIR + "moonlight.mscx");
+    EXPECT_TRUE(score);
+
+    score->startCmd();
+    score->appendMeasures(200);
+    score->endCmd();
+
+    ASSERT_GT(score->npages(), 3);
+
+    const Page* firstPage = score->pages().front();
+    Measure* lastMeasure = score->lastMeasure();
+    const Page* lastPage = lastMeasure->system()->page();
+    ASSERT_NE(firstPage, lastPage);
+
+    // edit a measure on the last page
+    score->startCmd();
+    lastMeasure->undoChangeProperty(Pid::USER_STRETCH, 1.5);
+    score->endCmd();
+
+    // only the edited page is redrawn
+    RectF region = score->changedRegion();
+    EXPECT_FALSE(region.isNull());
+    EXPECT_TRUE(region.intersects(lastPage->canvasBoundingRect()));
+    EXPECT_FALSE(region.intersects(firstPage->canvasBoundingRect()));
+
+    delete score;
+}
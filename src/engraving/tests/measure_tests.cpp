@@ -30,6 +30,8 @@
 #include "dom/segment.h"
 #include "dom/undo.h"
 
+#include "rendering/dev/spacingtable.h"
+
 #include "utils/scorerw.h"
 #include "utils/scorecomp.h"
 
@@ -567,3 +569,37 @@ TEST_F(Engraving_MeasureTests, measureNumbers)
 
     delete score;
 }
+
+/**
+ * @brief Engraving_MeasureTests_spacingTableSurvivesLookups
+ * @details Looking the distances up must not invalidate the table, otherwise
+ *          the next spacing pass over the same system can't reuse it
+ */
+TEST_F(Engraving_MeasureTests, spacingTableSurvivesLookups)
+{
+    MasterScore* score = ScoreRW::readScore(MEASURE_DATA_DIR + u"measure-1.mscx");
+    EXPECT_TRUE(score);
+
+    Measure* m = score->firstMeasure();
+    rendering::dev::MeasureSpacingTable table;
+    table.reset(m);
+
+    // first pass: fills the table
+    for (Segment* s = m->first(); s; s = s->next()) {
+        table.minLeft(s);
+        table.minRight(s);
+        for (Segment* ns = s->next(); ns; ns = ns->next()) {
+            table.minHorizontalDistance(s, ns);
+            table.minHorizontalCollidingDistance(s, ns);
+        }
+    }
+
+    // second pass: the table is still the one of the measure
+    EXPECT_TRUE(table.isValid(m));
+
+    // changing a shape invalidates it
+    m->first()->createShapes();
+    EXPECT_FALSE(table.isValid(m));
+
+    delete score;
+}
@@ -73,6 +73,9 @@ public:
 
     MOCK_METHOD(bool, isAccessibleEnabled, (), (const, override));
 
+    MOCK_METHOD(size_t, undoHistoryMemoryLimit, (), (const, override));
+    MOCK_METHOD(async::Notification, undoHistoryMemoryLimitChanged, (), (const, override));
+
     MOCK_METHOD(bool, guitarProImportExperimental, (), (const, override));
     MOCK_METHOD(bool, negativeFretsAllowed, (), (const, override));
     MOCK_METHOD(bool, tablatureParenthesesZIndexWorkaround, (), (const, override));
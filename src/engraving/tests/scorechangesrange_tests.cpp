@@ -0,0 +1,112 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "dom/types.h"
+
+using namespace mu::engraving;
+
+class Engraving_ScoreChangesRangeTests : public ::testing::Test
+{
+public:
+    static ScoreChangesRange boundedRange(int tickFrom, int tickTo, staff_idx_t staffIdxFrom, staff_idx_t staffIdxTo)
+    {
+        ScoreChangesRange range;
+        range.tickFrom = tickFrom;
+        range.tickTo = tickTo;
+        range.staffIdxFrom = staffIdxFrom;
+        range.staffIdxTo = staffIdxTo;
+        return range;
+    }
+};
+
+TEST_F(Engraving_ScoreChangesRangeTests, Merge_BoundedRanges)
+{
+    // [GIVEN] Two bounded ranges
+    ScoreChangesRange range = boundedRange(480, 960, 1, 2);
+    range.changedTypes.insert(ElementType::NOTE);
+
+    ScoreChangesRange other = boundedRange(0, 720, 2, 4);
+    other.changedTypes.insert(ElementType::DYNAMIC);
+
+    // [WHEN] Merge them
+    range.merge(other);
+
+    // [THEN] The result covers both of them
+    EXPECT_EQ(range.tickFrom, 0);
+    EXPECT_EQ(range.tickTo, 960);
+    EXPECT_EQ(range.staffIdxFrom, 1);
+    EXPECT_EQ(range.staffIdxTo, 4);
+
+    ElementTypeSet expectedTypes { ElementType::NOTE, ElementType::DYNAMIC };
+    EXPECT_EQ(range.changedTypes, expectedTypes);
+}
+
+TEST_F(Engraving_ScoreChangesRangeTests, Merge_UnboundedStaysUnbounded)
+{
+    // [GIVEN] A range over the whole score (e.g. a style change) and a bounded one
+    ScoreChangesRange unbounded;
+    unbounded.changedStyleIdSet.insert(Sid::spatium);
+
+    const ScoreChangesRange bounded = boundedRange(480, 960, 1, 2);
+
+    // [WHEN] The bounded range is merged into the unbounded one
+    ScoreChangesRange range = unbounded;
+    range.merge(bounded);
+
+    // [THEN] The result is still unbounded
+    EXPECT_EQ(range.tickFrom, -1);
+    EXPECT_EQ(range.tickTo, -1);
+    EXPECT_EQ(range.staffIdxFrom, mu::nidx);
+    EXPECT_EQ(range.staffIdxTo, mu::nidx);
+    EXPECT_FALSE(range.isValidBoundary());
+    EXPECT_EQ(range.changedStyleIdSet.count(Sid::spatium), 1);
+
+    // [WHEN] The unbounded range is merged into the bounded one
+    range = bounded;
+    range.merge(unbounded);
+
+    // [THEN] The result is unbounded as well
+    EXPECT_EQ(range.tickFrom, -1);
+    EXPECT_EQ(range.tickTo, -1);
+    EXPECT_EQ(range.staffIdxFrom, mu::nidx);
+    EXPECT_EQ(range.staffIdxTo, mu::nidx);
+    EXPECT_FALSE(range.isValidBoundary());
+}
+
+TEST_F(Engraving_ScoreChangesRangeTests, Merge_UnboundedSide)
+{
+    // [GIVEN] A range of all staves in some ticks and a range of one staff
+    const ScoreChangesRange allStaves = boundedRange(480, 960, mu::nidx, mu::nidx);
+    const ScoreChangesRange oneStaff = boundedRange(0, 480, 3, 3);
+
+    // [WHEN] Merge them
+    ScoreChangesRange range = oneStaff;
+    range.merge(allStaves);
+
+    // [THEN] The ticks are extended, the staves stay unbounded
+    EXPECT_EQ(range.tickFrom, 0);
+    EXPECT_EQ(range.tickTo, 960);
+    EXPECT_EQ(range.staffIdxFrom, mu::nidx);
+    EXPECT_EQ(range.staffIdxTo, mu::nidx);
+}
@@ -256,3 +256,33 @@ TEST_F(Engraving_TempoMapTests, GRADUAL_TEMPO_CHANGE_DOESNT_OVERWRITE_OTHER_TEMP
         EXPECT_TRUE(RealIsEqual(RealRound(tempoMap->at(pair.first).tempo.val, 2), RealRound(pair.second.val, 2)));
     }
 }
+
+/**
+ * @brief TempoMapTests_TIME_TO_TICK
+ * @details Converts ticks to time and back on a tempo map with several tempo changes and a pause,
+ *          the times inside the pause must map to the tick where the pause happens
+ */
+TEST_F(Engraving_TempoMapTests, TIME_TO_TICK)
+{
+    // [GIVEN] 120 BPM, 60 BPM from the second measure, a pause of 1 second and 240 BPM from the third measure
+    TempoMap tempoMap;
+    tempoMap.setTempo(0, BeatsPerSecond::fromBPM(BeatsPerMinute(120.f)));
+    tempoMap.setTempo(1920, BeatsPerSecond::fromBPM(BeatsPerMinute(60.f)));
+    tempoMap.setTempo(3840, BeatsPerSecond::fromBPM(BeatsPerMinute(240.f)));
+    tempoMap.setPause(3840, 1.0);
+
+    // [THEN] The times of the tempo changes include the pause
+    EXPECT_TRUE(RealIsEqual(tempoMap.tick2time(1920), 2.0));
+    EXPECT_TRUE(RealIsEqual(tempoMap.tick2time(2880), 4.0));
+    EXPECT_TRUE(RealIsEqual(tempoMap.tick2time(3840), 7.0));
+    EXPECT_TRUE(RealIsEqual(tempoMap.tick2time(4800), 7.5));
+
+    // [THEN] The ticks are converted back
+    for (int tick : { 0, 240, 1919, 1920, 2000, 3839, 3840, 4000, 10000 }) {
+        EXPECT_EQ(tempoMap.time2tick(tempoMap.tick2time(tick)), tick);
+    }
+
+    // [THEN] The times inside the pause map to the tick of the pause
+    EXPECT_EQ(tempoMap.time2tick(6.5), 3840);
+    EXPECT_EQ(tempoMap.time2tick(6.0001), 3840);
+}
@@ -31,6 +31,7 @@
 #include "dom/segment.h"
 #include "dom/stafftext.h"
 #include "dom/textedit.h"
+#include "dom/textlayoutcache.h"
 
 #include "utils/scorerw.h"
 #include "utils/scorecomp.h"
@@ -193,3 +194,36 @@ TEST_F(Engraving_TextBaseTests, musicalSymbolsNotItalic)
     EXPECT_TRUE(fragmentList.front().font(dynamic).italic());
     EXPECT_TRUE(!std::next(fragmentList.begin())->font(dynamic).italic());
 }
+
+TEST_F(Engraving_TextBaseTests, layoutCacheRoundTrip)
+{
+    MasterScore* score = ScoreRW::readScore(u"test.mscx");
+    StaffText* staffText = addStaffText(score);
+    staffText->setXmlText(u"Allegro <b>con</b> <i>brio</i><sup>2</sup>");
+
+    auto blockShapes = [staffText]() {
+        std::vector<RectF> shapes;
+        for (const TextBlock& block : staffText->layoutData()->blocks) {
+            shapes.push_back(block.boundingRect());
+            for (const TextFragment& fragment : block.fragments()) {
+                shapes.push_back(RectF(fragment.pos, SizeF()));
+            }
+        }
+        shapes.push_back(staffText->layoutData()->bbox());
+        return shapes;
+    };
+
+    // measured from the fonts
+    TextLayoutCache::instance()->clear();
+    score->doLayout();
+    const std::vector<RectF> uncached = blockShapes();
+
+    // taken from the cache
+    score->doLayout();
+    const std::vector<RectF> cached = blockShapes();
+
+    EXPECT_FALSE(uncached.empty());
+    EXPECT_EQ(cached, uncached);
+
+    delete score;
+}
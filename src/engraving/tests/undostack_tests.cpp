@@ -0,0 +1,196 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "dom/masterscore.h"
+#include "dom/measure.h"
+#include "dom/undo.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static const String UNDOSTACK_DATA_DIR("undostack_data/");
+
+class Engraving_UndoStackTests : public ::testing::Test
+{
+};
+
+static void changeStretch(MasterScore* score, Measure* measure, double stretch)
+{
+    score->startCmd();
+    measure->undoChangeProperty(Pid::USER_STRETCH, stretch);
+    score->endCmd();
+}
+
+static size_t undoAll(MasterScore* score)
+{
+    size_t count = 0;
+    while (score->undoStack()->canUndo()) {
+        score->undoStack()->undo(nullptr);
+        ++count;
+    }
+    return count;
+}
+
+TEST_F(Engraving_UndoStackTests, compactRepeatedPropertyChanges)
+{
+    MasterScore* score = ScoreRW::readScore(UNDOSTACK_DATA_DIR + u"undostack.mscx");
+    ASSERT_TRUE(score);
+
+    Measure* measure = score->firstMeasure();
+    ASSERT_TRUE(measure);
+    const double originalStretch = measure->userStretch();
+
+    for (int i = 1; i <= 100; ++i) {
+        changeStretch(score, measure, 1.0 + i / 100.0);
+    }
+
+    UndoStack* undo = score->undoStack();
+    EXPECT_EQ(undo->getCurIdx(), 100u);
+
+    // the changes of the same property are merged, nothing has to be dropped
+    const size_t limit = undo->memoryUsage() / 2;
+    undo->setMemoryLimit(limit);
+    EXPECT_LE(undo->memoryUsage(), limit);
+    EXPECT_EQ(undo->getCurIdx(), 100u);
+
+    // the latest command is untouched
+    undo->undo(nullptr);
+    EXPECT_DOUBLE_EQ(measure->userStretch(), 1.99);
+    undo->redo(nullptr);
+    EXPECT_DOUBLE_EQ(measure->userStretch(), 2.0);
+
+    EXPECT_LT(undoAll(score), 100u);
+    EXPECT_DOUBLE_EQ(measure->userStretch(), originalStretch);
+
+    while (undo->canRedo()) {
+        undo->redo(nullptr);
+    }
+    EXPECT_DOUBLE_EQ(measure->userStretch(), 2.0);
+
+    delete score;
+}
+
+TEST_F(Engraving_UndoStackTests, dropOldestCommands)
+{
+    MasterScore* score = ScoreRW::readScore(UNDOSTACK_DATA_DIR + u"undostack.mscx");
+    ASSERT_TRUE(score);
+
+    Measure* first = score->firstMeasure();
+    Measure* second = first ? first->nextMeasure() : nullptr;
+    ASSERT_TRUE(second);
+
+    // alternate between two measures, so that there is nothing to merge
+    for (int i = 1; i <= 100; ++i) {
+        changeStretch(score, i % 2 ? first : second, 1.0 + i / 100.0);
+    }
+
+    UndoStack* undo = score->undoStack();
+    const size_t limit = undo->memoryUsage() / 2;
+    undo->setMemoryLimit(limit);
+    EXPECT_LE(undo->memoryUsage(), limit);
+    EXPECT_EQ(undo->getCurIdx(), 100u);
+    EXPECT_FALSE(undo->isClean());
+
+    size_t undone = undoAll(score);
+    EXPECT_GT(undone, 0u);
+    EXPECT_LT(undone, 100u);
+
+    // the oldest changes are gone, so the original values can't be restored anymore
+    EXPECT_GT(first->userStretch(), 1.0);
+    EXPECT_GT(second->userStretch(), 1.0);
+
+    // the new commands are accounted and limited too
+    for (int i = 1; i <= 100; ++i) {
+        changeStretch(score, i % 2 ? first : second, 1.0 + i / 100.0);
+    }
+    EXPECT_LE(undo->memoryUsage(), limit);
+    EXPECT_DOUBLE_EQ(second->userStretch(), 2.0);
+
+    delete score;
+}
+
+TEST_F(Engraving_UndoStackTests, mergeCommandsAfterCompaction)
+{
+    MasterScore* score = ScoreRW::readScore(UNDOSTACK_DATA_DIR + u"undostack.mscx");
+    ASSERT_TRUE(score);
+
+    Measure* first = score->firstMeasure();
+    Measure* second = first ? first->nextMeasure() : nullptr;
+    ASSERT_TRUE(second);
+    const double originalStretch = first->userStretch();
+    const double secondOriginalStretch = second->userStretch();
+
+    // a command before the merge start, which must stay on its own
+    changeStretch(score, second, 1.5);
+
+    UndoStack* undo = score->undoStack();
+    const size_t startIdx = undo->getCurIdx();
+
+    for (int i = 1; i <= 100; ++i) {
+        changeStretch(score, first, 1.0 + i / 100.0);
+    }
+
+    // the memory limit merges the commands after the merge start together
+    const size_t limit = undo->memoryUsage() / 2;
+    undo->setMemoryLimit(limit);
+    EXPECT_LE(undo->memoryUsage(), limit);
+    EXPECT_EQ(undo->getCurIdx(), startIdx + 100);
+
+    undo->mergeCommands(startIdx);
+
+    // one undo reverts everything since the merge start, and nothing before it
+    undo->undo(nullptr);
+    EXPECT_DOUBLE_EQ(first->userStretch(), originalStretch);
+    EXPECT_DOUBLE_EQ(second->userStretch(), 1.5);
+    EXPECT_EQ(undo->getCurIdx(), startIdx);
+
+    ASSERT_TRUE(undo->canUndo());
+    undo->undo(nullptr);
+    EXPECT_DOUBLE_EQ(second->userStretch(), secondOriginalStretch);
+    EXPECT_FALSE(undo->canUndo());
+
+    delete score;
+}
+
+TEST_F(Engraving_UndoStackTests, ownedElementsAndValuesAreAccounted)
+{
+    MasterScore* score = ScoreRW::readScore(UNDOSTACK_DATA_DIR + u"undostack.mscx");
+    ASSERT_TRUE(score);
+
+    Measure* measure = score->firstMeasure();
+    ASSERT_TRUE(measure);
+
+    // the removed measure is kept alive by the command, together with its content
+    RemoveElement remove(measure);
+    ChangeProperty change(measure, Pid::USER_STRETCH, 2.0);
+    EXPECT_GT(remove.memoryUsage(), change.memoryUsage() + 2 * sizeof(EngravingItem));
+
+    // so is the value of a property change
+    ChangeProperty changeText(measure, Pid::TEXT, String::fromStdString(std::string(1000, 'x')));
+    EXPECT_GE(changeText.memoryUsage(), change.memoryUsage() + 1000 * sizeof(char16_t));
+
+    delete score;
+}
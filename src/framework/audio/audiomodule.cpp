@@ -100,6 +100,11 @@ std::string AudioModule::moduleName() const
     return "audio_engine";
 }
 
+bool AudioModule::isInitOnDemandAllowed() const
+{
+    return true;
+}
+
 void AudioModule::registerExports()
 {
     m_configuration = std::make_shared<AudioConfiguration>();
@@ -52,6 +52,7 @@ public:
     AudioModule();
 
     std::string moduleName() const override;
+    bool isInitOnDemandAllowed() const override;
 
     void registerExports() override;
     void registerResources() override;
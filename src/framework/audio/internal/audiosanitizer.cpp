@@ -25,6 +25,8 @@
 
 #include "concurrency/taskscheduler.h"
 
+#include "audiothread.h"
+
 using namespace mu::audio;
 
 static std::thread::id s_as_mainThreadID;
@@ -59,5 +61,5 @@ bool AudioSanitizer::isWorkerThread()
 {
     std::thread::id id = std::this_thread::get_id();
 
-    return TaskScheduler::instance()->containsThread(id) || id == s_as_workerThreadID;
+    return AudioThread::channelsScheduler()->containsThread(id) || id == s_as_workerThreadID;
 }
@@ -24,6 +24,7 @@
 #include "log.h"
 #include "runtime.h"
 #include "async/processevents.h"
+#include "concurrency/taskscheduler.h"
 
 #ifdef Q_OS_WASM
 #include <emscripten/html5.h>
@@ -33,6 +34,12 @@ using namespace mu::audio;
 
 std::thread::id AudioThread::ID;
 
+mu::TaskScheduler* AudioThread::channelsScheduler()
+{
+    static TaskScheduler s;
+    return &s;
+}
+
 AudioThread::~AudioThread()
 {
     if (m_running) {
@@ -28,6 +28,10 @@
 #include <atomic>
 #include <functional>
 
+namespace mu {
+class TaskScheduler;
+}
+
 namespace mu::audio {
 class AudioThread
 {
@@ -37,6 +41,10 @@ public:
 
     static std::thread::id ID;
 
+    //! NOTE The workers the mixer processes the track channels on.
+    //! They run nothing else, so audio never waits behind the layout or the import
+    static TaskScheduler* channelsScheduler();
+
     using Runnable = std::function<void ()>;
 
     void run(const Runnable& onStart, const Runnable& loopBody);
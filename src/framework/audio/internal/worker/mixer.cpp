@@ -218,7 +218,8 @@ void Mixer::processTrackChannels(size_t outBufferSize, size_t samplesPerChannel,
         std::map<TrackId, std::future<std::vector<float> > > futures;
 
         for (const auto& pair : m_trackChannels) {
-            std::future<std::vector<float> > future = TaskScheduler::instance()->submit(processChannel, pair.second);
+            std::future<std::vector<float> > future
+                = AudioThread::channelsScheduler()->submit(TaskPriority::RealTime, processChannel, pair.second);
             futures.emplace(pair.first, std::move(future));
         }
 
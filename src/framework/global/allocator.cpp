@@ -30,33 +30,22 @@
 
 using namespace mu;
 
-int ObjectAllocator::s_used = 0;
-size_t ObjectAllocator::DEFAULT_BLOCK_SIZE(1024 * 256); // 256 kB
-
-static inline size_t align(size_t n)
-{
-    return (n + sizeof(intptr_t) - 1) & ~(sizeof(intptr_t) - 1);
-}
+#ifdef MUE_ENABLE_CUSTOM_ALLOCATOR
+bool ObjectAllocator::s_enabled = true;
+#else
+bool ObjectAllocator::s_enabled = false;
+#endif
 
 // ============================================
 // ObjectAllocator
 // ============================================
-void ObjectAllocator::used()
-{
-#ifdef MUE_ENABLE_CUSTOM_ALLOCATOR
-    s_used++;
-#endif
-}
-
-void ObjectAllocator::unused()
+void ObjectAllocator::setEnabled(bool arg)
 {
-#ifdef MUE_ENABLE_CUSTOM_ALLOCATOR
-    s_used--;
-#endif
+    s_enabled = arg;
 }
 
-ObjectAllocator::ObjectAllocator(const char* module, const char* name, destroyer_t dtor)
-    : m_module(module), m_name(name), m_dtor(dtor)
+ObjectAllocator::ObjectAllocator(const char* module, const char* name)
+    : m_module(module), m_name(name)
 {
     AllocatorsRegister::instance()->reg(this);
 }
@@ -78,113 +67,24 @@ const char* ObjectAllocator::name() const
 
 void* ObjectAllocator::alloc(size_t size)
 {
-    size = align(size);
-
-    if (!m_chunkSize) {
-        m_chunkSize = size;
-    }
-
-    assert(m_chunkSize == size);
-
-    if (!m_free) {
-        Block b = allocateBlock(m_chunkSize);
-        m_blocks.push_back(b);
-        m_free = b.begin;
-    }
-
-    // The return value is the current position of
-    // the allocation pointer:
-    Chunk* freeChunk = m_free;
-
-    // Advance (bump) the allocation pointer to the next chunk.
-    //
-    // When no chunks left, the `m_free` will be set to `nullptr`, and
-    // this will cause allocation of a new block on the next request:
-    m_free = m_free->next;
-
-    m_statistic.totalAllocatedCount++;
-
-    return freeChunk;
-}
-
-void ObjectAllocator::free(void* chunk)
-{
-    // The freed chunk's next pointer points to the
-    // current allocation pointer:
-    reinterpret_cast<Chunk*>(chunk)->next = m_free;
+    void* ptr = ObjectArena::allocate(size);
 
-    // And the allocation pointer is now set
-    // to the returned (free) chunk:
-    m_free = reinterpret_cast<Chunk*>(chunk);
+    m_statistic.totalAllocatedCount.fetch_add(1, std::memory_order_relaxed);
+    m_statistic.totalAllocatedBytes.fetch_add(size, std::memory_order_relaxed);
 
-    m_statistic.totalFreeCount++;
+    return ptr;
 }
 
-void ObjectAllocator::cleanup()
+void ObjectAllocator::free(void* ptr)
 {
-    if (m_blocks.empty()) {
+    if (!ptr) {
         return;
     }
 
-    std::set<Chunk*> freeChunks;
-    {
-        Chunk* free = m_free;
-        while (free) {
-            freeChunks.insert(free);
-            free = free->next;
-        }
-    }
-
-    for (size_t bi = 0; bi < m_blocks.size(); ++bi) {
-        const Block& b = m_blocks.at(bi);
-        Chunk* chunk = b.begin;
-        for (size_t i = 0; i < b.chunkCount - 1; ++i) {
-            // if not free chunk, then destroy object
-            if (freeChunks.find(chunk) == freeChunks.cend()) {
-                m_dtor(reinterpret_cast<void*>(chunk));
-            }
-
-            chunk->next = reinterpret_cast<Chunk*>(reinterpret_cast<uint8_t*>(chunk) + b.chunkSize);
-            chunk = chunk->next;
-        }
-
-        if (freeChunks.find(chunk) == freeChunks.cend()) {
-            m_dtor(reinterpret_cast<void*>(chunk));
-        }
-
-        if (bi < (m_blocks.size() - 1)) {
-            chunk->next = m_blocks.at(bi + 1).begin;
-        } else {
-            chunk->next = nullptr;
-        }
-    }
-
-    m_free = m_blocks.front().begin;
-}
-
-ObjectAllocator::Block ObjectAllocator::allocateBlock(size_t chunkSize) const
-{
-    size_t blockSize = std::max(DEFAULT_BLOCK_SIZE, chunkSize);
-    size_t chunkCount = blockSize / chunkSize;
-
-    Block b;
-    b.begin = reinterpret_cast<Chunk*>(malloc(blockSize));
-    b.chunkCount = chunkCount;
-    b.chunkSize = chunkSize;
-
-    // Once the block is allocated, we need to chain all
-    // the chunks in this block:
-
-    Chunk* chunk = b.begin;
-
-    for (size_t i = 0; i < chunkCount - 1; ++i) {
-        chunk->next = reinterpret_cast<Chunk*>(reinterpret_cast<uint8_t*>(chunk) + chunkSize);
-        chunk = chunk->next;
-    }
+    size_t size = ObjectArena::deallocate(ptr);
 
-    chunk->next = nullptr;
-
-    return b;
+    m_statistic.totalFreeCount.fetch_add(1, std::memory_order_relaxed);
+    m_statistic.totalFreeBytes.fetch_add(size, std::memory_order_relaxed);
 }
 
 void* ObjectAllocator::not_supported(const char* info)
@@ -199,20 +99,10 @@ ObjectAllocator::Info ObjectAllocator::stateInfo() const
     Info info;
     info.module = m_module;
     info.name = m_name;
-    info.chunkSize = m_chunkSize;
-    info.blockCount = m_blocks.size();
-    info.totalAllocatedCount = m_statistic.totalAllocatedCount;
-    info.totalFreeCount = m_statistic.totalFreeCount;
-
-    for (const Block& b : m_blocks) {
-        info.totalChunks += b.chunkCount;
-    }
-
-    Chunk* free = m_free;
-    while (free) {
-        ++info.freeChunks;
-        free = free->next;
-    }
+    info.totalAllocatedCount = m_statistic.totalAllocatedCount.load(std::memory_order_relaxed);
+    info.totalFreeCount = m_statistic.totalFreeCount.load(std::memory_order_relaxed);
+    info.totalAllocatedBytes = m_statistic.totalAllocatedBytes.load(std::memory_order_relaxed);
+    info.totalFreeBytes = m_statistic.totalFreeBytes.load(std::memory_order_relaxed);
 
     return info;
 }
@@ -222,21 +112,28 @@ ObjectAllocator::Info ObjectAllocator::stateInfo() const
 // ============================================
 void AllocatorsRegister::reg(ObjectAllocator* a)
 {
+    std::lock_guard lock(m_mutex);
     m_allocators.push_back(a);
 }
 
 void AllocatorsRegister::unreg(ObjectAllocator* a)
 {
+    std::lock_guard lock(m_mutex);
     m_allocators.remove(a);
 }
 
-void AllocatorsRegister::cleanupAll(const std::string& module)
+std::vector<ObjectAllocator::Info> AllocatorsRegister::statistic() const
 {
-    for (ObjectAllocator* a : m_allocators) {
-        if (a->module() == module) {
-            a->cleanup();
-        }
+    std::lock_guard lock(m_mutex);
+
+    std::vector<ObjectAllocator::Info> result;
+    result.reserve(m_allocators.size());
+
+    for (const ObjectAllocator* a : m_allocators) {
+        result.push_back(a->stateInfo());
     }
+
+    return result;
 }
 
 #define FORMAT(str, width) mu::strings::leftJustified(str, width)
@@ -245,59 +142,58 @@ void AllocatorsRegister::cleanupAll(const std::string& module)
 
 void AllocatorsRegister::printStatistic(const std::string& title)
 {
+    std::vector<ObjectAllocator::Info> infos = statistic();
+
     std::stringstream stream;
     stream << "\n\n";
     stream << title << "\n";
-    stream << "allocators: " << m_allocators.size() << '\n';
-    stream << TITLE("Object") << TITLE("Total alloc") << TITLE("Total free") << TITLE("Used (leak?)") << TITLE("Object size") << "\n";
+    stream << "allocators: " << infos.size() << '\n';
+    stream << TITLE("Object") << TITLE("Total alloc") << TITLE("Total free") << TITLE("Used (leak?)") << TITLE("Used bytes") << "\n";
 
-    uint64_t totalBytes = 0;
     uint64_t totalAllocatedCount = 0;
     uint64_t totalFreeCount = 0;
     uint64_t totalUsedCount = 0;
-    for (ObjectAllocator* a : m_allocators) {
-        ObjectAllocator::Info info = a->stateInfo();
+    uint64_t totalUsedBytes = 0;
+    for (const ObjectAllocator::Info& info : infos) {
         stream << FORMAT(info.name, 20)
                << VALUE(info.totalAllocatedCount)
                << VALUE(info.totalFreeCount)
-               << VALUE(info.usedChunks())
-               << VALUE(info.chunkSize)
+               << VALUE(info.usedCount())
+               << VALUE(info.usedBytes())
                << "\n";
 
         totalAllocatedCount += info.totalAllocatedCount;
         totalFreeCount += info.totalFreeCount;
-        totalUsedCount += info.usedChunks();
-        totalBytes += info.allocatedBytes();
+        totalUsedCount += info.usedCount();
+        totalUsedBytes += info.usedBytes();
     }
 
     stream << "--------------------------------------------------------------------------------------------\n";
-    stream << FORMAT("Total", 20) << VALUE(totalAllocatedCount) << VALUE(totalFreeCount) << VALUE(totalUsedCount) << "\n";
-    stream << "Total allocated: " << totalBytes << " bytes\n";
+    stream << FORMAT("Total", 20) << VALUE(totalAllocatedCount) << VALUE(totalFreeCount) << VALUE(totalUsedCount)
+           << VALUE(totalUsedBytes) << "\n";
 
     LOGD() << stream.str() << '\n';
 }
 
 void AllocatorsRegister::printState(const std::string& title)
 {
+    std::vector<ObjectArena::Info> arenas = ObjectArena::openArenasInfo();
+
     std::stringstream stream;
     stream << "\n\n";
     stream << title << "\n";
-    stream << "allocators: " << m_allocators.size() << '\n';
-    stream << TITLE("Object") << TITLE("blockCount") << TITLE("totalChunks") << TITLE("freeChunks") << TITLE("chunkSize")
-           << TITLE("allocatedBytes") << "\n";
+    stream << "arenas: " << arenas.size() << '\n';
+    stream << TITLE("Arena") << TITLE("slabCount") << TITLE("slabBytes") << TITLE("liveObjects") << "\n";
 
     uint64_t totalBytes = 0;
-    for (ObjectAllocator* a : m_allocators) {
-        ObjectAllocator::Info info = a->stateInfo();
+    for (const ObjectArena::Info& info : arenas) {
         stream << FORMAT(info.name, 20)
-               << VALUE(info.blockCount)
-               << VALUE(info.totalChunks)
-               << VALUE(info.freeChunks)
-               << VALUE(info.chunkSize)
-               << VALUE(info.allocatedBytes())
+               << VALUE(info.slabCount)
+               << VALUE(info.slabBytes)
+               << VALUE(info.liveObjects)
                << "\n";
 
-        totalBytes += info.allocatedBytes();
+        totalBytes += info.slabBytes;
     }
 
     stream << "-----------------------------------------------------\n";
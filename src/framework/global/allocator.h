@@ -22,16 +22,20 @@
 #ifndef MU_GLOBAL_ALLOCATOR_H
 #define MU_GLOBAL_ALLOCATOR_H
 
+#include <atomic>
 #include <cstdint>
 #include <vector>
 #include <list>
+#include <mutex>
 #include <string>
 
+#include "objectarena.h"
+
 namespace mu {
 #define OBJECT_ALLOCATOR(Module, ClassName) \
 public: \
     static ObjectAllocator& allocator() { \
-        static ObjectAllocator a(#Module, #ClassName, ObjectAllocator::destroyer<ClassName>); \
+        static ObjectAllocator a(#Module, #ClassName); \
         return a; \
     } \
     static void* operator new(size_t sz) { \
@@ -59,30 +63,20 @@ public: \
     } \
 private:
 
+//! NOTE Per class front of the allocation: the memory comes from the current ObjectArena
+//! (or from the heap if there is none), the allocator only keeps the statistics of its class
 class ObjectAllocator
 {
 public:
 
-    using destroyer_t = void (*)(void*);
-
-    ObjectAllocator(const char* module, const char* name, destroyer_t dtor);
+    ObjectAllocator(const char* module, const char* name);
     ~ObjectAllocator();
 
-    static size_t DEFAULT_BLOCK_SIZE;
-
     const char* module() const;
     const char* name() const;
 
     void* alloc(size_t size);
     void free(void* ptr);
-    void cleanup();
-
-    template<class T>
-    static void destroyer(void* ptr)
-    {
-        T* p = reinterpret_cast<T*>(ptr);
-        p->~T();
-    }
 
     void* not_supported(const char* info);
 
@@ -90,57 +84,35 @@ public:
     {
         std::string module;
         std::string name;
-        size_t chunkSize = 0;
-        size_t blockCount = 0;
-        size_t totalChunks = 0;
-        size_t freeChunks = 0;
 
         uint64_t totalAllocatedCount = 0;
         uint64_t totalFreeCount = 0;
+        uint64_t totalAllocatedBytes = 0;
+        uint64_t totalFreeBytes = 0;
 
-        uint64_t usedChunks() const { return totalChunks - freeChunks; }
-        uint64_t allocatedBytes() const { return totalChunks * chunkSize; }
+        uint64_t usedCount() const { return totalAllocatedCount - totalFreeCount; }
+        uint64_t usedBytes() const { return totalAllocatedBytes - totalFreeBytes; }
     };
 
     Info stateInfo() const;
 
-    static bool enabled() { return s_used; }
-    static void used();
-    static void unused();
-
-    static int s_used;
-private:
-
-    struct Chunk {
-        /**
-         * When a chunk is free, the `next` contains the
-         * address of the next chunk in a list.
-         *
-         * When it's allocated, this space is used by
-         * the user.
-         */
-        Chunk* next = nullptr;
-    };
+    static bool enabled() { return s_enabled; }
 
-    struct Block {
-        Chunk* begin = nullptr;
-        size_t chunkCount = 0;
-        size_t chunkSize = 0;
-    };
+    //! NOTE Must be called before any object of a class with OBJECT_ALLOCATOR is created
+    static void setEnabled(bool arg);
 
-    Block allocateBlock(size_t chunkSize) const;
+private:
+    static bool s_enabled;
 
     const char* m_module = nullptr;
     const char* m_name = nullptr;
-    size_t m_chunkSize = 0;
-    destroyer_t m_dtor = nullptr;
-    Chunk* m_free = nullptr;
-    std::vector<Block> m_blocks;
 
     struct Statistic
     {
-        uint64_t totalAllocatedCount = 0;
-        uint64_t totalFreeCount = 0;
+        std::atomic<uint64_t> totalAllocatedCount = 0;
+        std::atomic<uint64_t> totalFreeCount = 0;
+        std::atomic<uint64_t> totalAllocatedBytes = 0;
+        std::atomic<uint64_t> totalFreeBytes = 0;
     };
 
     Statistic m_statistic;
@@ -159,12 +131,13 @@ public:
     void reg(ObjectAllocator* a);
     void unreg(ObjectAllocator* a);
 
-    void cleanupAll(const std::string& module);
+    std::vector<ObjectAllocator::Info> statistic() const;
 
     void printStatistic(const std::string& title);
     void printState(const std::string& title);
 
 private:
+    mutable std::mutex m_mutex;
     std::list<ObjectAllocator*> m_allocators;
 };
 }
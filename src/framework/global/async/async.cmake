@@ -9,4 +9,5 @@ set(ASYNC_SRC
     ${CMAKE_CURRENT_LIST_DIR}/promise.h
     ${CMAKE_CURRENT_LIST_DIR}/processevents.h
     ${CMAKE_CURRENT_LIST_DIR}/notifylist.h
+    ${CMAKE_CURRENT_LIST_DIR}/coalescedchannel.h
     )
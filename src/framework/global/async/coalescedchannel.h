@@ -0,0 +1,216 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ASYNC_COALESCEDCHANNEL_H
+#define MU_ASYNC_COALESCEDCHANNEL_H
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <optional>
+#include <string>
+#include <tuple>
+
+#include "async.h"
+#include "asyncable.h"
+#include "channel.h"
+
+namespace mu::async {
+struct ChannelMetrics {
+    std::string name;
+
+    uint64_t sendCount = 0;     // calls of send()
+    uint64_t deliverCount = 0;  // sends to the receivers, after coalescing
+    std::chrono::microseconds receiversTime { 0 };
+    std::chrono::microseconds maxReceiversTime { 0 };
+    std::chrono::steady_clock::time_point since = std::chrono::steady_clock::now();
+
+    //! NOTE Sends per second
+    double sendRate() const
+    {
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - since;
+        return elapsed.count() > 0 ? sendCount / elapsed.count() : 0.0;
+    }
+
+    std::chrono::microseconds averageReceiversTime() const
+    {
+        if (deliverCount == 0) {
+            return std::chrono::microseconds(0);
+        }
+        return std::chrono::microseconds(receiversTime.count() / static_cast<int64_t>(deliverCount));
+    }
+};
+
+/*!
+ * mu::async::CoalescedChannel
+ * Collects the sends made during one event loop turn and delivers them to the receivers
+ * as a single send on the next turn. By default the last sent data wins, a merge function
+ * can be given to combine the data instead.
+ * usage:
+ *      CoalescedChannel<ChangesRange> changes("inspector.changes", [](std::tuple<ChangesRange>& pending, const ChangesRange& next) {
+ *          std::get<0>(pending).merge(next);
+ *      });
+ *      changes.onReceive(this, [](const ChangesRange& range) { ... });
+ *      source.onReceive(this, [&changes](const ChangesRange& range) { changes.send(range); });
+ */
+template<typename ... T>
+class CoalescedChannel : public Asyncable
+{
+public:
+    using Merge = std::function<void (std::tuple<T...>& pending, const T&... next)>;
+
+    explicit CoalescedChannel(const std::string& name = std::string(), const Merge& merge = nullptr)
+        : m_merge(merge)
+    {
+        m_metrics.name = name;
+    }
+
+    CoalescedChannel(const CoalescedChannel&) = delete;
+    CoalescedChannel& operator=(const CoalescedChannel&) = delete;
+
+    void send(const T&... d)
+    {
+        ++m_metrics.sendCount;
+
+        if (m_pending && m_merge) {
+            m_merge(m_pending.value(), d ...);
+        } else {
+            m_pending = std::tuple<T...>(d ...);
+        }
+
+        if (!m_flushScheduled) {
+            m_flushScheduled = true;
+            Async::call(this, [this]() {
+                m_flushScheduled = false;
+                flush();
+            });
+        }
+    }
+
+    //! NOTE Delivers the pending data right away
+    void flush()
+    {
+        if (!m_pending) {
+            return;
+        }
+
+        std::tuple<T...> data = std::move(m_pending.value());
+        m_pending.reset();
+
+        auto start = std::chrono::steady_clock::now();
+        std::apply([this](const T&... args) {
+            m_channel.send(args ...);
+        }, data);
+
+        auto time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        ++m_metrics.deliverCount;
+        m_metrics.receiversTime += time;
+        m_metrics.maxReceiversTime = std::max(m_metrics.maxReceiversTime, time);
+    }
+
+    //! NOTE Drops the pending data
+    void cancel()
+    {
+        m_pending.reset();
+    }
+
+    bool hasPending() const
+    {
+        return m_pending.has_value();
+    }
+
+    template<typename Func>
+    void onReceive(const Asyncable* receiver, Func f, Asyncable::AsyncMode mode = Asyncable::AsyncMode::AsyncSetOnce)
+    {
+        m_channel.onReceive(receiver, f, mode);
+    }
+
+    void resetOnReceive(const Asyncable* receiver)
+    {
+        m_channel.resetOnReceive(receiver);
+    }
+
+    Channel<T...> channel() const
+    {
+        return m_channel;
+    }
+
+    const ChannelMetrics& metrics() const
+    {
+        return m_metrics;
+    }
+
+private:
+    Channel<T...> m_channel;
+    Merge m_merge;
+    std::optional<std::tuple<T...> > m_pending;
+    bool m_flushScheduled = false;
+    ChannelMetrics m_metrics;
+};
+
+class CoalescedNotification
+{
+public:
+    explicit CoalescedNotification(const std::string& name = std::string())
+        : m_ch(name) {}
+
+    void notify()
+    {
+        m_ch.send();
+    }
+
+    void flush()
+    {
+        m_ch.flush();
+    }
+
+    void cancel()
+    {
+        m_ch.cancel();
+    }
+
+    bool hasPending() const
+    {
+        return m_ch.hasPending();
+    }
+
+    template<typename Func>
+    void onNotify(const Asyncable* receiver, Func f, Asyncable::AsyncMode mode = Asyncable::AsyncMode::AsyncSetOnce)
+    {
+        m_ch.onReceive(receiver, f, mode);
+    }
+
+    void resetOnNotify(const Asyncable* receiver)
+    {
+        m_ch.resetOnReceive(receiver);
+    }
+
+    const ChannelMetrics& metrics() const
+    {
+        return m_ch.metrics();
+    }
+
+private:
+    CoalescedChannel<> m_ch;
+};
+}
+
+#endif // MU_ASYNC_COALESCEDCHANNEL_H
@@ -23,24 +23,78 @@
 #ifndef MU_GLOBAL_TASKCHEDULER_H
 #define MU_GLOBAL_TASKCHEDULER_H
 
+#include <algorithm>
+#include <chrono>
 #include <condition_variable>
+#include <deque>
+#include <exception>
 #include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
 #include <atomic>
-#include <queue>
+#include <set>
 #include <thread>
+#include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "log.h"
+#include "runtime.h"
 
 namespace mu {
 typedef std::invoke_result_t<decltype(std::thread::hardware_concurrency)> thread_pool_size_t;
 
+//! NOTE Tasks of a higher priority class are always taken before tasks of a lower one,
+//! both from the own queue of a worker and when stealing from other workers
+enum class TaskPriority {
+    RealTime = 0,   // latency critical work, e.g. audio processing on a dedicated scheduler
+    Interactive,    // work the UI is waiting for
+    Background      // everything else (default)
+};
+
+//! NOTE Work-stealing thread pool.
+//! Every worker owns a deque per priority class; tasks pushed from a worker go to its own deque,
+//! tasks pushed from other threads are distributed round-robin. An idle worker steals from the others,
+//! so there is no single lock all producers and consumers contend on.
 class TaskScheduler
 {
+    //! NOTE Lets the caller of a fork-join wait only for the helper tasks which have actually started:
+    //! a helper which enters after close leaves without touching the state of the caller
+    class Gate
+    {
+    public:
+        bool enter()
+        {
+            size_t state = m_state.load();
+            do {
+                if (state & CLOSED) {
+                    return false;
+                }
+            } while (!m_state.compare_exchange_weak(state, state + 1));
+
+            return true;
+        }
+
+        void leave()
+        {
+            m_state.fetch_sub(1);
+        }
+
+        void closeAndWait()
+        {
+            m_state.fetch_or(CLOSED);
+            while ((m_state.load() & ~CLOSED) != 0) {
+                std::this_thread::yield();
+            }
+        }
+
+    private:
+        static constexpr size_t CLOSED = static_cast<size_t>(1) << (sizeof(size_t) * 8 - 1);
+        std::atomic<size_t> m_state = 0;
+    };
+
 public:
 
     //!Note Would be moved into globalmodule.cpp for better lifetime control
@@ -50,9 +104,24 @@ public:
         return &s;
     }
 
+    struct WorkerStatistics {
+        size_t queueDepth = 0;
+        uint64_t executedTasks = 0;
+        uint64_t stolenTasks = 0;
+        double idleTimeMs = 0.0;
+    };
+
+    struct Statistics {
+        size_t queuedTasks = 0;
+        size_t runningTasks = 0;
+        uint64_t executedTasks = 0;
+        uint64_t stolenTasks = 0;
+        std::vector<WorkerStatistics> workers;
+    };
+
     explicit TaskScheduler(const thread_pool_size_t desiredThreadCount = 0)
         : m_threadPoolSize(vaildateThreadPoolCapacity(desiredThreadCount)),
-        m_threadPool(std::make_unique<std::thread[]>(vaildateThreadPoolCapacity(desiredThreadCount)))
+        m_workers(std::make_unique<Worker[]>(vaildateThreadPoolCapacity(desiredThreadCount)))
     {
         setupThreads();
     }
@@ -68,23 +137,37 @@ public:
         return m_threadPoolSize;
     }
 
-    template<typename FuncT, typename ... ArgsT>
+    template<typename FuncT, typename ... ArgsT, typename = std::enable_if_t<!std::is_same_v<std::decay_t<FuncT>, TaskPriority> > >
     void push(FuncT&& task, ArgsT&&... args)
     {
-        std::function<void()> taskFunctor = std::bind(std::forward<FuncT>(task), std::forward<ArgsT>(args)...);
-        {
-            const std::lock_guard lock(m_mutex);
-            m_taskQueue.push(taskFunctor);
+        push(TaskPriority::Background, std::forward<FuncT>(task), std::forward<ArgsT>(args)...);
+    }
+
+    template<typename FuncT, typename ... ArgsT>
+    void push(TaskPriority priority, FuncT&& task, ArgsT&&... args)
+    {
+        if constexpr (sizeof...(ArgsT) == 0) {
+            enqueue(priority, std::function<void()>(std::forward<FuncT>(task)));
+        } else {
+            enqueue(priority, [func = std::forward<FuncT>(task), params = std::make_tuple(std::forward<ArgsT>(args)...)]() mutable {
+                std::apply(func, params);
+            });
         }
-        m_newTaskAvailableCv.notify_one();
     }
 
-    template<typename FuncT, typename ... ArgsT, typename ReturnT = std::invoke_result_t<std::decay_t<FuncT>, std::decay_t<ArgsT>...> >
+    template<typename FuncT, typename ... ArgsT, typename ReturnT = std::invoke_result_t<std::decay_t<FuncT>, std::decay_t<ArgsT>...>,
+             typename = std::enable_if_t<!std::is_same_v<std::decay_t<FuncT>, TaskPriority> > >
     std::future<ReturnT> submit(FuncT&& task, ArgsT&&... args)
+    {
+        return submit(TaskPriority::Background, std::forward<FuncT>(task), std::forward<ArgsT>(args)...);
+    }
+
+    template<typename FuncT, typename ... ArgsT, typename ReturnT = std::invoke_result_t<std::decay_t<FuncT>, std::decay_t<ArgsT>...> >
+    std::future<ReturnT> submit(TaskPriority priority, FuncT&& task, ArgsT&&... args)
     {
         std::function<ReturnT()> taskFunctor = std::bind(std::forward<FuncT>(task), std::forward<ArgsT>(args)...);
         std::shared_ptr<std::promise<ReturnT> > promise = std::make_shared<std::promise<ReturnT> >();
-        push([taskFunctor, promise] {
+        push(priority, [taskFunctor, promise] {
             try {
                 if constexpr (std::is_void_v<ReturnT>) {
                     std::invoke(taskFunctor);
@@ -104,25 +187,214 @@ public:
         return promise->get_future();
     }
 
+    //! NOTE Calls func(i) for every i in [begin, end), split into chunks of `grain` indices.
+    //! The calling thread takes part in the work; a single helper task per worker is pushed,
+    //! so no allocation happens per index or per chunk. Returns when all indices are processed
+    //! and rethrows the first exception thrown by func.
+    template<typename FuncT>
+    void parallelFor(size_t begin, size_t end, FuncT&& func, size_t grain = 1, TaskPriority priority = TaskPriority::Interactive)
+    {
+        if (begin >= end) {
+            return;
+        }
+
+        grain = std::max<size_t>(grain, 1);
+        const size_t chunkCount = (end - begin + grain - 1) / grain;
+
+        struct Loop {
+            std::atomic<size_t> next = 0;
+            Gate gate;
+            std::mutex errorMutex;
+            std::exception_ptr error;
+        };
+
+        std::shared_ptr<Loop> loop = std::make_shared<Loop>();
+        loop->next = begin;
+
+        auto runChunks = [&func, end, grain](Loop& l) {
+            try {
+                for (;;) {
+                    size_t from = l.next.fetch_add(grain);
+                    if (from >= end) {
+                        return;
+                    }
+
+                    size_t to = std::min(from + grain, end);
+                    for (size_t i = from; i < to; ++i) {
+                        func(i);
+                    }
+                }
+            } catch (...) {
+                std::lock_guard lock(l.errorMutex);
+                if (!l.error) {
+                    l.error = std::current_exception();
+                }
+                l.next.store(end);
+            }
+        };
+
+        const size_t helperCount = std::min<size_t>(chunkCount - 1, m_threadPoolSize);
+        for (size_t i = 0; i < helperCount; ++i) {
+            enqueue(priority, [loop, chunks = &runChunks]() {
+                if (!loop->gate.enter()) {
+                    return;
+                }
+                (*chunks)(*loop);
+                loop->gate.leave();
+            });
+        }
+
+        runChunks(*loop);
+
+        //! NOTE Only the helpers which have already started are waited for, the others find the gate closed.
+        //! So the caller never runs unrelated tasks and a call from a worker can't deadlock
+        loop->gate.closeAndWait();
+
+        if (loop->error) {
+            std::rethrow_exception(loop->error);
+        }
+    }
+
+    //! NOTE Fork-join group: run() any number of tasks, then wait() for all of them.
+    //! wait() runs the tasks of the group which no worker has taken yet on the calling thread,
+    //! never tasks of anybody else, and rethrows the first exception thrown by a task.
+    //! At most one helper per worker is pushed to the scheduler, the helpers run the group's
+    //! tasks until none is left, so the scheduler queues don't grow with the number of tasks.
+    class TaskGroup
+    {
+    public:
+        explicit TaskGroup(TaskScheduler* scheduler = TaskScheduler::instance(), TaskPriority priority = TaskPriority::Interactive)
+            : m_scheduler(scheduler), m_priority(priority), m_state(std::make_shared<State>()) {}
+
+        ~TaskGroup()
+        {
+            try {
+                wait();
+            } catch (...) {
+                LOGE() << "exception in a task of the group";
+            }
+        }
+
+        TaskGroup(const TaskGroup&) = delete;
+        TaskGroup& operator=(const TaskGroup&) = delete;
+
+        template<typename FuncT>
+        void run(FuncT&& task)
+        {
+            {
+                std::lock_guard lock(m_state->mutex);
+                m_state->tasks.emplace_back(std::forward<FuncT>(task));
+            }
+
+            size_t helpers = m_state->helpers.load();
+            do {
+                if (helpers >= m_scheduler->m_threadPoolSize) {
+                    return;
+                }
+            } while (!m_state->helpers.compare_exchange_weak(helpers, helpers + 1));
+
+            m_scheduler->enqueue(m_priority, [state = m_state]() {
+                if (state->gate.enter()) {
+                    while (state->runOne()) {
+                    }
+                    state->gate.leave();
+                }
+                //! NOTE A task added after the loop above is run by the next helper or by wait()
+                state->helpers.fetch_sub(1);
+            });
+        }
+
+        void wait()
+        {
+            std::shared_ptr<State> state = m_state;
+            while (state->runOne()) {
+            }
+
+            state->gate.closeAndWait();
+
+            //! NOTE The group can be used again, the scheduler tasks left over find the old gate closed
+            m_state = std::make_shared<State>();
+
+            if (state->error) {
+                std::rethrow_exception(state->error);
+            }
+        }
+
+    private:
+        struct State {
+            std::mutex mutex;
+            std::deque<std::function<void()> > tasks;
+            std::atomic<size_t> helpers = 0;
+            Gate gate;
+            std::exception_ptr error;
+
+            bool runOne()
+            {
+                std::function<void()> task;
+                {
+                    std::lock_guard lock(mutex);
+                    if (tasks.empty()) {
+                        return false;
+                    }
+                    task = std::move(tasks.front());
+                    tasks.pop_front();
+                }
+
+                try {
+                    task();
+                } catch (...) {
+                    std::lock_guard lock(mutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+
+                return true;
+            }
+        };
+
+        TaskScheduler* m_scheduler = nullptr;
+        TaskPriority m_priority = TaskPriority::Interactive;
+        std::shared_ptr<State> m_state;
+    };
+
     void waitForAllTasksComplete()
     {
-        m_isWaitingForAllTasksDone = true;
-        std::unique_lock<std::mutex> tasks_lock(m_mutex);
-        m_taskFinishedCv.wait(tasks_lock, [this] { return m_taskQueue.empty(); });
-        m_isWaitingForAllTasksDone = false;
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_allTasksDoneCv.wait(lock, [this] { return m_queuedTasks.load() == 0 && m_runningTasks.load() == 0; });
     }
 
-    const std::set<std::thread::id>& threadIdSet() const
+    Statistics statistics() const
     {
-        static std::set<std::thread::id> result;
+        Statistics stat;
+        stat.queuedTasks = m_queuedTasks.load();
+        stat.runningTasks = m_runningTasks.load();
 
-        if (result.empty()) {
-            for (thread_pool_size_t i = 0; i < m_threadPoolSize; ++i) {
-                result.insert(m_threadPool[i].get_id());
+        for (thread_pool_size_t i = 0; i < m_threadPoolSize; ++i) {
+            Worker& w = m_workers[i];
+
+            WorkerStatistics ws;
+            {
+                std::lock_guard lock(w.mutex);
+                for (const auto& queue : w.queues) {
+                    ws.queueDepth += queue.size();
+                }
             }
+            ws.executedTasks = w.executedTasks.load(std::memory_order_relaxed);
+            ws.stolenTasks = w.stolenTasks.load(std::memory_order_relaxed);
+            ws.idleTimeMs = static_cast<double>(w.idleTimeNs.load(std::memory_order_relaxed)) / 1000000.0;
+
+            stat.executedTasks += ws.executedTasks;
+            stat.stolenTasks += ws.stolenTasks;
+            stat.workers.push_back(ws);
         }
 
-        return result;
+        return stat;
+    }
+
+    const std::set<std::thread::id>& threadIdSet() const
+    {
+        return m_threadIds;
     }
 
     bool containsThread(const std::thread::id& id) const
@@ -132,20 +404,135 @@ public:
     }
 
 private:
+    static constexpr size_t PRIORITY_COUNT = 3;
+    static constexpr size_t NO_WORKER = static_cast<size_t>(-1);
+
+    struct Worker {
+        std::thread thread;
+
+        mutable std::mutex mutex;
+        std::deque<std::function<void()> > queues[PRIORITY_COUNT];
+
+        std::atomic<uint64_t> executedTasks = 0;
+        std::atomic<uint64_t> stolenTasks = 0;
+        std::atomic<int64_t> idleTimeNs = 0;
+    };
+
+    struct CurrentWorker {
+        const TaskScheduler* scheduler = nullptr;
+        size_t index = NO_WORKER;
+    };
+
+    static CurrentWorker& currentWorker()
+    {
+        static thread_local CurrentWorker w;
+        return w;
+    }
+
+    size_t currentWorkerIndex() const
+    {
+        const CurrentWorker& w = currentWorker();
+        return w.scheduler == this ? w.index : NO_WORKER;
+    }
+
+    void enqueue(TaskPriority priority, std::function<void()>&& task)
+    {
+        size_t index = currentWorkerIndex();
+        if (index == NO_WORKER) {
+            index = m_nextWorker.fetch_add(1, std::memory_order_relaxed) % m_threadPoolSize;
+        }
+
+        Worker& w = m_workers[index];
+        {
+            //! NOTE Counted under the queue lock, before any thief can take the task and decrement the counter
+            std::lock_guard lock(w.mutex);
+            m_queuedTasks.fetch_add(1);
+            w.queues[static_cast<size_t>(priority)].push_back(std::move(task));
+        }
+
+        //! NOTE Waking is only needed if somebody sleeps; pairs with the counter increment in th_workerLoop
+        if (m_sleepingWorkers.load() > 0) {
+            {
+                std::lock_guard lock(m_sleepMutex);
+            }
+            m_newTaskAvailableCv.notify_one();
+        }
+    }
+
+    bool takeTask(size_t self, std::function<void()>& task, bool& stolen)
+    {
+        if (m_queuedTasks.load() == 0) {
+            return false;
+        }
+
+        for (size_t p = 0; p < PRIORITY_COUNT; ++p) {
+            for (size_t i = 0; i < m_threadPoolSize; ++i) {
+                size_t index = (self + i) % m_threadPoolSize;
+                Worker& w = m_workers[index];
+
+                std::lock_guard lock(w.mutex);
+                std::deque<std::function<void()> >& queue = w.queues[p];
+                if (queue.empty()) {
+                    continue;
+                }
+
+                //! NOTE The owner takes the oldest task, thieves take the newest one from the other end
+                if (i == 0) {
+                    task = std::move(queue.front());
+                    queue.pop_front();
+                } else {
+                    task = std::move(queue.back());
+                    queue.pop_back();
+                }
+
+                m_runningTasks.fetch_add(1);
+                m_queuedTasks.fetch_sub(1);
+                stolen = i != 0;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void runTask(std::function<void()>& task, Worker* worker, bool stolen)
+    {
+        task();
+        task = nullptr;
+
+        if (worker) {
+            worker->executedTasks.fetch_add(1, std::memory_order_relaxed);
+            if (stolen) {
+                worker->stolenTasks.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        if (m_runningTasks.fetch_sub(1) == 1 && m_queuedTasks.load() == 0) {
+            {
+                std::lock_guard lock(m_sleepMutex);
+            }
+            m_allTasksDoneCv.notify_all();
+        }
+    }
+
     void setupThreads()
     {
         m_isActive = true;
         for (thread_pool_size_t i = 0; i < m_threadPoolSize; ++i) {
-            m_threadPool[i] = std::thread(&TaskScheduler::th_workerLoop, this);
+            m_workers[i].thread = std::thread(&TaskScheduler::th_workerLoop, this, i);
+            m_threadIds.insert(m_workers[i].thread.get_id());
         }
     }
 
     void terminateThreads()
     {
-        m_isActive = false;
+        {
+            std::lock_guard lock(m_sleepMutex);
+            m_isActive = false;
+        }
         m_newTaskAvailableCv.notify_all();
         for (thread_pool_size_t i = 0; i < m_threadPoolSize; ++i) {
-            m_threadPool[i].join();
+            m_workers[i].thread.join();
         }
     }
 
@@ -166,39 +553,50 @@ private:
         return desiredThreadCount;
     }
 
-    void th_workerLoop()
+    void th_workerLoop(thread_pool_size_t index)
     {
-        while (m_isActive) {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            m_newTaskAvailableCv.wait(lock, [this] { return !m_taskQueue.empty() || !m_isActive; });
+        runtime::setThreadName("task_worker_" + std::to_string(index));
 
-            if (!m_isActive) {
-                return;
-            }
+        CurrentWorker& current = currentWorker();
+        current.scheduler = this;
+        current.index = index;
 
-            std::function<void()> task = m_taskQueue.front();
-            m_taskQueue.pop();
+        Worker& self = m_workers[index];
+        std::function<void()> task;
 
-            lock.unlock();
+        while (m_isActive) {
+            bool stolen = false;
+            if (takeTask(index, task, stolen)) {
+                runTask(task, &self, stolen);
+                continue;
+            }
 
-            task();
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            m_sleepingWorkers.fetch_add(1);
 
-            if (m_isWaitingForAllTasksDone) {
-                m_taskFinishedCv.notify_one();
-            }
+            auto idleStart = std::chrono::steady_clock::now();
+            m_newTaskAvailableCv.wait(lock, [this] { return m_queuedTasks.load() > 0 || !m_isActive; });
+            auto idleTime = std::chrono::steady_clock::now() - idleStart;
+
+            m_sleepingWorkers.fetch_sub(1);
+            self.idleTimeNs.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(idleTime).count(), std::memory_order_relaxed);
         }
     }
 
     std::atomic<bool> m_isActive = false;
-    std::atomic<bool> m_isWaitingForAllTasksDone = false;
 
-    mutable std::mutex m_mutex;
+    std::atomic<size_t> m_queuedTasks = 0;
+    std::atomic<size_t> m_runningTasks = 0;
+    std::atomic<size_t> m_sleepingWorkers = 0;
+    std::atomic<size_t> m_nextWorker = 0;
+
+    mutable std::mutex m_sleepMutex;
     std::condition_variable m_newTaskAvailableCv;
-    std::condition_variable m_taskFinishedCv;
-    std::queue<std::function<void()> > m_taskQueue;
+    std::condition_variable m_allTasksDoneCv;
 
     thread_pool_size_t m_threadPoolSize = 0;
-    std::unique_ptr<std::thread[]> m_threadPool = nullptr;
+    std::unique_ptr<Worker[]> m_workers = nullptr;
+    std::set<std::thread::id> m_threadIds;
 };
 }
 
@@ -570,6 +570,25 @@ public:
     };
 
     void addEntry(EntryType type, const QString& fileName, const QByteArray& contents);
+
+    void startStreamedEntry(const QString& fileName);
+    void writeStreamedData(const uchar* data, qint64 len);
+    void finishStreamedEntry();
+
+private:
+    void fillHeader(FileHeader& header, EntryType type, const QString& fileName) const;
+    bool deflateStreamed(int flush);
+
+    // the file entry being written by startStreamedEntry()/finishStreamedEntry()
+    struct StreamedEntry {
+        bool active = false;
+        FileHeader header;
+        z_stream stream;
+        uint crc_32 = 0;
+        qint64 size = 0;
+        qint64 compressedSize = 0;
+        QByteArray buffer;
+    } streamedEntry;
 };
 
 LocalFileHeader CentralFileHeader::toLocalHeader() const
@@ -679,6 +698,53 @@ void MQZipReaderPrivate::scanFiles()
     }
 }
 
+void MQZipWriterPrivate::fillHeader(FileHeader& header, EntryType type, const QString& fileName) const
+{
+    memset(&header.h, 0, sizeof(CentralFileHeader));
+    writeUInt(header.h.signature, 0x02014b50);
+
+    writeUShort(header.h.version_needed, ZIP_VERSION);
+    writeMSDosDate(header.h.last_mod_file, QDateTime::currentDateTime());
+
+    // if bit 11 is set, the filename and comment fields must be encoded using UTF-8
+    ushort general_purpose_bits = Utf8Names; // always use utf-8
+    writeUShort(header.h.general_purpose_bits, general_purpose_bits);
+
+    const bool inUtf8 = (general_purpose_bits & Utf8Names) != 0;
+    header.file_name = inUtf8 ? fileName.toUtf8() : fileName.toLocal8Bit();
+    if (header.file_name.size() > 0xffff) {
+        qWarning("QZip: Filename is too long, chopping it to 65535 bytes");
+        header.file_name = header.file_name.left(0xffff); // ### don't break the utf-8 sequence, if any
+    }
+    if (header.file_comment.size() + header.file_name.size() > 0xffff) {
+        qWarning("QZip: File comment is too long, chopping it to 65535 bytes");
+        header.file_comment.truncate(0xffff - header.file_name.size()); // ### don't break the utf-8 sequence, if any
+    }
+    writeUShort(header.h.file_name_length, header.file_name.length());
+    //h.extra_field_length[2];
+
+    writeUShort(header.h.version_made, HostUnix << 8);
+    //uchar internal_file_attributes[2];
+    //uchar external_file_attributes[4];
+    quint32 mode = permissionsToMode(permissions);
+    switch (type) {
+    case Symlink:
+        mode |= UnixFileAttributes::SymLink;
+        break;
+    case Directory:
+        mode |= UnixFileAttributes::Dir;
+        break;
+    case File:
+        mode |= UnixFileAttributes::File;
+        break;
+    default:
+        Q_UNREACHABLE();
+        break;
+    }
+    writeUInt(header.h.external_file_attributes, mode << 16);
+    writeUInt(header.h.offset_local_header, start_of_directory);
+}
+
 void MQZipWriterPrivate::addEntry(EntryType type, const QString& fileName,
                                   const QByteArray& contents /*, QFile::Permissions permissions, QZip::Method m*/)
 {
@@ -708,12 +774,9 @@ void MQZipWriterPrivate::addEntry(EntryType type, const QString& fileName,
     }
 
     FileHeader header;
-    memset(&header.h, 0, sizeof(CentralFileHeader));
-    writeUInt(header.h.signature, 0x02014b50);
+    fillHeader(header, type, fileName);
 
-    writeUShort(header.h.version_needed, ZIP_VERSION);
     writeUInt(header.h.uncompressed_size, contents.length());
-    writeMSDosDate(header.h.last_mod_file, QDateTime::currentDateTime());
     QByteArray data = contents;
     if (compression == MQZipWriter::AlwaysCompress) {
         writeUShort(header.h.compression_method, CompressionMethodDeflated);
@@ -746,51 +809,125 @@ void MQZipWriterPrivate::addEntry(EntryType type, const QString& fileName,
     crc_32 = ::crc32(crc_32, (const uchar*)contents.constData(), contents.length());
     writeUInt(header.h.crc_32, crc_32);
 
-    // if bit 11 is set, the filename and comment fields must be encoded using UTF-8
-    ushort general_purpose_bits = Utf8Names; // always use utf-8
-    writeUShort(header.h.general_purpose_bits, general_purpose_bits);
+    fileHeaders.append(header);
 
-    const bool inUtf8 = (general_purpose_bits & Utf8Names) != 0;
-    header.file_name = inUtf8 ? fileName.toUtf8() : fileName.toLocal8Bit();
-    if (header.file_name.size() > 0xffff) {
-        qWarning("QZip: Filename is too long, chopping it to 65535 bytes");
-        header.file_name = header.file_name.left(0xffff); // ### don't break the utf-8 sequence, if any
-    }
-    if (header.file_comment.size() + header.file_name.size() > 0xffff) {
-        qWarning("QZip: File comment is too long, chopping it to 65535 bytes");
-        header.file_comment.truncate(0xffff - header.file_name.size()); // ### don't break the utf-8 sequence, if any
+    LocalFileHeader h = header.h.toLocalHeader();
+    device->write((const char*)&h, sizeof(LocalFileHeader));
+    device->write(header.file_name);
+    device->write(data);
+    start_of_directory = device->pos();
+    dirtyFileTree = true;
+}
+
+/*!
+    Starts a compressed file entry whose contents are passed by writeStreamedData().
+    The contents are deflated and written to the device as they come,
+    the sizes and the checksum are put in the local header by finishStreamedEntry().
+    Requires a random access device, as any other entry.
+*/
+void MQZipWriterPrivate::startStreamedEntry(const QString& fileName)
+{
+    Q_ASSERT(!streamedEntry.active);
+
+    if (!(device->isOpen() || device->open(QIODevice::WriteOnly))) {
+        status = MQZipWriter::FileOpenError;
+        return;
     }
-    writeUShort(header.h.file_name_length, header.file_name.length());
-    //h.extra_field_length[2];
+    device->seek(start_of_directory);
 
-    writeUShort(header.h.version_made, HostUnix << 8);
-    //uchar internal_file_attributes[2];
-    //uchar external_file_attributes[4];
-    quint32 mode = permissionsToMode(permissions);
-    switch (type) {
-    case Symlink:
-        mode |= UnixFileAttributes::SymLink;
-        break;
-    case Directory:
-        mode |= UnixFileAttributes::Dir;
-        break;
-    case File:
-        mode |= UnixFileAttributes::File;
-        break;
-    default:
-        Q_UNREACHABLE();
-        break;
+    FileHeader& header = streamedEntry.header;
+    fillHeader(header, File, fileName);
+    writeUShort(header.h.compression_method, CompressionMethodDeflated);
+
+    z_stream& stream = streamedEntry.stream;
+    memset(&stream, 0, sizeof(z_stream));
+    if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        qWarning("QZip: failed to initialize the compression, skipping file");
+        status = MQZipWriter::FileError;
+        return;
     }
-    writeUInt(header.h.external_file_attributes, mode << 16);
-    writeUInt(header.h.offset_local_header, start_of_directory);
 
-    fileHeaders.append(header);
+    streamedEntry.crc_32 = ::crc32(0, 0, 0);
+    streamedEntry.size = 0;
+    streamedEntry.compressedSize = 0;
+    streamedEntry.buffer.resize(64 * 1024);
+    streamedEntry.active = true;
 
+    // the sizes and the checksum are not known yet, the local header is rewritten at the end
     LocalFileHeader h = header.h.toLocalHeader();
     device->write((const char*)&h, sizeof(LocalFileHeader));
     device->write(header.file_name);
-    device->write(data);
-    start_of_directory = device->pos();
+}
+
+void MQZipWriterPrivate::writeStreamedData(const uchar* data, qint64 len)
+{
+    if (!streamedEntry.active || len <= 0) {
+        return;
+    }
+
+    streamedEntry.crc_32 = ::crc32(streamedEntry.crc_32, data, static_cast<uInt>(len));
+    streamedEntry.size += len;
+
+    streamedEntry.stream.next_in = const_cast<Bytef*>(data);
+    streamedEntry.stream.avail_in = static_cast<uInt>(len);
+    deflateStreamed(Z_NO_FLUSH);
+}
+
+bool MQZipWriterPrivate::deflateStreamed(int flush)
+{
+    z_stream& stream = streamedEntry.stream;
+    QByteArray& buffer = streamedEntry.buffer;
+
+    int res = Z_OK;
+    do {
+        stream.next_out = reinterpret_cast<Bytef*>(buffer.data());
+        stream.avail_out = static_cast<uInt>(buffer.size());
+
+        res = deflate(&stream, flush);
+        if (res == Z_STREAM_ERROR) {
+            qWarning("QZip: failed to compress file");
+            status = MQZipWriter::FileError;
+            return false;
+        }
+
+        const qint64 produced = buffer.size() - stream.avail_out;
+        if (device->write(buffer.constData(), produced) != produced) {
+            status = MQZipWriter::FileWriteError;
+            return false;
+        }
+        streamedEntry.compressedSize += produced;
+    } while (stream.avail_out == 0 || (flush == Z_FINISH && res != Z_STREAM_END));
+
+    return true;
+}
+
+void MQZipWriterPrivate::finishStreamedEntry()
+{
+    if (!streamedEntry.active) {
+        return;
+    }
+
+    streamedEntry.stream.next_in = nullptr;
+    streamedEntry.stream.avail_in = 0;
+    deflateStreamed(Z_FINISH);
+    deflateEnd(&streamedEntry.stream);
+    streamedEntry.active = false;
+    streamedEntry.buffer.clear();
+
+    FileHeader& header = streamedEntry.header;
+    writeUInt(header.h.crc_32, streamedEntry.crc_32);
+    writeUInt(header.h.uncompressed_size, static_cast<uint>(streamedEntry.size));
+    writeUInt(header.h.compressed_size, static_cast<uint>(streamedEntry.compressedSize));
+
+    const qint64 end = device->pos();
+
+    LocalFileHeader h = header.h.toLocalHeader();
+    device->seek(start_of_directory);
+    device->write((const char*)&h, sizeof(LocalFileHeader));
+    device->seek(end);
+
+    fileHeaders.append(header);
+    start_of_directory = end;
     dirtyFileTree = true;
 }
 
@@ -1350,6 +1487,26 @@ void MQZipWriter::addFile(const QString& fileName, QIODevice* device)
     }
 }
 
+/*!
+    Starts a new compressed file \a fileName in the archive. Its contents are
+    passed by writeFileData() and compressed as they come, so they never have to
+    be kept in memory as a whole. The file is completed by finishFile().
+*/
+void MQZipWriter::startFile(const QString& fileName)
+{
+    d->startStreamedEntry(QDir::fromNativeSeparators(fileName));
+}
+
+void MQZipWriter::writeFileData(const char* data, qint64 len)
+{
+    d->writeStreamedData(reinterpret_cast<const uchar*>(data), len);
+}
+
+void MQZipWriter::finishFile()
+{
+    d->finishStreamedEntry();
+}
+
 /*!
     Create a new directory in the archive with the specified \a dirName and
     the \a permissions;
@@ -1379,6 +1536,8 @@ void MQZipWriter::addSymLink(const QString& fileName, const QString& destination
 */
 void MQZipWriter::close()
 {
+    d->finishStreamedEntry();
+
     if (!(d->device->openMode() & QIODevice::WriteOnly)) {
         d->device->close();
         return;
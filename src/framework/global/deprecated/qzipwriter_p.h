@@ -102,6 +102,10 @@ public:
 
     void addFile(const QString& fileName, QIODevice* device);
 
+    void startFile(const QString& fileName);
+    void writeFileData(const char* data, qint64 len);
+    void finishFile();
+
     void addDirectory(const QString& dirName);
 
     void addSymLink(const QString& fileName, const QString& destination);
@@ -36,6 +36,7 @@
 #include "internal/process.h"
 
 #include "runtime.h"
+#include "tracer.h"
 #include "async/processevents.h"
 
 #include "settings.h"
@@ -148,6 +149,18 @@ void GlobalModule::onPreInit(const IApplication::RunMode& mode)
     Profiler* profiler = Profiler::instance();
     profiler->setup(profOpt, new MyPrinter());
 
+    //! --- Setup tracer ---
+    Tracer* tracer = Tracer::instance();
+    tracer->setupFromEnvironment();
+    if (m_traceFilePath) {
+        tracer->setOutputFilePath(m_traceFilePath.value());
+        tracer->setEnabled(true);
+    }
+
+    if (Tracer::isEnabled()) {
+        LOGI() << "tracing enabled, output: " << tracer->outputFilePath();
+    }
+
     //! --- Setup Invoker ---
 
     Invoker::setup();
@@ -179,6 +192,12 @@ void GlobalModule::onInit(const IApplication::RunMode&)
 void GlobalModule::onDeinit()
 {
     invokeQueuedCalls();
+
+    Tracer* tracer = Tracer::instance();
+    if (Tracer::isEnabled() && !tracer->outputFilePath().empty()) {
+        tracer->setEnabled(false);
+        tracer->save(tracer->outputFilePath());
+    }
 }
 
 void GlobalModule::invokeQueuedCalls()
@@ -190,3 +209,8 @@ void GlobalModule::setLoggerLevel(const haw::logger::Level& level)
 {
     m_loggerLevel = level;
 }
+
+void GlobalModule::setTraceFilePath(const std::string& filePath)
+{
+    m_traceFilePath = filePath;
+}
@@ -48,11 +48,13 @@ public:
     static void invokeQueuedCalls();
 
     void setLoggerLevel(const haw::logger::Level& level);
+    void setTraceFilePath(const std::string& filePath);
 
 private:
     std::shared_ptr<GlobalConfiguration> m_configuration;
 
     std::optional<haw::logger::Level> m_loggerLevel;
+    std::optional<std::string> m_traceFilePath;
 
     static std::shared_ptr<Invoker> s_asyncInvoker;
 };
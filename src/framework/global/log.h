@@ -26,6 +26,7 @@
 #include <cstdlib>
 #include <cassert>
 
+#include "tracer.h"
 #include "thirdparty/haw_profiler/src/profiler.h"
 #include "thirdparty/haw_logger/logger/log_base.h"
 
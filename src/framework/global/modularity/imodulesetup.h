@@ -36,6 +36,10 @@ public:
 
     virtual std::string moduleName() const = 0;
 
+    //! NOTE If true, in the console mode the module is initialized (onPreInit, onInit, onAllInited)
+    //! on the first resolve of one of its exports, instead of on startup
+    virtual bool isInitOnDemandAllowed() const { return false; }
+
     virtual void registerExports() {}
     virtual void resolveImports() {}
 
@@ -26,6 +26,7 @@
 #include <memory>
 #include <map>
 #include <string>
+#include <functional>
 #include <cassert>
 #include <iostream>
 
@@ -38,6 +39,14 @@ public:
 
     static ModulesIoC* instance();
 
+    //! NOTE Called with the source module of a service each time it is resolved,
+    //! used to initialize modules on demand
+    using ResolveHook = std::function<void (const std::string& sourceModule)>;
+    void setResolveHook(const ResolveHook& hook)
+    {
+        m_resolveHook = hook;
+    }
+
     // Register Export
     template<class I>
     void registerExportCreator(const std::string& module, IModuleCreator* c)
@@ -165,6 +174,7 @@ public:
     void reset()
     {
         m_map.clear();
+        m_resolveHook = nullptr;
     }
 
 private:
@@ -222,6 +232,10 @@ private:
         }
 
         Service& inj = it->second;
+        if (m_resolveHook) {
+            m_resolveHook(inj.sourceModule);
+        }
+
         if (inj.p) {
             return inj.p;
         }
@@ -240,6 +254,7 @@ private:
     };
 
     std::map<std::string_view, Service > m_map;
+    ResolveHook m_resolveHook;
 };
 
 template<class T>
@@ -0,0 +1,435 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "objectarena.h"
+
+#include <array>
+#include <cstdlib>
+#include <list>
+#include <new>
+#include <thread>
+
+using namespace mu;
+
+namespace {
+constexpr size_t HEADER_SIZE = 16;
+constexpr size_t GRANULARITY = 16;
+constexpr size_t SIZE_CLASSES = ObjectArena::MAX_SMALL_SIZE / GRANULARITY;
+
+thread_local ObjectArena* s_current = nullptr;
+
+std::atomic<uint64_t> s_lastArenaId = 0;
+
+//! NOTE Unlike std::thread::id, the token is never reused by a new thread
+std::atomic<uint64_t> s_lastThreadToken = 0;
+thread_local const uint64_t s_threadToken = ++s_lastThreadToken;
+
+std::mutex s_openArenasMutex;
+std::list<const ObjectArena*> s_openArenas;
+
+struct Chunk {
+    Chunk* next = nullptr;
+};
+
+//! NOTE Is placed right before every object; while a chunk is free, Chunk overlaps the cache field only,
+//! so the size and the slab of a free chunk stay known
+struct Header {
+    void* cache = nullptr; // ObjectArena::ThreadCache, nullptr - allocated on the heap
+    uint32_t size = 0;
+    uint32_t slab = 0;
+};
+
+inline size_t alignToGranularity(size_t n)
+{
+    return (n + GRANULARITY - 1) & ~(GRANULARITY - 1);
+}
+
+inline size_t chunkSizeOf(size_t size)
+{
+    return alignToGranularity(size + HEADER_SIZE);
+}
+}
+
+struct ObjectArena::Slab {
+    uint8_t* data = nullptr;
+    uint32_t chunkSize = 0;
+
+    //! NOTE Counted when the arena is closed, guarded by the arena mutex
+    int64_t remaining = 0;
+};
+
+struct ObjectArena::ThreadCache {
+    struct Bin {
+        Chunk* free = nullptr;
+        uint8_t* bump = nullptr;
+        uint8_t* bumpEnd = nullptr;
+        uint32_t slab = 0;
+
+        //! NOTE Objects freed on other threads, taken all at once by the owner
+        std::atomic<Chunk*> remoteFree = nullptr;
+    };
+
+    ObjectArena* arena = nullptr;
+    uint64_t owner = 0;
+    std::array<Bin, SIZE_CLASSES> bins;
+
+    //! NOTE Deallocations of the objects of this cache, that have not yet seen the arena closed
+    std::atomic<int> freeing = 0;
+
+    //! NOTE Written by the owner only, atomic just to be readable for statistics
+    std::atomic<int64_t> allocated = 0;
+    std::atomic<int64_t> freed = 0;
+
+    std::atomic<int64_t> remoteFreed = 0;
+};
+
+static_assert(sizeof(Header) <= HEADER_SIZE);
+static_assert(sizeof(Chunk) <= sizeof(void*));
+
+static inline Header* headerOf(void* ptr)
+{
+    return reinterpret_cast<Header*>(reinterpret_cast<uint8_t*>(ptr) - HEADER_SIZE);
+}
+
+static inline void* objectOf(Header* header)
+{
+    return reinterpret_cast<uint8_t*>(header) + HEADER_SIZE;
+}
+
+ObjectArena::ObjectArena(const std::string& name)
+    : m_id(++s_lastArenaId), m_name(name)
+{
+}
+
+ObjectArena::~ObjectArena()
+{
+    for (const Slab& slab : m_slabs) {
+        std::free(slab.data);
+    }
+}
+
+ObjectArena* ObjectArena::create(const std::string& name)
+{
+    ObjectArena* arena = new ObjectArena(name);
+
+    std::lock_guard lock(s_openArenasMutex);
+    s_openArenas.push_back(arena);
+
+    return arena;
+}
+
+void ObjectArena::close(ObjectArena* arena)
+{
+    if (!arena) {
+        return;
+    }
+
+    {
+        std::lock_guard lock(s_openArenasMutex);
+        s_openArenas.remove(arena);
+    }
+
+    if (s_current == arena) {
+        s_current = nullptr;
+    }
+
+    std::unique_lock lock(arena->m_mutex);
+
+    //! NOTE From here on the objects are counted per slab under the lock (see deallocate).
+    //! The deallocations, that have checked the flag before it was set, are waited for
+    arena->m_closed.store(true, std::memory_order_seq_cst);
+
+    for (const auto& pair : arena->m_caches) {
+        while (pair.second->freeing.load(std::memory_order_seq_cst) != 0) {
+            std::this_thread::yield();
+        }
+    }
+
+    arena->releaseUnusedSlabs();
+
+    const bool unused = arena->m_remaining == 0;
+    lock.unlock();
+
+    if (unused) {
+        destroy(arena);
+    }
+}
+
+void ObjectArena::releaseUnusedSlabs()
+{
+    for (Slab& slab : m_slabs) {
+        slab.remaining = (SLAB_SIZE / slab.chunkSize);
+    }
+
+    auto countFree = [this](const Chunk* chunk) {
+        for (; chunk; chunk = chunk->next) {
+            m_slabs[reinterpret_cast<const Header*>(chunk)->slab].remaining--;
+        }
+    };
+
+    for (const auto& pair : m_caches) {
+        ThreadCache* cache = pair.second.get();
+
+        for (ThreadCache::Bin& bin : cache->bins) {
+            if (bin.bump) {
+                m_slabs[bin.slab].remaining -= (bin.bumpEnd - bin.bump) / m_slabs[bin.slab].chunkSize;
+            }
+
+            countFree(bin.free);
+            countFree(bin.remoteFree.load(std::memory_order_acquire));
+        }
+    }
+
+    m_remaining = 0;
+
+    for (Slab& slab : m_slabs) {
+        if (slab.remaining == 0) {
+            std::free(slab.data);
+            slab.data = nullptr;
+        }
+
+        m_remaining += slab.remaining;
+    }
+}
+
+void ObjectArena::destroy(ObjectArena* arena)
+{
+    delete arena;
+}
+
+ObjectArena* ObjectArena::current()
+{
+    return s_current;
+}
+
+ObjectArena* ObjectArena::setCurrent(ObjectArena* arena)
+{
+    ObjectArena* prev = s_current;
+    s_current = arena;
+    return prev;
+}
+
+const std::string& ObjectArena::name() const
+{
+    return m_name;
+}
+
+ObjectArena::ThreadCache* ObjectArena::threadCache()
+{
+    thread_local uint64_t lastArenaId = 0;
+    thread_local ThreadCache* lastCache = nullptr;
+
+    if (lastArenaId == m_id) {
+        return lastCache;
+    }
+
+    std::lock_guard lock(m_mutex);
+
+    std::unique_ptr<ThreadCache>& cache = m_caches[s_threadToken];
+    if (!cache) {
+        cache = std::make_unique<ThreadCache>();
+        cache->arena = this;
+        cache->owner = s_threadToken;
+    }
+
+    lastArenaId = m_id;
+    lastCache = cache.get();
+
+    return lastCache;
+}
+
+void ObjectArena::newSlab(ThreadCache* cache, size_t sizeClass, size_t chunkSize)
+{
+    uint8_t* slab = static_cast<uint8_t*>(std::malloc(SLAB_SIZE));
+    if (!slab) {
+        throw std::bad_alloc();
+    }
+
+    ThreadCache::Bin& bin = cache->bins[sizeClass];
+
+    {
+        std::lock_guard lock(m_mutex);
+        bin.slab = static_cast<uint32_t>(m_slabs.size());
+        m_slabs.push_back({ slab, static_cast<uint32_t>(chunkSize), 0 });
+    }
+
+    bin.bump = slab;
+    bin.bumpEnd = slab + (SLAB_SIZE / chunkSize) * chunkSize;
+}
+
+void* ObjectArena::allocate(size_t size)
+{
+    ObjectArena* arena = s_current;
+    const size_t chunkSize = chunkSizeOf(size);
+
+    if (!arena || chunkSize > MAX_SMALL_SIZE || arena->m_closed.load(std::memory_order_relaxed)) {
+        Header* header = static_cast<Header*>(std::malloc(HEADER_SIZE + size));
+        if (!header) {
+            throw std::bad_alloc();
+        }
+
+        header->cache = nullptr;
+        header->size = static_cast<uint32_t>(size);
+        header->slab = 0;
+
+        return objectOf(header);
+    }
+
+    ThreadCache* cache = arena->threadCache();
+    const size_t sizeClass = chunkSize / GRANULARITY - 1;
+    ThreadCache::Bin& bin = cache->bins[sizeClass];
+
+    Chunk* chunk = bin.free;
+
+    if (!chunk) {
+        chunk = bin.remoteFree.exchange(nullptr, std::memory_order_acquire);
+    }
+
+    if (chunk) {
+        bin.free = chunk->next;
+    } else {
+        if (bin.bump == bin.bumpEnd) {
+            arena->newSlab(cache, sizeClass, chunkSize);
+        }
+
+        chunk = reinterpret_cast<Chunk*>(bin.bump);
+        bin.bump += chunkSize;
+    }
+
+    cache->allocated.store(cache->allocated.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    Header* header = reinterpret_cast<Header*>(chunk);
+    header->cache = cache;
+    header->size = static_cast<uint32_t>(size);
+    header->slab = bin.slab;
+
+    return objectOf(header);
+}
+
+size_t ObjectArena::deallocate(void* ptr)
+{
+    if (!ptr) {
+        return 0;
+    }
+
+    Header* header = headerOf(ptr);
+    const size_t size = header->size;
+    ThreadCache* cache = static_cast<ThreadCache*>(header->cache);
+
+    if (!cache) {
+        std::free(header);
+        return size;
+    }
+
+    ObjectArena* arena = cache->arena;
+
+    //! NOTE Pairs with close(): either the arena is seen closed here, or close() waits for this deallocation
+    cache->freeing.fetch_add(1, std::memory_order_seq_cst);
+
+    if (arena->m_closed.load(std::memory_order_seq_cst)) {
+        cache->freeing.fetch_sub(1, std::memory_order_release);
+        arena->deallocateClosed(header->slab);
+        return size;
+    }
+
+    Chunk* chunk = reinterpret_cast<Chunk*>(header);
+    ThreadCache::Bin& bin = cache->bins[chunkSizeOf(size) / GRANULARITY - 1];
+
+    if (cache->owner == s_threadToken) {
+        chunk->next = bin.free;
+        bin.free = chunk;
+        cache->freed.store(cache->freed.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    } else {
+        Chunk* head = bin.remoteFree.load(std::memory_order_relaxed);
+        do {
+            chunk->next = head;
+        } while (!bin.remoteFree.compare_exchange_weak(head, chunk, std::memory_order_release, std::memory_order_relaxed));
+
+        cache->remoteFreed.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    cache->freeing.fetch_sub(1, std::memory_order_release);
+
+    return size;
+}
+
+void ObjectArena::deallocateClosed(uint32_t slabIdx)
+{
+    std::unique_lock lock(m_mutex);
+
+    Slab& slab = m_slabs[slabIdx];
+    if (--slab.remaining == 0) {
+        std::free(slab.data);
+        slab.data = nullptr;
+    }
+
+    const bool unused = --m_remaining == 0;
+    lock.unlock();
+
+    if (unused) {
+        destroy(this);
+    }
+}
+
+int64_t ObjectArena::liveObjects() const
+{
+    std::lock_guard lock(m_mutex);
+
+    int64_t live = 0;
+    for (const auto& pair : m_caches) {
+        const ThreadCache* cache = pair.second.get();
+        live += cache->allocated.load(std::memory_order_relaxed)
+                - cache->freed.load(std::memory_order_relaxed)
+                - cache->remoteFreed.load(std::memory_order_relaxed);
+    }
+
+    return live;
+}
+
+ObjectArena::Info ObjectArena::stateInfo() const
+{
+    Info info;
+    info.name = m_name;
+    info.liveObjects = liveObjects();
+
+    std::lock_guard lock(m_mutex);
+    for (const Slab& slab : m_slabs) {
+        if (slab.data) {
+            info.slabCount++;
+        }
+    }
+
+    info.slabBytes = info.slabCount * SLAB_SIZE;
+
+    return info;
+}
+
+std::vector<ObjectArena::Info> ObjectArena::openArenasInfo()
+{
+    std::lock_guard lock(s_openArenasMutex);
+
+    std::vector<Info> result;
+    for (const ObjectArena* arena : s_openArenas) {
+        result.push_back(arena->stateInfo());
+    }
+
+    return result;
+}
@@ -0,0 +1,119 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_GLOBAL_OBJECTARENA_H
+#define MU_GLOBAL_OBJECTARENA_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace mu {
+//! NOTE Memory arena for the objects of one owner (a score and its excerpts), used by OBJECT_ALLOCATOR.
+//!
+//! Objects are allocated from the arena that is current for the calling thread (see Scope),
+//! or from the heap if there is none. Small objects are placed into slabs of their size class;
+//! every thread allocates from its own cache without locking, an object freed on another thread
+//! is handed back to the cache that owns it lock-free.
+//!
+//! Every allocation has a small header, so an object can be freed on any thread and at any time,
+//! no matter which arena (if any) is current. When the arena is closed, the slabs without live objects
+//! are released at once, every other slab as soon as the last of its objects is freed.
+class ObjectArena
+{
+public:
+    static ObjectArena* create(const std::string& name);
+
+    //! NOTE The owner must not use the arena on other threads while closing it
+    static void close(ObjectArena* arena);
+
+    static ObjectArena* current();
+    static ObjectArena* setCurrent(ObjectArena* arena);
+
+    class Scope
+    {
+    public:
+        explicit Scope(ObjectArena* arena)
+            : m_prev(ObjectArena::setCurrent(arena)) {}
+        ~Scope() { ObjectArena::setCurrent(m_prev); }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        ObjectArena* m_prev = nullptr;
+    };
+
+    //! NOTE Allocates from the current arena (or from the heap)
+    static void* allocate(size_t size);
+
+    //! NOTE Returns the size, that was requested on allocation
+    static size_t deallocate(void* ptr);
+
+    const std::string& name() const;
+
+    struct Info
+    {
+        std::string name;
+        size_t slabCount = 0;
+        size_t slabBytes = 0;
+        int64_t liveObjects = 0;
+    };
+
+    Info stateInfo() const;
+    static std::vector<Info> openArenasInfo();
+
+    static constexpr size_t SLAB_SIZE = 64 * 1024;
+    static constexpr size_t MAX_SMALL_SIZE = 1024;
+
+private:
+    struct ThreadCache;
+    struct Slab;
+
+    explicit ObjectArena(const std::string& name);
+    ~ObjectArena();
+
+    ThreadCache* threadCache();
+    void newSlab(ThreadCache* cache, size_t sizeClass, size_t chunkSize);
+    void releaseUnusedSlabs();
+    void deallocateClosed(uint32_t slabIdx);
+    int64_t liveObjects() const;
+
+    static void destroy(ObjectArena* arena);
+
+    const uint64_t m_id = 0;
+    const std::string m_name;
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<uint64_t, std::unique_ptr<ThreadCache> > m_caches; // by thread token
+    std::vector<Slab> m_slabs;
+
+    std::atomic<bool> m_closed = false;
+    int64_t m_remaining = 0; // live objects of the closed arena, guarded by m_mutex
+};
+}
+
+#endif // MU_GLOBAL_OBJECTARENA_H
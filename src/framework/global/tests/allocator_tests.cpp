@@ -21,6 +21,9 @@
  */
 #include <gtest/gtest.h>
 
+#include <set>
+#include <thread>
+
 #include "allocator.h"
 
 #include "log.h"
@@ -74,6 +77,7 @@ DECLARE_ITEM(3)
 DECLARE_ITEM(8)
 DECLARE_ITEM(13)
 DECLARE_ITEM(131)
+DECLARE_ITEM(2000)
 }
 
 class Global_AllocatorTests : public ::testing::Test
@@ -82,12 +86,21 @@ public:
 
     void SetUp() override
     {
-        ObjectAllocator::s_used++;
+        ObjectAllocator::setEnabled(true);
+    }
+
+    void TearDown() override
+    {
+        ObjectAllocator::setEnabled(false);
     }
 };
 
 TEST_F(Global_AllocatorTests, Single_NewDelete)
 {
+    //! GIVEN No arena, the item is allocated on the heap
+    ObjectAllocator::Info info = Item3::allocator().stateInfo();
+    uint64_t usedBefore = info.usedCount();
+
     //! DO Create Item
     ItemBase* item = new Item3(1);
 
@@ -97,102 +110,253 @@ TEST_F(Global_AllocatorTests, Single_NewDelete)
     EXPECT_EQ(item->wasDestroyed, 0);
 
     //! CHECK Allocator state
-    ObjectAllocator::Info info = Item3::allocator().stateInfo();
-    EXPECT_EQ(info.totalChunks - info.freeChunks, 1); // used 1 chunk
+    info = Item3::allocator().stateInfo();
+    EXPECT_EQ(info.usedCount(), usedBefore + 1);
+    EXPECT_GE(info.usedBytes(), sizeof(Item3));
 
     //! DO Destroy Item
     delete item;
 
-    //! CHECK
-    EXPECT_EQ(item->wasDestroyed, 1);
-
     //! CHECK Allocator state
     info = Item3::allocator().stateInfo();
-    EXPECT_EQ(info.totalChunks - info.freeChunks, 0); // used 0 chunk
+    EXPECT_EQ(info.usedCount(), usedBefore);
 }
 
-TEST_F(Global_AllocatorTests, Single_NewCleanup)
+TEST_F(Global_AllocatorTests, Arena_NewDelete)
 {
-    //! DO Create Item
-    ItemBase* item = new Item3(2);
+    //! GIVEN An arena
+    ObjectArena* arena = ObjectArena::create("test");
 
-    //! CHECK
-    EXPECT_TRUE(item);
-    EXPECT_TRUE(item->alive());
-    EXPECT_FALSE(item->wasDestroyed);
+    std::vector<ItemBase*> items;
+    {
+        ObjectArena::Scope scope(arena);
+
+        //! DO Create items of different sizes
+        for (size_t i = 0; i < 10; ++i) {
+            items.push_back(new Item8(static_cast<uint8_t>(i)));
+            items.push_back(new Item131(static_cast<uint8_t>(i)));
+        }
+    }
+
+    //! CHECK The items are alive and placed into the arena
+    for (ItemBase* item : items) {
+        EXPECT_TRUE(item->alive());
+    }
+
+    ObjectArena::Info info = arena->stateInfo();
+    EXPECT_EQ(info.liveObjects, 20);
+    EXPECT_EQ(info.slabCount, 2); // one per size class
 
-    //! DO Allocator cleanup
-    Item3::allocator().cleanup();
+    //! DO Delete a item and create a new one of the same size
+    void* freedAddress = items.front();
+    delete items.front();
+
+    {
+        ObjectArena::Scope scope(arena);
+        items.front() = new Item8(100);
+    }
+
+    //! CHECK The freed memory is reused
+    EXPECT_EQ(static_cast<void*>(items.front()), freedAddress);
+    EXPECT_EQ(arena->stateInfo().liveObjects, 20);
+
+    //! DO Delete all
+    for (ItemBase* item : items) {
+        delete item;
+    }
 
     //! CHECK
-    EXPECT_TRUE(item->wasDestroyed);
+    EXPECT_EQ(arena->stateInfo().liveObjects, 0);
+
+    ObjectArena::close(arena);
 }
 
-TEST_F(Global_AllocatorTests, Single_BigNewDelete)
+TEST_F(Global_AllocatorTests, Arena_BigItemOnHeap)
 {
-    //! GIVEN the default size of the allocator block is less than the size of an item
-    size_t itemSize = sizeof(Item131);
-    ObjectAllocator::DEFAULT_BLOCK_SIZE = itemSize - 16; // bytes
+    //! GIVEN An arena
+    ObjectArena* arena = ObjectArena::create("test");
+    ObjectArena::Scope scope(arena);
 
-    //! DO Create Item
-    ItemBase* item = new Item131(3);
+    //! DO Create an item, that is bigger than the biggest size class
+    ItemBase* item = new Item2000(1);
 
-    //! CHECK
-    EXPECT_TRUE(item);
+    //! CHECK It's allocated on the heap
     EXPECT_TRUE(item->alive());
-    EXPECT_EQ(item->wasDestroyed, 0);
+    EXPECT_EQ(arena->stateInfo().liveObjects, 0);
+    EXPECT_EQ(arena->stateInfo().slabCount, 0);
 
-    //! CHECK Allocator state
-    ObjectAllocator::Info info = Item131::allocator().stateInfo();
-    EXPECT_EQ(info.totalChunks, 1);
-    EXPECT_EQ(info.freeChunks, 0);
-
-    //! DO Destroy Item
     delete item;
 
+    ObjectArena::close(arena);
+}
+
+TEST_F(Global_AllocatorTests, Arena_DeleteOnOtherThread)
+{
+    //! GIVEN Items created in an arena
+    ObjectArena* arena = ObjectArena::create("test");
+
+    std::vector<ItemBase*> items;
+    {
+        ObjectArena::Scope scope(arena);
+        for (size_t i = 0; i < 10; ++i) {
+            items.push_back(new Item13(static_cast<uint8_t>(i)));
+        }
+    }
+
+    //! DO Delete them on another thread
+    std::thread thread([&items]() {
+        for (ItemBase* item : items) {
+            delete item;
+        }
+    });
+    thread.join();
+
     //! CHECK
-    EXPECT_EQ(item->wasDestroyed, 1);
+    EXPECT_EQ(arena->stateInfo().liveObjects, 0);
 
-    //! CHECK Allocator state
-    info = Item131::allocator().stateInfo();
-    EXPECT_EQ(info.totalChunks, 1);
-    EXPECT_EQ(info.freeChunks, 1);
+    //! DO Create new items
+    std::set<void*> freedAddresses(items.begin(), items.end());
+    items.clear();
+    {
+        ObjectArena::Scope scope(arena);
+        for (size_t i = 0; i < 10; ++i) {
+            items.push_back(new Item13(static_cast<uint8_t>(i)));
+        }
+    }
+
+    //! CHECK The memory freed on the other thread is reused
+    for (ItemBase* item : items) {
+        EXPECT_TRUE(freedAddresses.find(item) != freedAddresses.end());
+        delete item;
+    }
+
+    ObjectArena::close(arena);
 }
 
-TEST_F(Global_AllocatorTests, Many_NewCleanup)
+TEST_F(Global_AllocatorTests, Arena_CloseWithLiveItems)
 {
-    //! GIVEN the default size of the allocator block is less than the size of all items
-    size_t itemSize = sizeof(Item8);
-    ObjectAllocator::DEFAULT_BLOCK_SIZE = itemSize * 4;  // bytes
+    //! GIVEN Items created in an arena
+    ObjectArena* arena = ObjectArena::create("test");
+    ObjectArena::setCurrent(arena);
 
-    //! DO Create Items (more then one block size)
     std::vector<ItemBase*> items;
     for (size_t i = 0; i < 10; ++i) {
         items.push_back(new Item8(static_cast<uint8_t>(i)));
     }
 
-    //! CHECK
+    //! DO Close the arena
+    ObjectArena::close(arena);
+
+    //! CHECK It's not current anymore, new items are allocated on the heap
+    EXPECT_EQ(ObjectArena::current(), nullptr);
+
+    //! CHECK The items are still alive and can be deleted (the arena is released after the last one)
     for (ItemBase* item : items) {
-        EXPECT_TRUE(item);
         EXPECT_TRUE(item->alive());
-        EXPECT_EQ(item->wasDestroyed, 0);
+        delete item;
     }
+}
 
-    //! CHECK Allocator state
-    ObjectAllocator::Info info = Item8::allocator().stateInfo();
-    EXPECT_EQ(info.totalChunks, 12); // DEFAULT_BLOCK_SIZE * 3
-    EXPECT_EQ(info.freeChunks, 2);
+TEST_F(Global_AllocatorTests, Arena_CloseReleasesUnusedSlabs)
+{
+    //! GIVEN Items created in an arena, that take several slabs
+    ObjectArena* arena = ObjectArena::create("test");
 
-    //! DO Allocator cleanup
-    Item8::allocator().cleanup();
+    std::vector<ItemBase*> items;
+    {
+        ObjectArena::Scope scope(arena);
+        for (size_t i = 0; i < 1000; ++i) {
+            items.push_back(new Item131(static_cast<uint8_t>(i)));
+        }
+    }
 
-    //! CHECK
-    for (const ItemBase* item : items) {
-        EXPECT_EQ(item->wasDestroyed, 1);
+    ASSERT_GT(arena->stateInfo().slabCount, 2);
+
+    //! DO Delete all of them but the first one, and close the arena
+    for (size_t i = 1; i < items.size(); ++i) {
+        delete items[i];
     }
 
-    //! CHECK Allocator state
-    info = Item8::allocator().stateInfo();
-    EXPECT_EQ(info.totalChunks, 12); // DEFAULT_BLOCK_SIZE * 3
-    EXPECT_EQ(info.freeChunks, 12);
+    ObjectArena::close(arena);
+
+    //! CHECK Only the slab of the live item is kept
+    EXPECT_EQ(arena->stateInfo().slabCount, 1);
+
+    EXPECT_TRUE(items.front()->alive());
+    delete items.front();
+}
+
+TEST_F(Global_AllocatorTests, Arena_DeleteOnOtherThreadWhileClosing)
+{
+    //! GIVEN Items created in an arena
+    ObjectArena* arena = ObjectArena::create("test");
+
+    std::vector<ItemBase*> items;
+    {
+        ObjectArena::Scope scope(arena);
+        for (size_t i = 0; i < 10000; ++i) {
+            items.push_back(new Item13(static_cast<uint8_t>(i)));
+        }
+    }
+
+    //! DO Delete them on another thread, while the arena is being closed
+    std::thread thread([&items]() {
+        for (ItemBase* item : items) {
+            delete item;
+        }
+    });
+
+    ObjectArena::close(arena);
+    thread.join();
+
+    //! CHECK Every item is counted exactly once: the arena is released after the last one (checked by the sanitizers)
+}
+
+TEST_F(Global_AllocatorTests, Arena_ConcurrentNewDelete)
+{
+    //! GIVEN An arena used by several threads
+    ObjectArena* arena = ObjectArena::create("test");
+
+    constexpr size_t THREADS = 4;
+    std::vector<std::vector<ItemBase*> > items(THREADS);
+    std::vector<std::thread> threads;
+
+    //! DO Create items on every thread, and delete half of them on the next thread
+    for (size_t t = 0; t < THREADS; ++t) {
+        threads.emplace_back([arena, &items, t]() {
+            ObjectArena::Scope scope(arena);
+            for (size_t i = 0; i < 1000; ++i) {
+                ItemBase* item = (i % 2) ? static_cast<ItemBase*>(new Item8(1)) : static_cast<ItemBase*>(new Item131(1));
+                if (i % 3 == 0) {
+                    delete item;
+                } else {
+                    items[t].push_back(item);
+                }
+            }
+        });
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    threads.clear();
+
+    for (size_t t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&items, t]() {
+            for (ItemBase* item : items[(t + 1) % THREADS]) {
+                EXPECT_TRUE(item->alive());
+                delete item;
+            }
+        });
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    //! CHECK
+    EXPECT_EQ(arena->stateInfo().liveObjects, 0);
+
+    ObjectArena::close(arena);
 }
@@ -0,0 +1,137 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "async/coalescedchannel.h"
+#include "async/processevents.h"
+
+using namespace mu::async;
+
+namespace mu {
+class Global_CoalescedChannelTests : public ::testing::Test, public Asyncable
+{
+};
+
+TEST_F(Global_CoalescedChannelTests, Notification_OncePerTurn)
+{
+    //! [GIVEN] A coalesced notification with a receiver
+    CoalescedNotification notification("test");
+
+    int received = 0;
+    notification.onNotify(this, [&received]() {
+        ++received;
+    });
+
+    //! [WHEN] Notify several times during one turn
+    notification.notify();
+    notification.notify();
+    notification.notify();
+
+    //! [THEN] Nothing is delivered until the next turn
+    EXPECT_EQ(received, 0);
+    EXPECT_TRUE(notification.hasPending());
+
+    processEvents();
+
+    //! [THEN] The receiver is called once
+    EXPECT_EQ(received, 1);
+    EXPECT_FALSE(notification.hasPending());
+    EXPECT_EQ(notification.metrics().sendCount, 3u);
+    EXPECT_EQ(notification.metrics().deliverCount, 1u);
+
+    //! [WHEN] Notify again
+    notification.notify();
+    processEvents();
+
+    //! [THEN] The receiver is called again
+    EXPECT_EQ(received, 2);
+}
+
+TEST_F(Global_CoalescedChannelTests, Channel_LastWins)
+{
+    CoalescedChannel<int> channel("test");
+
+    std::vector<int> received;
+    channel.onReceive(this, [&received](int val) {
+        received.push_back(val);
+    });
+
+    channel.send(1);
+    channel.send(2);
+    channel.send(3);
+    processEvents();
+
+    EXPECT_EQ(received, std::vector<int>({ 3 }));
+}
+
+TEST_F(Global_CoalescedChannelTests, Channel_Merge)
+{
+    //! [GIVEN] A channel that sums the pending values
+    CoalescedChannel<int> channel("test", [](std::tuple<int>& pending, const int& next) {
+        std::get<0>(pending) += next;
+    });
+
+    std::vector<int> received;
+    channel.onReceive(this, [&received](int val) {
+        received.push_back(val);
+    });
+
+    //! [WHEN] Send several values during one turn
+    channel.send(1);
+    channel.send(2);
+    channel.send(3);
+    processEvents();
+
+    //! [THEN] The merged value is delivered once
+    EXPECT_EQ(received, std::vector<int>({ 6 }));
+}
+
+TEST_F(Global_CoalescedChannelTests, Channel_FlushAndCancel)
+{
+    CoalescedChannel<int> channel("test");
+
+    std::vector<int> received;
+    channel.onReceive(this, [&received](int val) {
+        received.push_back(val);
+    });
+
+    //! [WHEN] Flush explicitly
+    channel.send(1);
+    channel.flush();
+
+    //! [THEN] Delivered right away, and not delivered again on the next turn
+    EXPECT_EQ(received, std::vector<int>({ 1 }));
+    processEvents();
+    EXPECT_EQ(received, std::vector<int>({ 1 }));
+
+    //! [WHEN] Cancel the pending data
+    channel.send(2);
+    channel.cancel();
+    processEvents();
+
+    //! [THEN] Nothing is delivered
+    EXPECT_EQ(received, std::vector<int>({ 1 }));
+}
+}
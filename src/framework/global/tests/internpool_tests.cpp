@@ -0,0 +1,157 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "types/internpool.h"
+#include "types/sharedmap.h"
+
+using namespace mu;
+
+namespace {
+using IntMap = SharedMap<int, int>;
+
+struct IntMapHash
+{
+    size_t operator()(const IntMap& map) const
+    {
+        size_t result = map.size();
+        for (const auto& pair : map) {
+            result = result * 31 + static_cast<size_t>(pair.first * 7 + pair.second);
+        }
+        return result;
+    }
+};
+
+using IntMapPool = InternPool<IntMap, IntMapHash>;
+
+IntMap makeMap(const std::vector<std::pair<int, int> >& values)
+{
+    IntMap result;
+    for (const auto& pair : values) {
+        result.insert(pair);
+    }
+    return result;
+}
+}
+
+class Global_Types_InternPoolTests : public ::testing::Test
+{
+public:
+};
+
+TEST_F(Global_Types_InternPoolTests, DefaultConstructedMapsShareData)
+{
+    // [GIVEN] Two default constructed maps
+    IntMap map1;
+    IntMap map2;
+
+    // [THEN] They share the same empty data
+    EXPECT_TRUE(map1.isSharedWith(map2));
+
+    // [WHEN] One of them is modified
+    map1.insert({ 1, 1 });
+
+    // [THEN] It's detached, the other one stays empty
+    EXPECT_FALSE(map1.isSharedWith(map2));
+    EXPECT_TRUE(map2.empty());
+    EXPECT_EQ(map1.size(), 1u);
+
+    // [WHEN] It's cleared
+    map1.clear();
+
+    // [THEN]
+    EXPECT_TRUE(map1.empty());
+    EXPECT_EQ(map1, map2);
+}
+
+TEST_F(Global_Types_InternPoolTests, EqualValuesAreShared)
+{
+    // [GIVEN] Two equal maps with own data, and a different one
+    IntMapPool pool;
+
+    IntMap map1 = makeMap({ { 0, 10 }, { 50, 20 } });
+    IntMap map2 = makeMap({ { 0, 10 }, { 50, 20 } });
+    IntMap map3 = makeMap({ { 0, 10 }, { 50, 30 } });
+    ASSERT_FALSE(map1.isSharedWith(map2));
+
+    // [WHEN] Interning them
+    IntMap interned1 = pool.intern(map1);
+    IntMap interned2 = pool.intern(map2);
+    IntMap interned3 = pool.intern(map3);
+
+    // [THEN] The equal ones share the data of the first one
+    EXPECT_TRUE(interned1.isSharedWith(map1));
+    EXPECT_TRUE(interned2.isSharedWith(map1));
+    EXPECT_FALSE(interned3.isSharedWith(map1));
+    EXPECT_EQ(pool.size(), 2u);
+
+    // [WHEN] An interned copy is modified
+    interned2.insert_or_assign(100, 0);
+
+    // [THEN] The pooled value is untouched
+    EXPECT_EQ(pool.intern(map2), map1);
+    EXPECT_EQ(interned2.size(), 3u);
+}
+
+TEST_F(Global_Types_InternPoolTests, SizeIsLimited)
+{
+    // [GIVEN] A pool that can hold only a few values
+    IntMapPool pool(16);
+
+    // [WHEN] Interning more distinct values
+    for (int i = 0; i < 100; ++i) {
+        IntMap map = makeMap({ { 0, i } });
+        IntMap interned = pool.intern(map);
+
+        // [THEN] The values are still returned correctly
+        EXPECT_EQ(interned, map);
+    }
+
+    // [THEN] But not all of them are stored
+    EXPECT_LE(pool.size(), 16u);
+}
+
+TEST_F(Global_Types_InternPoolTests, CopiesAreDetachedOnWrite)
+{
+    // [GIVEN] A map with own data and a copy of it
+    IntMap map1 = makeMap({ { 0, 10 } });
+    IntMap map2 = map1;
+    ASSERT_TRUE(map1.isSharedWith(map2));
+
+    // [WHEN] The original is modified
+    map1.insert({ 50, 20 });
+
+    // [THEN] It's detached, the copy is untouched
+    EXPECT_FALSE(map1.isSharedWith(map2));
+    EXPECT_EQ(map2.size(), 1u);
+
+    // [WHEN] A copy is taken and released before the write
+    IntMap map3 = makeMap({ { 0, 10 } });
+    IntMap pooled = IntMapPool().intern(map3);
+    pooled.insert({ 50, 20 });
+
+    // [THEN] The write still detaches, the original is untouched
+    EXPECT_FALSE(pooled.isSharedWith(map3));
+    EXPECT_EQ(map3.size(), 1u);
+}
@@ -0,0 +1,234 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "concurrency/taskscheduler.h"
+
+namespace mu {
+class Global_TaskSchedulerTests : public ::testing::Test
+{
+public:
+};
+
+TEST_F(Global_TaskSchedulerTests, Submit_ReturnsResults)
+{
+    TaskScheduler scheduler(4);
+
+    std::vector<std::future<int> > futures;
+    for (int i = 0; i < 100; ++i) {
+        futures.push_back(scheduler.submit([](int v) { return v * 2; }, i));
+    }
+
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(futures[i].get(), i * 2);
+    }
+}
+
+TEST_F(Global_TaskSchedulerTests, WaitForAllTasksComplete)
+{
+    TaskScheduler scheduler(3);
+
+    std::atomic<int> counter = 0;
+    for (int i = 0; i < 1000; ++i) {
+        scheduler.push([&counter]() { counter.fetch_add(1); });
+    }
+
+    scheduler.waitForAllTasksComplete();
+
+    EXPECT_EQ(counter.load(), 1000);
+
+    TaskScheduler::Statistics stat = scheduler.statistics();
+    EXPECT_EQ(stat.queuedTasks, 0);
+    EXPECT_EQ(stat.runningTasks, 0);
+    EXPECT_EQ(stat.executedTasks, 1000);
+    EXPECT_EQ(stat.workers.size(), scheduler.threadPoolSize());
+}
+
+TEST_F(Global_TaskSchedulerTests, WaitForAllTasksComplete_ConcurrentEnqueue)
+{
+    TaskScheduler scheduler(4);
+
+    //! GIVEN Several threads push tasks while the workers are stealing them
+    std::atomic<int> counter = 0;
+    std::vector<std::thread> producers;
+    for (int p = 0; p < 4; ++p) {
+        producers.emplace_back([&scheduler, &counter]() {
+            for (int i = 0; i < 5000; ++i) {
+                scheduler.push([&counter]() { counter.fetch_add(1); });
+            }
+        });
+    }
+
+    for (std::thread& t : producers) {
+        t.join();
+    }
+
+    //! WHEN Waiting for all of them
+    scheduler.waitForAllTasksComplete();
+
+    //! THEN The wait returns and the counters are consistent
+    EXPECT_EQ(counter.load(), 20000);
+
+    TaskScheduler::Statistics stat = scheduler.statistics();
+    EXPECT_EQ(stat.queuedTasks, 0);
+    EXPECT_EQ(stat.runningTasks, 0);
+    EXPECT_EQ(stat.executedTasks, 20000);
+}
+
+TEST_F(Global_TaskSchedulerTests, Priorities_HigherFirst)
+{
+    TaskScheduler scheduler(1);
+
+    //! GIVEN The only worker is busy
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::promise<void> started;
+    scheduler.push([released, &started]() {
+        started.set_value();
+        released.wait();
+    });
+    started.get_future().wait();
+
+    //! DO Push tasks of all priorities, lowest first
+    std::mutex mutex;
+    std::vector<TaskPriority> order;
+    auto record = [&mutex, &order](TaskPriority p) {
+        std::lock_guard lock(mutex);
+        order.push_back(p);
+    };
+
+    scheduler.push(TaskPriority::Background, record, TaskPriority::Background);
+    scheduler.push(TaskPriority::Interactive, record, TaskPriority::Interactive);
+    scheduler.push(TaskPriority::RealTime, record, TaskPriority::RealTime);
+
+    release.set_value();
+    scheduler.waitForAllTasksComplete();
+
+    //! CHECK
+    ASSERT_EQ(order.size(), 3);
+    EXPECT_EQ(order[0], TaskPriority::RealTime);
+    EXPECT_EQ(order[1], TaskPriority::Interactive);
+    EXPECT_EQ(order[2], TaskPriority::Background);
+}
+
+TEST_F(Global_TaskSchedulerTests, ParallelFor)
+{
+    TaskScheduler scheduler(4);
+
+    std::vector<int> values(10000, 0);
+    scheduler.parallelFor(0, values.size(), [&values](size_t i) {
+        values[i] = static_cast<int>(i);
+    }, 64);
+
+    for (size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ(values[i], static_cast<int>(i));
+    }
+
+    //! NOTE Nested call from a worker must not deadlock
+    std::atomic<int> sum = 0;
+    scheduler.parallelFor(0, 8, [&scheduler, &sum](size_t) {
+        scheduler.parallelFor(0, 100, [&sum](size_t) { sum.fetch_add(1); });
+    });
+
+    EXPECT_EQ(sum.load(), 800);
+}
+
+TEST_F(Global_TaskSchedulerTests, TaskGroup)
+{
+    TaskScheduler scheduler(2);
+
+    std::atomic<int> counter = 0;
+    {
+        TaskScheduler::TaskGroup group(&scheduler);
+        for (int i = 0; i < 50; ++i) {
+            group.run([&counter]() { counter.fetch_add(1); });
+        }
+        group.wait();
+
+        EXPECT_EQ(counter.load(), 50);
+    }
+}
+
+TEST_F(Global_TaskSchedulerTests, ParallelFor_CallerRunsOnlyItsOwnWork)
+{
+    TaskScheduler scheduler(1);
+
+    //! GIVEN The only worker is busy and an unrelated task is queued
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::promise<void> started;
+    scheduler.push([released, &started]() {
+        started.set_value();
+        released.wait();
+    });
+    started.get_future().wait();
+
+    std::thread::id unrelatedThread;
+    scheduler.push(TaskPriority::RealTime, [&unrelatedThread]() {
+        unrelatedThread = std::this_thread::get_id();
+    });
+
+    //! DO
+    std::atomic<int> sum = 0;
+    scheduler.parallelFor(0, 100, [&sum](size_t) { sum.fetch_add(1); });
+
+    //! CHECK The loop is done without the worker, the unrelated task stays for the worker
+    EXPECT_EQ(sum.load(), 100);
+
+    release.set_value();
+    scheduler.waitForAllTasksComplete();
+
+    EXPECT_NE(unrelatedThread, std::thread::id());
+    EXPECT_NE(unrelatedThread, std::this_thread::get_id());
+}
+
+TEST_F(Global_TaskSchedulerTests, Exceptions_AreRethrownOnWait)
+{
+    TaskScheduler scheduler(2);
+
+    EXPECT_THROW(scheduler.parallelFor(0, 100, [](size_t i) {
+        if (i == 50) {
+            throw std::runtime_error("parallelFor");
+        }
+    }), std::runtime_error);
+
+    std::atomic<int> counter = 0;
+    TaskScheduler::TaskGroup group(&scheduler);
+    group.run([]() { throw std::runtime_error("group"); });
+    group.run([&counter]() { counter.fetch_add(1); });
+    EXPECT_THROW(group.wait(), std::runtime_error);
+    EXPECT_EQ(counter.load(), 1);
+
+    //! NOTE The group can be used again after wait
+    group.run([&counter]() { counter.fetch_add(1); });
+    group.wait();
+    EXPECT_EQ(counter.load(), 2);
+}
+}
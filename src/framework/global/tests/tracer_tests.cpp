@@ -0,0 +1,154 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include "tracer.h"
+#include "runtime.h"
+
+namespace mu {
+class Global_TracerTests : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        Tracer::instance()->setEnabled(false);
+        Tracer::instance()->clear();
+    }
+
+    void TearDown() override
+    {
+        Tracer::instance()->setEnabled(false);
+        Tracer::instance()->clear();
+    }
+
+    static const Tracer::ThreadInfo* findThread(const std::vector<Tracer::ThreadInfo>& threads, const std::string& name)
+    {
+        for (const Tracer::ThreadInfo& th : threads) {
+            if (th.name == name) {
+                return &th;
+            }
+        }
+        return nullptr;
+    }
+};
+
+TEST_F(Global_TracerTests, Disabled_NoEvents)
+{
+    static const std::string name("disabled");
+    {
+        TraceScope scope(name);
+    }
+
+    for (const Tracer::ThreadInfo& th : Tracer::instance()->threadsData()) {
+        EXPECT_TRUE(th.events.empty());
+    }
+}
+
+TEST_F(Global_TracerTests, Enabled_BeginEndPerThread)
+{
+    static const std::string outer("outer");
+    static const std::string inner("inner");
+
+    Tracer::instance()->setEnabled(true);
+
+    std::thread worker([]() {
+        runtime::setThreadName("tracer_test_worker");
+        TraceScope scope(outer);
+    });
+    worker.join();
+
+    {
+        TraceScope o(outer);
+        TraceScope i(inner);
+    }
+
+    Tracer::instance()->setEnabled(false);
+
+    std::vector<Tracer::ThreadInfo> threads = Tracer::instance()->threadsData();
+
+    const Tracer::ThreadInfo* workerInfo = findThread(threads, "tracer_test_worker");
+    ASSERT_TRUE(workerInfo);
+    ASSERT_EQ(workerInfo->events.size(), 2);
+    EXPECT_EQ(workerInfo->events[0].phase, Tracer::Phase::Begin);
+    EXPECT_EQ(workerInfo->events[1].phase, Tracer::Phase::End);
+
+    const Tracer::ThreadInfo* mainInfo = findThread(threads, runtime::threadName());
+    ASSERT_TRUE(mainInfo);
+    ASSERT_EQ(mainInfo->events.size(), 4);
+    EXPECT_EQ(*mainInfo->events[0].name, "outer");
+    EXPECT_EQ(*mainInfo->events[1].name, "inner");
+    EXPECT_EQ(mainInfo->events[2].phase, Tracer::Phase::End);
+    EXPECT_EQ(*mainInfo->events[2].name, "inner");
+    EXPECT_LE(mainInfo->events[0].timeNs, mainInfo->events[3].timeNs);
+}
+
+TEST_F(Global_TracerTests, ChromeTraceJson)
+{
+    static const std::string name("func \"quoted\"");
+
+    Tracer::instance()->setEnabled(true);
+    {
+        TraceScope scope(name);
+    }
+    Tracer::instance()->setEnabled(false);
+
+    std::string json = Tracer::instance()->toChromeTraceJson();
+
+    EXPECT_EQ(json.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["), 0);
+    EXPECT_NE(json.find("\"name\":\"thread_name\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"func \\\"quoted\\\"\",\"ph\":\"B\""), std::string::npos);
+    EXPECT_NE(json.find("\"ph\":\"E\""), std::string::npos);
+}
+
+TEST_F(Global_TracerTests, ThreadsData_WhileRecording)
+{
+    static const std::string name("wrapping");
+
+    Tracer::instance()->setEnabled(true);
+
+    std::atomic<bool> stop = false;
+    std::thread worker([&stop]() {
+        runtime::setThreadName("tracer_test_writer");
+        while (!stop.load()) {
+            TraceScope scope(name);
+        }
+    });
+
+    //! NOTE The writer wraps its buffer meanwhile, a read never returns a torn event
+    for (int i = 0; i < 100; ++i) {
+        for (const Tracer::ThreadInfo& th : Tracer::instance()->threadsData()) {
+            for (const Tracer::Event& e : th.events) {
+                EXPECT_TRUE(e.name);
+            }
+        }
+    }
+
+    stop.store(true);
+    worker.join();
+
+    Tracer::instance()->setEnabled(false);
+}
+}
@@ -0,0 +1,282 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "tracer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "runtime.h"
+#include "io/file.h"
+#include "types/bytearray.h"
+#include "types/ret.h"
+
+#include "log.h"
+
+using namespace mu;
+
+std::atomic<bool> Tracer::s_enabled = false;
+
+static int64_t nowNs()
+{
+    using namespace std::chrono;
+    static const steady_clock::time_point epoch = steady_clock::now();
+    return duration_cast<nanoseconds>(steady_clock::now() - epoch).count();
+}
+
+static size_t roundUpToPowerOfTwo(size_t value)
+{
+    size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+static void appendJsonString(std::string& out, const std::string& str)
+{
+    out += '"';
+    for (char c : str) {
+        switch (c) {
+        case '"': out += "\\\"";
+            break;
+        case '\\': out += "\\\\";
+            break;
+        case '\n': out += "\\n";
+            break;
+        case '\r': out += "\\r";
+            break;
+        case '\t': out += "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char buf[8];
+                std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+                out += buf;
+            } else {
+                out += c;
+            }
+        }
+    }
+    out += '"';
+}
+
+Tracer* Tracer::instance()
+{
+    static Tracer t;
+    return &t;
+}
+
+void Tracer::setEnabled(bool arg)
+{
+    //! NOTE Start the clock before the first event
+    nowNs();
+    s_enabled.store(arg, std::memory_order_relaxed);
+}
+
+void Tracer::setBufferCapacity(size_t eventsPerThread)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_bufferCapacity = roundUpToPowerOfTwo(std::max<size_t>(eventsPerThread, 2));
+}
+
+size_t Tracer::bufferCapacity() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_bufferCapacity;
+}
+
+void Tracer::setupFromEnvironment()
+{
+    const char* filePath = std::getenv("MU_TRACE_FILE");
+    if (filePath && filePath[0] != '\0') {
+        setOutputFilePath(filePath);
+        setEnabled(true);
+    }
+}
+
+void Tracer::setOutputFilePath(const std::string& filePath)
+{
+    m_outputFilePath = filePath;
+}
+
+const std::string& Tracer::outputFilePath() const
+{
+    return m_outputFilePath;
+}
+
+Tracer::ThreadBuffer* Tracer::threadBuffer()
+{
+    //! NOTE Buffers are owned by the tracer and outlive their threads,
+    //! so events of finished threads are still exported
+    static thread_local ThreadBuffer* t_buffer = nullptr;
+    if (t_buffer) {
+        return t_buffer;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::unique_ptr<ThreadBuffer> buffer = std::make_unique<ThreadBuffer>();
+    buffer->threadId = std::this_thread::get_id();
+    buffer->threadName = runtime::threadName();
+    buffer->tid = static_cast<int>(m_buffers.size()) + 1;
+    buffer->slots = std::make_unique<Slot[]>(m_bufferCapacity);
+    buffer->capacity = m_bufferCapacity;
+    buffer->mask = m_bufferCapacity - 1;
+
+    t_buffer = buffer.get();
+    m_buffers.push_back(std::move(buffer));
+
+    return t_buffer;
+}
+
+void Tracer::record(const std::string* name, Phase phase)
+{
+    //! NOTE Only the owning thread writes into its buffer, readers synchronize on head and on the slot sequence
+    ThreadBuffer* buffer = threadBuffer();
+    uint64_t head = buffer->head.load(std::memory_order_relaxed);
+
+    Slot& slot = buffer->slots[head & buffer->mask];
+    slot.seq.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.timeNs.store(nowNs(), std::memory_order_relaxed);
+    slot.phase.store(phase, std::memory_order_relaxed);
+    slot.seq.store(head + 1, std::memory_order_release);
+
+    buffer->head.store(head + 1, std::memory_order_release);
+}
+
+void Tracer::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (std::unique_ptr<ThreadBuffer>& buffer : m_buffers) {
+        buffer->head.store(0, std::memory_order_release);
+    }
+}
+
+std::vector<Tracer::ThreadInfo> Tracer::threadsData() const
+{
+    std::vector<ThreadInfo> result;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    result.reserve(m_buffers.size());
+
+    for (const std::unique_ptr<ThreadBuffer>& buffer : m_buffers) {
+        ThreadInfo info;
+        info.tid = buffer->tid;
+        info.name = buffer->threadName;
+
+        uint64_t head = buffer->head.load(std::memory_order_acquire);
+        uint64_t count = std::min<uint64_t>(head, buffer->capacity);
+        info.events.reserve(count);
+        for (uint64_t i = head - count; i < head; ++i) {
+            const Slot& slot = buffer->slots[i & buffer->mask];
+
+            uint64_t seq = slot.seq.load(std::memory_order_acquire);
+            Event event;
+            event.name = slot.name.load(std::memory_order_relaxed);
+            event.timeNs = slot.timeNs.load(std::memory_order_relaxed);
+            event.phase = slot.phase.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            //! NOTE The owner has wrapped around and is overwriting the slot, the event is lost
+            if (seq != i + 1 || slot.seq.load(std::memory_order_relaxed) != seq) {
+                continue;
+            }
+
+            info.events.push_back(event);
+        }
+
+        result.push_back(std::move(info));
+    }
+
+    return result;
+}
+
+std::string Tracer::toChromeTraceJson() const
+{
+    std::vector<ThreadInfo> threads = threadsData();
+
+    std::string out;
+    out.reserve(1024 * 1024);
+    out += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    bool first = true;
+    auto beginEvent = [&out, &first]() {
+        if (!first) {
+            out += ",\n";
+        }
+        first = false;
+    };
+
+    char buf[64];
+    for (const ThreadInfo& th : threads) {
+        beginEvent();
+        std::snprintf(buf, sizeof(buf), "{\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"name\":\"thread_name\",\"args\":{\"name\":", th.tid);
+        out += buf;
+        appendJsonString(out, th.name);
+        out += "}}";
+
+        //! NOTE After the ring buffer has wrapped, the oldest ends may have lost their begins
+        int depth = 0;
+        for (const Event& e : th.events) {
+            if (e.phase == Phase::Begin) {
+                ++depth;
+            } else if (e.phase == Phase::End) {
+                if (depth == 0) {
+                    continue;
+                }
+                --depth;
+            }
+
+            beginEvent();
+            out += "{\"name\":";
+            appendJsonString(out, e.name ? *e.name : std::string());
+            std::snprintf(buf, sizeof(buf), ",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%d", static_cast<char>(e.phase),
+                          static_cast<double>(e.timeNs) / 1000.0, th.tid);
+            out += buf;
+            if (e.phase == Phase::Instant) {
+                out += ",\"s\":\"t\"";
+            }
+            out += "}";
+        }
+    }
+
+    out += "]}\n";
+
+    return out;
+}
+
+bool Tracer::save(const std::string& filePath) const
+{
+    std::string json = toChromeTraceJson();
+    Ret ret = io::File::writeFile(filePath, ByteArray::fromRawData(json.c_str(), json.size()));
+    if (!ret) {
+        LOGE() << "failed save trace to: " << filePath << ", err: " << ret.toString();
+        return false;
+    }
+
+    LOGI() << "trace saved to: " << filePath;
+    return true;
+}
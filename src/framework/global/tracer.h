@@ -0,0 +1,189 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_GLOBAL_TRACER_H
+#define MU_GLOBAL_TRACER_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+//! NOTE The tracer hooks into the profiler macros (they are guarded with #ifndef),
+//! so every TRACEFUNC / TRACEFUNC_C / BEGIN_STEP_TIME / STEP_TIME also becomes a trace event.
+//! When capture is disabled the cost is one relaxed atomic load per scope.
+#ifdef HAW_PROFILER_ENABLED
+
+#ifndef TRACEFUNC
+#define TRACEFUNC \
+    static std::string __func_info(haw::profiler::FuncMarker::formatSig(FUNC_INFO)); \
+    haw::profiler::FuncMarker __funcMarker(__func_info); \
+    mu::TraceScope __traceScope(__func_info);
+#endif
+
+#ifndef TRACEFUNC_C
+#define TRACEFUNC_C(info) \
+    static std::string __func_info(info); \
+    haw::profiler::FuncMarker __funcMarkerInfo(__func_info); \
+    mu::TraceScope __traceScopeInfo(__func_info);
+#endif
+
+//! NOTE The name of a step is interned once per call site, the tag and info of a site are expected to be constant
+#ifndef BEGIN_STEP_TIME
+#define BEGIN_STEP_TIME(tag) \
+    if (haw::profiler::Profiler::options().stepTimeEnabled) \
+    { haw::profiler::Profiler::instance()->stepTime(tag, std::string("Begin"), true); } \
+    if (mu::Tracer::isEnabled()) \
+    { static const std::string __traceStepName(tag); mu::Tracer::instance()->instant(__traceStepName); }
+#endif
+
+#ifndef STEP_TIME
+#define STEP_TIME(tag, info) \
+    if (haw::profiler::Profiler::options().stepTimeEnabled) \
+    { haw::profiler::Profiler::instance()->stepTime(tag, info); } \
+    if (mu::Tracer::isEnabled()) \
+    { static const std::string __traceStepName(std::string(tag) + ": " + info); mu::Tracer::instance()->instant(__traceStepName); }
+#endif
+
+#endif // HAW_PROFILER_ENABLED
+
+namespace mu {
+class Tracer
+{
+public:
+
+    static Tracer* instance();
+
+    enum class Phase : char {
+        Begin = 'B',
+        End = 'E',
+        Instant = 'i'
+    };
+
+    struct Event {
+        const std::string* name = nullptr;
+        int64_t timeNs = 0;
+        Phase phase = Phase::Instant;
+    };
+
+    struct ThreadInfo {
+        int tid = 0;
+        std::string name;
+        std::vector<Event> events;
+    };
+
+    static constexpr size_t DEFAULT_BUFFER_CAPACITY = 1 << 16;
+
+    //! NOTE There is no sampling, every event is recorded while enabled (sampling would unbalance the scopes);
+    //! a thread buffer keeps its latest bufferCapacity() events, the older ones are overwritten
+    static bool isEnabled()
+    {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+
+    void setEnabled(bool arg);
+
+    //! NOTE Applies to thread buffers created after the call, rounded up to a power of two
+    void setBufferCapacity(size_t eventsPerThread);
+    size_t bufferCapacity() const;
+
+    //! NOTE MU_TRACE_FILE=<path> enables capture at startup and sets the output file
+    void setupFromEnvironment();
+
+    void setOutputFilePath(const std::string& filePath);
+    const std::string& outputFilePath() const;
+
+    //! NOTE Only the address of the name is recorded, so it must outlive the capture (e.g. a static)
+    void begin(const std::string& name) { record(&name, Phase::Begin); }
+    void end(const std::string& name) { record(&name, Phase::End); }
+    void instant(const std::string& name) { record(&name, Phase::Instant); }
+
+    //! NOTE Must not be called while other threads are still recording
+    void clear();
+
+    std::vector<ThreadInfo> threadsData() const;
+
+    std::string toChromeTraceJson() const;
+    bool save(const std::string& filePath) const;
+
+private:
+    Tracer() = default;
+
+    //! NOTE A slot is read while its owner thread may overwrite it,
+    //! the sequence tells the reader whether the copy it made is consistent
+    struct Slot {
+        std::atomic<uint64_t> seq = 0;          // index + 1 of the event in the slot, 0 while it is written
+        std::atomic<const std::string*> name = nullptr;
+        std::atomic<int64_t> timeNs = 0;
+        std::atomic<Phase> phase = Phase::Instant;
+    };
+
+    struct ThreadBuffer {
+        std::thread::id threadId;
+        std::string threadName;
+        int tid = 0;
+        std::unique_ptr<Slot[]> slots;
+        size_t capacity = 0;
+        size_t mask = 0;
+        std::atomic<uint64_t> head = 0;
+    };
+
+    void record(const std::string* name, Phase phase);
+    ThreadBuffer* threadBuffer();
+
+    static std::atomic<bool> s_enabled;
+
+    mutable std::mutex m_mutex;
+    std::vector<std::unique_ptr<ThreadBuffer> > m_buffers;
+    size_t m_bufferCapacity = DEFAULT_BUFFER_CAPACITY;
+    std::string m_outputFilePath;
+};
+
+struct TraceScope
+{
+    explicit TraceScope(const std::string& name)
+    {
+        if (Tracer::isEnabled()) {
+            m_name = &name;
+            Tracer::instance()->begin(name);
+        }
+    }
+
+    ~TraceScope()
+    {
+        //! NOTE The end is recorded even if capture was switched off meanwhile, so scopes stay balanced
+        if (m_name) {
+            Tracer::instance()->end(*m_name);
+        }
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const std::string* m_name = nullptr;
+};
+}
+
+#endif // MU_GLOBAL_TRACER_H
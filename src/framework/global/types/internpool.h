@@ -0,0 +1,76 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_FRAMEWORK_INTERNPOOL_H
+#define MU_FRAMEWORK_INTERNPOOL_H
+
+#include <functional>
+#include <unordered_map>
+
+namespace mu {
+//! NOTE Hash-consing pool: equal values are stored once, intern() hands out copies of the stored one.
+//! Intended for values with shared (copy-on-write) data, like SharedMap, so that all the interned
+//! copies point to the same data. Not thread-safe: the owner keeps the pool for the data it builds
+//! (e.g. one per render job) and clears it with that data. The number of stored values is limited,
+//! values over the limit are returned as is
+template<typename T, typename Hash, typename Equal = std::equal_to<T> >
+class InternPool
+{
+public:
+    explicit InternPool(size_t maxSize = 4 * 1024)
+        : m_maxSize(maxSize) {}
+
+    T intern(const T& value)
+    {
+        const size_t hash = Hash()(value);
+
+        auto range = m_values.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (Equal()(it->second, value)) {
+                return it->second;
+            }
+        }
+
+        if (m_values.size() < m_maxSize) {
+            m_values.emplace(hash, value);
+        }
+
+        return value;
+    }
+
+    size_t size() const
+    {
+        return m_values.size();
+    }
+
+    void clear()
+    {
+        m_values.clear();
+    }
+
+private:
+    std::unordered_multimap<size_t, T> m_values;
+    size_t m_maxSize = 0;
+};
+}
+
+#endif // MU_FRAMEWORK_INTERNPOOL_H
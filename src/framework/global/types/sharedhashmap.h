@@ -23,6 +23,7 @@
 #ifndef MU_FRAMEWORK_SHAREDHASHMAP_H
 #define MU_FRAMEWORK_SHAREDHASHMAP_H
 
+#include <atomic>
 #include <memory>
 #include <unordered_map>
 
@@ -32,14 +33,29 @@ class SharedHashMap
 {
 public:
     using PairType = std::pair<KeyType, ValType>;
-    using Data = std::unordered_map<KeyType, ValType>;
+    using Container = std::unordered_map<KeyType, ValType>;
+
+    //! NOTE The data knows whether it has ever been shared: a copy of the map marks it, and a write
+    //! into the marked data detaches it first. Unlike use_count() the flag never goes back, so it
+    //! stays correct while the other copies are being created or destroyed on other threads
+    struct Data : public Container {
+        using Container::Container;
+
+        Data() = default;
+        Data(const Data& other)
+            : Container(other) {}
+
+        mutable std::atomic<bool> shared = false;
+    };
+
     using DataPtr = std::shared_ptr<Data>;
     typedef typename Data::iterator iterator;
     typedef typename Data::const_iterator const_iterator;
 
+    //! NOTE Default constructed maps share one empty data, it's detached on the first modification
     SharedHashMap()
+        : m_dataPtr(sharedEmptyData())
     {
-        m_dataPtr = std::make_shared<Data>();
     }
 
     SharedHashMap(const size_t reserveSize)
@@ -58,9 +74,21 @@ public:
         return *this;
     }
 
-    SharedHashMap(const SharedHashMap&) = default;
+    SharedHashMap(const SharedHashMap& other)
+        : m_dataPtr(other.m_dataPtr)
+    {
+        markShared();
+    }
+
     SharedHashMap(SharedHashMap&&) = default;
-    SharedHashMap& operator=(const SharedHashMap&) = default;
+
+    SharedHashMap& operator=(const SharedHashMap& other)
+    {
+        m_dataPtr = other.m_dataPtr;
+        markShared();
+        return *this;
+    }
+
     SharedHashMap& operator=(SharedHashMap&&) = default;
 
     const ValType& at(const KeyType& key) const
@@ -183,7 +211,11 @@ public:
 
     void clear() noexcept
     {
-        ensureDetach();
+        if (isShared()) {
+            m_dataPtr = sharedEmptyData();
+            return;
+        }
+
         m_dataPtr->clear();
     }
 
@@ -201,7 +233,7 @@ public:
 
     bool operator ==(const SharedHashMap& another) const noexcept
     {
-        return *m_dataPtr == *another.m_dataPtr;
+        return m_dataPtr == another.m_dataPtr || *m_dataPtr == *another.m_dataPtr;
     }
 
     bool operator !=(const SharedHashMap& another) const noexcept
@@ -209,14 +241,42 @@ public:
         return !this->operator ==(another);
     }
 
+    bool isSharedWith(const SharedHashMap& another) const noexcept
+    {
+        return m_dataPtr == another.m_dataPtr;
+    }
+
 protected:
+    static const DataPtr& sharedEmptyData()
+    {
+        static const DataPtr empty = []() {
+            DataPtr data = std::make_shared<Data>();
+            data->shared = true;
+            return data;
+        }();
+
+        return empty;
+    }
+
+    bool isShared() const
+    {
+        return m_dataPtr->shared.load(std::memory_order_acquire);
+    }
+
+    void markShared() const
+    {
+        if (m_dataPtr) {
+            m_dataPtr->shared.store(true, std::memory_order_release);
+        }
+    }
+
     void ensureDetach()
     {
         if (!m_dataPtr) {
             return;
         }
 
-        if (m_dataPtr.use_count() == 1) {
+        if (!isShared()) {
             return;
         }
 
@@ -23,6 +23,7 @@
 #ifndef MU_FRAMEWORK_SHAREDMAP_H
 #define MU_FRAMEWORK_SHAREDMAP_H
 
+#include <atomic>
 #include <memory>
 #include <map>
 
@@ -32,16 +33,31 @@ class SharedMap
 {
 public:
     using PairType = std::pair<KeyType, ValType>;
-    using Data = std::map<KeyType, ValType>;
+    using Container = std::map<KeyType, ValType>;
+
+    //! NOTE The data knows whether it has ever been shared: a copy of the map marks it, and a write
+    //! into the marked data detaches it first. Unlike use_count() the flag never goes back, so it
+    //! stays correct while the other copies are being created or destroyed on other threads
+    struct Data : public Container {
+        using Container::Container;
+
+        Data() = default;
+        Data(const Data& other)
+            : Container(other) {}
+
+        mutable std::atomic<bool> shared = false;
+    };
+
     using DataPtr = std::shared_ptr<Data>;
     typedef typename Data::iterator iterator;
     typedef typename Data::const_iterator const_iterator;
     typedef typename Data::reverse_iterator reverse_iterator;
     typedef typename Data::const_reverse_iterator const_reverse_iterator;
 
+    //! NOTE Default constructed maps share one empty data, it's detached on the first modification
     SharedMap()
+        : m_dataPtr(sharedEmptyData())
     {
-        m_dataPtr = std::make_shared<Data>();
     }
 
     SharedMap(std::initializer_list<PairType> initList)
@@ -55,9 +71,21 @@ public:
         return *this;
     }
 
-    SharedMap(const SharedMap&) = default;
+    SharedMap(const SharedMap& other)
+        : m_dataPtr(other.m_dataPtr)
+    {
+        markShared();
+    }
+
     SharedMap(SharedMap&&) = default;
-    SharedMap& operator=(const SharedMap&) = default;
+
+    SharedMap& operator=(const SharedMap& other)
+    {
+        m_dataPtr = other.m_dataPtr;
+        markShared();
+        return *this;
+    }
+
     SharedMap& operator=(SharedMap&&) = default;
 
     const ValType& at(const KeyType& key) const
@@ -188,7 +216,11 @@ public:
 
     void clear() noexcept
     {
-        ensureDetach();
+        if (isShared()) {
+            m_dataPtr = sharedEmptyData();
+            return;
+        }
+
         m_dataPtr->clear();
     }
 
@@ -206,7 +238,7 @@ public:
 
     bool operator ==(const SharedMap& another) const noexcept
     {
-        return *m_dataPtr == *another.m_dataPtr;
+        return m_dataPtr == another.m_dataPtr || *m_dataPtr == *another.m_dataPtr;
     }
 
     bool operator !=(const SharedMap& another) const noexcept
@@ -224,14 +256,42 @@ public:
         return m_dataPtr->operator >(another.m_dataPtr);
     }
 
+    bool isSharedWith(const SharedMap& another) const noexcept
+    {
+        return m_dataPtr == another.m_dataPtr;
+    }
+
 protected:
+    static const DataPtr& sharedEmptyData()
+    {
+        static const DataPtr empty = []() {
+            DataPtr data = std::make_shared<Data>();
+            data->shared = true;
+            return data;
+        }();
+
+        return empty;
+    }
+
+    bool isShared() const
+    {
+        return m_dataPtr->shared.load(std::memory_order_acquire);
+    }
+
+    void markShared() const
+    {
+        if (m_dataPtr) {
+            m_dataPtr->shared.store(true, std::memory_order_release);
+        }
+    }
+
     void ensureDetach()
     {
         if (!m_dataPtr) {
             return;
         }
 
-        if (m_dataPtr.use_count() == 1) {
+        if (!isShared()) {
             return;
         }
 
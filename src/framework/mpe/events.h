@@ -88,6 +88,20 @@ struct ExpressionContext
     }
 };
 
+//! NOTE Most of the note events of a score end up with one of a few distinct curves.
+//! Not thread-safe, see InternPool: every thread building events needs its own pools
+struct NoteCurvesPool
+{
+    ValuesCurvePool<pitch_level_t> pitchCurves;
+    ValuesCurvePool<dynamic_level_t> expressionCurves;
+
+    void clear()
+    {
+        pitchCurves.clear();
+        expressionCurves.clear();
+    }
+};
+
 struct NoteEvent
 {
     explicit NoteEvent(ArrangementContext&& arrangementCtx,
@@ -136,6 +150,18 @@ struct NoteEvent
         return m_expressionCtx;
     }
 
+    //! NOTE Makes the curves share their data with the equal curves interned into the pool before
+    void internCurves(NoteCurvesPool& pool)
+    {
+        if (!m_pitchCtx.pitchCurve.empty()) {
+            m_pitchCtx.pitchCurve = pool.pitchCurves.intern(m_pitchCtx.pitchCurve);
+        }
+
+        if (!m_expressionCtx.expressionCurve.empty()) {
+            m_expressionCtx.expressionCurve = pool.expressionCurves.intern(m_expressionCtx.expressionCurve);
+        }
+    }
+
     bool operator==(const NoteEvent& other) const
     {
         return m_arrangementCtx == other.m_arrangementCtx
@@ -32,6 +32,7 @@
 #include <set>
 #include <vector>
 
+#include "types/internpool.h"
 #include "types/sharedhashmap.h"
 #include "types/sharedmap.h"
 #include "realfn.h"
@@ -176,6 +177,25 @@ private:
     }
 };
 
+template<typename T>
+struct ValuesCurveHash
+{
+    size_t operator()(const ValuesCurve<T>& curve) const
+    {
+        size_t result = curve.size();
+
+        for (const auto& pair : curve) {
+            result = result * 31 + std::hash<duration_percentage_t>()(pair.first);
+            result = result * 31 + std::hash<T>()(pair.second);
+        }
+
+        return result;
+    }
+};
+
+template<typename T>
+using ValuesCurvePool = InternPool<ValuesCurve<T>, ValuesCurveHash<T> >;
+
 // Pitch
 enum class PitchClass {
     Undefined = -1,
@@ -66,6 +66,11 @@ std::string VSTModule::moduleName() const
     return "vst";
 }
 
+bool VSTModule::isInitOnDemandAllowed() const
+{
+    return true;
+}
+
 void VSTModule::registerExports()
 {
     ioc()->registerExport<IVstConfiguration>(moduleName(), s_configuration);
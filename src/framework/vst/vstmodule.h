@@ -29,6 +29,7 @@ class VSTModule : public modularity::IModuleSetup
 {
 public:
     std::string moduleName() const override;
+    bool isInitOnDemandAllowed() const override;
 
     void registerExports() override;
     void resolveImports() override;
@@ -39,6 +39,9 @@ public:
     virtual int midiShortestNote() const = 0; //ticks
     virtual void setMidiShortestNote(int ticks) = 0;
 
+    virtual int midiTupletSearchMaxSteps() const = 0;
+    virtual void setMidiTupletSearchMaxSteps(int steps) = 0;
+
     virtual void setMidiImportOperationsFile(const std::optional<io::path_t>& filePath) const = 0;
 
     // export
@@ -26,17 +26,21 @@
 #include "engraving/types/constants.h"
 
 #include "midiimport/importmidi_operations.h"
+#include "midiimport/importmidi_tuplet_filter.h"
 
 using namespace mu::framework;
 using namespace mu::iex::midi;
 
 static const Settings::Key SHORTEST_NOTE_KEY("iex_midi", "io/midi/shortestNote");
+static const Settings::Key TUPLET_SEARCH_MAX_STEPS_KEY("iex_midi", "io/midi/tupletSearchMaxSteps");
 static const Settings::Key EXPORTRPNS_KEY("iex_midi", "io/midi/exportRPNs");
 static const Settings::Key EXPAND_REPEATS_KEY("iex_midi", "io/midi/expandRepeats");
 
 void MidiConfiguration::init()
 {
     settings()->setDefaultValue(SHORTEST_NOTE_KEY, Val(mu::engraving::Constants::DIVISION / 4));
+    settings()->setDefaultValue(TUPLET_SEARCH_MAX_STEPS_KEY, Val(MidiTuplet::DEFAULT_SEARCH_MAX_STEPS));
+    settings()->setCanBeManuallyEdited(TUPLET_SEARCH_MAX_STEPS_KEY, true, Val(1000), Val(100000000));
     settings()->setDefaultValue(EXPAND_REPEATS_KEY, Val(true));
     settings()->setDefaultValue(EXPORTRPNS_KEY, Val(true));
 }
@@ -51,6 +55,16 @@ void MidiConfiguration::setMidiShortestNote(int ticks)
     settings()->setSharedValue(SHORTEST_NOTE_KEY, Val(ticks));
 }
 
+int MidiConfiguration::midiTupletSearchMaxSteps() const
+{
+    return settings()->value(TUPLET_SEARCH_MAX_STEPS_KEY).toInt();
+}
+
+void MidiConfiguration::setMidiTupletSearchMaxSteps(int steps)
+{
+    settings()->setSharedValue(TUPLET_SEARCH_MAX_STEPS_KEY, Val(steps));
+}
+
 void MidiConfiguration::setMidiImportOperationsFile(const std::optional<io::path_t>& filePath) const
 {
     if (filePath) {
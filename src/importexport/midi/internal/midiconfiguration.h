@@ -35,6 +35,9 @@ public:
     int midiShortestNote() const override; // ticks
     void setMidiShortestNote(int ticks) override;
 
+    int midiTupletSearchMaxSteps() const override;
+    void setMidiTupletSearchMaxSteps(int steps) override;
+
     void setMidiImportOperationsFile(const std::optional<io::path_t>& filePath) const override;
 
     // export
@@ -25,6 +25,7 @@
 #include <QFile>
 
 #include "translation.h"
+#include "concurrency/taskscheduler.h"
 
 #include "engraving/engravingerrors.h"
 #include "engraving/rw/xmlwriter.h"
@@ -191,7 +192,7 @@ void setChordVoice(MidiChord& chord, int voice)
     }
 }
 
-void findAllTupletsForDrums(
+std::vector<int> findAllTupletsForDrums(
     MTrack& mtrack,
     TimeSigMap* sigmap,
     const ReducedFraction& basicQuant)
@@ -215,9 +216,11 @@ void findAllTupletsForDrums(
 
     std::vector<std::multimap<ReducedFraction,
                               MidiTuplet::TupletData> > tuplets(drumVoiceCount);
+    std::set<int> simplifiedBars;
     for (size_t voice = 0; voice < drumVoiceCount; ++voice) {
         if (!chords[voice].empty()) {
-            MidiTuplet::findAllTuplets(tuplets[voice], chords[voice], sigmap, basicQuant);
+            const auto bars = MidiTuplet::findAllTuplets(tuplets[voice], chords[voice], sigmap, basicQuant);
+            simplifiedBars.insert(bars.begin(), bars.end());
         }
     }
     mtrack.chords.clear();
@@ -230,6 +233,48 @@ void findAllTupletsForDrums(
     }
     mtrack.updateTupletsFromChords();
     // note: temporary local tuplets and chords are deleted here
+
+    return std::vector<int>(simplifiedBars.begin(), simplifiedBars.end());
+}
+
+void quantizeTrack(MTrack& mtrack,
+                   TimeSigMap* sigmap,
+                   const ReducedFraction& lastTick,
+                   std::vector<int>& simplifiedTupletBars)
+{
+    auto& opers = midiImportOperations;
+    // pass current track index through MidiImportOperations
+    // for further usage
+    MidiOperations::CurrentTrackSetter setCurrentTrack{ opers, mtrack.indexOfOperation };
+
+    const auto basicQuant = Quantize::quantValueToFraction(
+        opers.data()->trackOpers.quantValue.value(mtrack.indexOfOperation));
+#ifdef QT_DEBUG
+    Q_ASSERT_X(MChord::isLastTickValid(lastTick, mtrack.chords),
+               "quantizeAllTracks", "Last tick is less than max note off time");
+#endif
+    MChord::setBarIndexes(mtrack.chords, basicQuant, lastTick, sigmap);
+
+    if (mtrack.mtrack->drumTrack()) {
+        simplifiedTupletBars = findAllTupletsForDrums(mtrack, sigmap, basicQuant);
+    } else {
+        simplifiedTupletBars = MidiTuplet::findAllTuplets(mtrack.tuplets, mtrack.chords, sigmap, basicQuant);
+    }
+#ifdef QT_DEBUG
+    Q_ASSERT_X(!doNotesOverlap(mtrack),
+               "quantizeAllTracks",
+               "There are overlapping notes of the same voice that is incorrect");
+#endif
+    // (4/3 of the smallest duration) tol is less sensitive
+    // to on time inaccuracies than 1/2 earlier
+    MChord::collectChords(mtrack, { 2, 1 }, { 4, 3 });
+    Quantize::quantizeChords(mtrack.chords, sigmap, basicQuant);
+    MidiTuplet::removeEmptyTuplets(mtrack);
+#ifdef QT_DEBUG
+    Q_ASSERT_X(MidiTuplet::areTupletRangesOk(mtrack.chords, mtrack.tuplets),
+               "quantizeAllTracks", "Tuplet chord/note is outside tuplet "
+                                    "or non-tuplet chord/note is inside tuplet");
+#endif
 }
 
 void quantizeAllTracks(std::multimap<int, MTrack>& tracks,
@@ -238,51 +283,52 @@ void quantizeAllTracks(std::multimap<int, MTrack>& tracks,
 {
     auto& opers = midiImportOperations;
 
+    std::vector<MTrack*> tracksToQuantize;
     for (auto& track: tracks) {
         MTrack& mtrack = track.second;
         if (mtrack.chords.empty()) {
             continue;
         }
-        // pass current track index through MidiImportOperations
-        // for further usage
-        MidiOperations::CurrentTrackSetter setCurrentTrack{ opers, mtrack.indexOfOperation };
 
         if (opers.data()->processingsOfOpenedFile == 0) {
             opers.data()->trackOpers.isDrumTrack.setValue(
-                opers.currentTrack(), mtrack.mtrack->drumTrack());
+                mtrack.indexOfOperation, mtrack.mtrack->drumTrack());
             if (mtrack.mtrack->drumTrack()) {
                 opers.data()->trackOpers.maxVoiceCount.setValue(
-                    opers.currentTrack(), MidiOperations::VoiceCount::V_1);
+                    mtrack.indexOfOperation, MidiOperations::VoiceCount::V_1);
             }
         }
-        const auto basicQuant = Quantize::quantValueToFraction(
-            opers.data()->trackOpers.quantValue.value(mtrack.indexOfOperation));
-#ifdef QT_DEBUG
-        Q_ASSERT_X(MChord::isLastTickValid(lastTick, mtrack.chords),
-                   "quantizeAllTracks", "Last tick is less than max note off time");
-#endif
-        MChord::setBarIndexes(mtrack.chords, basicQuant, lastTick, sigmap);
 
-        if (mtrack.mtrack->drumTrack()) {
-            findAllTupletsForDrums(mtrack, sigmap, basicQuant);
-        } else {
-            MidiTuplet::findAllTuplets(mtrack.tuplets, mtrack.chords, sigmap, basicQuant);
+        tracksToQuantize.push_back(&mtrack);
+    }
+
+    //! NOTE Tracks are independent at this stage and the operations are only read,
+    //! so they are analysed in parallel; every track writes only to its own slot.
+    //! The import runs on the main thread, which takes only chunks of this loop
+    //! while it waits, never unrelated queued tasks
+    std::vector<std::vector<int> > simplifiedTupletBars(tracksToQuantize.size());
+    TaskScheduler::instance()->parallelFor(0, tracksToQuantize.size(), [&](size_t i) {
+        quantizeTrack(*tracksToQuantize[i], sigmap, lastTick, simplifiedTupletBars[i]);
+    });
+
+    opers.data()->simplifiedTupletBars.clear();
+    for (size_t i = 0; i < tracksToQuantize.size(); ++i) {
+        const std::vector<int>& bars = simplifiedTupletBars[i];
+        if (bars.empty()) {
+            continue;
         }
-#ifdef QT_DEBUG
-        Q_ASSERT_X(!doNotesOverlap(track.second),
-                   "quantizeAllTracks",
-                   "There are overlapping notes of the same voice that is incorrect");
-#endif
-        // (4/3 of the smallest duration) tol is less sensitive
-        // to on time inaccuracies than 1/2 earlier
-        MChord::collectChords(mtrack, { 2, 1 }, { 4, 3 });
-        Quantize::quantizeChords(mtrack.chords, sigmap, basicQuant);
-        MidiTuplet::removeEmptyTuplets(mtrack);
-#ifdef QT_DEBUG
-        Q_ASSERT_X(MidiTuplet::areTupletRangesOk(mtrack.chords, mtrack.tuplets),
-                   "quantizeAllTracks", "Tuplet chord/note is outside tuplet "
-                                        "or non-tuplet chord/note is inside tuplet");
-#endif
+
+        opers.data()->simplifiedTupletBars[tracksToQuantize[i]->indexOfOperation] = bars;
+
+        QStringList barNumbers;
+        for (int bar: bars) {
+            barNumbers << QString::number(bar + 1);
+        }
+
+        const QString message = QString("Track %1: tuplet search was simplified in bars %2")
+                                .arg(tracksToQuantize[i]->indexOfOperation + 1)
+                                .arg(barNumbers.join(", "));
+        LOGW() << message;
     }
 }
 
@@ -173,6 +173,8 @@ static const InstrumentTemplate* findInstrument(const String& groupId, const Str
 {
     const InstrumentTemplate* instr = nullptr;
 
+    ensureInstrumentTemplatesLoaded();
+
     for (const InstrumentGroup* group: qAsConst(instrumentGroups)) {
         if (group->id == groupId) {
             for (const InstrumentTemplate* templ: group->instrumentTemplates) {
@@ -194,6 +196,8 @@ const InstrumentTemplate* findClosestInstrument(const MTrack& track)
     int maxLessProgram = -1;
     const InstrumentTemplate* closestTemplate = nullptr;
 
+    ensureInstrumentTemplatesLoaded();
+
     for (const InstrumentGroup* group: qAsConst(instrumentGroups)) {
         for (const InstrumentTemplate* templ: group->instrumentTemplates) {
             if (templ->staffGroup == StaffGroup::TAB) {
@@ -226,6 +230,8 @@ std::vector<const InstrumentTemplate*> findInstrumentsForProgram(const MTrack& t
         trackPitches = findAllPitches(track);
     }
 
+    ensureInstrumentTemplatesLoaded();
+
     for (const InstrumentGroup* group: qAsConst(instrumentGroups)) {
         for (const InstrumentTemplate* templ: group->instrumentTemplates) {
             if (templ->staffGroup == StaffGroup::TAB) {
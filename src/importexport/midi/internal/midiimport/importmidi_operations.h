@@ -39,6 +39,9 @@ QString defaultCharset();
 namespace Quantize {
 MidiOperations::QuantValue defaultQuantValueFromPreferences();
 }
+namespace MidiTuplet {
+int searchMaxStepsFromPreferences();
+}
 
 namespace MidiOperations {
 // operation types are in importmidi_operation.h
@@ -181,6 +184,9 @@ struct Opers
     Op<bool> showChordNames = Op<bool>(true);
     Op<TimeSigNumerator> timeSigNumerator = Op<TimeSigNumerator>(TimeSigNumerator::_4);
     Op<TimeSigDenominator> timeSigDenominator = Op<TimeSigDenominator>(TimeSigDenominator::_4);
+    // budget of the tuplet selection search in one bar, the best selection found so far is used
+    // when it is exhausted; it is counted in steps, not in time, so the result is reproducible
+    Op<int> tupletSearchMaxSteps = Op<int>(MidiTuplet::searchMaxStepsFromPreferences());
 
     // operations for individual tracks
     TrackOp<int> trackIndexAfterReorder = TrackOp<int>(0);
@@ -236,6 +242,9 @@ struct FileData
     QList<std::multimap<ReducedFraction, std::string> > lyricTracks;
     std::multimap<ReducedFraction, QString> chordNames;
     HumanBeatData humanBeatData;
+    // <track index, bar indexes> where the tuplet search budget was exhausted
+    // and a simplified tuplet selection was used; refilled on every processing of the file
+    std::map<int, std::vector<int> > simplifiedTupletBars;
 };
 
 class Data
@@ -259,7 +268,8 @@ private:
 
     QString _currentMidiFile;
     QString _midiOperationsFile;
-    int _currentTrack = -1;
+    // tracks are analysed in parallel, each thread has its own current track
+    static thread_local int _currentTrack;
 
     std::map<QString, FileData> _data;      // <file name, tracks data>
 };
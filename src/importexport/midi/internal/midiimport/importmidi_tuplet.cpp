@@ -1071,7 +1071,9 @@ void setBarIndexesOfNextBarChords(
 
 // indexes of each new bar should be -1 except possibly chords at the end of prev bar
 
-void findTuplets(
+// returns false if the tuplet selection was simplified because the search budget was exhausted
+
+bool findTuplets(
     const std::multimap<ReducedFraction, MidiChord>::iterator& startBarChordIt,
     const std::multimap<ReducedFraction, MidiChord>::iterator& endBarChordIt,
     std::multimap<ReducedFraction, MidiChord>& chords,
@@ -1081,13 +1083,13 @@ void findTuplets(
     int barIndex)
 {
     if (chords.empty() || startBarChordIt == endBarChordIt) {
-        return;
+        return true;
     }
 
     const auto& opers = midiImportOperations.data()->trackOpers;
     const int currentTrack = midiImportOperations.currentTrack();
     if (!opers.searchTuplets.value(currentTrack)) {
-        return;
+        return true;
     }
 
     const auto startBarTick = ReducedFraction::fromTicks(
@@ -1099,10 +1101,10 @@ void findTuplets(
     std::vector<TupletInfo> tuplets = detectTuplets(startBarChordIt, endBarChordIt, startBarTick,
                                                     barFraction, chords, basicQuant, barIndex);
     if (tuplets.empty()) {
-        return;
+        return true;
     }
 
-    filterTuplets(tuplets, basicQuant);
+    const bool isSearchComplete = filterTuplets(tuplets, basicQuant);
     // later notes will be sorted and their indexes become invalid
     // so assign staccato information to notes now
     if (opers.simplifyDurations.value(currentTrack)) {
@@ -1138,6 +1140,8 @@ void findTuplets(
 #endif
     addTupletEvents(tupletEvents, tuplets, backTiedTuplets);
     setBarIndexesOfNextBarChords(tuplets, nonTuplets, barIndex);
+
+    return isSearchComplete;
 }
 
 void setAllTupletOffTimes(
@@ -1166,14 +1170,15 @@ void setAllTupletOffTimes(
     }
 }
 
-void findAllTuplets(
+std::vector<int> findAllTuplets(
     std::multimap<ReducedFraction, TupletData>& tuplets,
     std::multimap<ReducedFraction, MidiChord>& chords,
     const engraving::TimeSigMap* sigmap,
     const ReducedFraction& basicQuant)
 {
+    std::vector<int> simplifiedBars;
     if (chords.empty()) {
-        return;
+        return simplifiedBars;
     }
 #ifdef QT_DEBUG
     Q_ASSERT_X(MChord::areNotesLongEnough(chords),
@@ -1192,8 +1197,10 @@ void findAllTuplets(
             const int currentBarIndex = startBarIt->second.barIndex;
             if (endBarIt->second.barIndex > currentBarIndex) {
                 const size_t oldTupletCount = tuplets.size();
-                findTuplets(startBarIt, endBarIt, chords, basicQuant,
-                            tuplets, sigmap, currentBarIndex);
+                if (!findTuplets(startBarIt, endBarIt, chords, basicQuant,
+                                 tuplets, sigmap, currentBarIndex)) {
+                    simplifiedBars.push_back(currentBarIndex);
+                }
 
                 Q_ASSERT_X(tuplets.size() >= oldTupletCount, "MidiTuplet::findAllTuplets",
                            "Some old tuplets were deleted that is incorrect");
@@ -1233,8 +1240,11 @@ void findAllTuplets(
             }
         }
         // handle the last bar containing chords
-        findTuplets(startBarIt, chords.end(), chords, basicQuant, tuplets,
-                    sigmap, startBarIt->second.barIndex);
+        const int lastBarIndex = startBarIt->second.barIndex;
+        if (!findTuplets(startBarIt, chords.end(), chords, basicQuant, tuplets,
+                         sigmap, lastBarIndex)) {
+            simplifiedBars.push_back(lastBarIndex);
+        }
     }
     // check if there are not detected off times inside tuplets
     setAllTupletOffTimes(tuplets, chords, sigmap);
@@ -1246,6 +1256,8 @@ void findAllTuplets(
                "MidiTuplet::findAllTuplets", "There are too short notes");
     Q_ASSERT(areAllTupletsDifferent(tuplets));
 #endif
+
+    return simplifiedBars;
 }
 } // namespace MidiTuplet
 } // namespace mu::iex::midi
@@ -101,9 +101,10 @@ std::multimap<ReducedFraction, TupletData>::const_iterator
 findTupletContainingTime(int voice, const ReducedFraction& time, const std::multimap<ReducedFraction, TupletData>& tupletEvents,
                          bool strictComparison);
 
-// Find tuplets and set bar indexes
+// Find tuplets and set bar indexes,
+// returns indexes of bars where the tuplet search was simplified because of its budget
 
-void findAllTuplets(
+std::vector<int> findAllTuplets(
     std::multimap<ReducedFraction, TupletData>& tuplets, std::multimap<ReducedFraction, MidiChord>& chords,
     const engraving::TimeSigMap* sigmap, const ReducedFraction& basicQuant);
 
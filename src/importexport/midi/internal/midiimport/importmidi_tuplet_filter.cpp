@@ -25,9 +25,14 @@
 #include "importmidi_chord.h"
 #include "importmidi_quant.h"
 #include "importmidi_inner.h"
+#include "importmidi_operations.h"
 #include "engraving/dom/mscore.h"
 
+#include "modularity/ioc.h"
+#include "importexport/midi/imidiconfiguration.h"
+
 #include <set>
+#include <unordered_map>
 
 namespace mu::iex::midi {
 namespace MidiTuplet {
@@ -261,11 +266,55 @@ bool isInCommonIndexes(
     return false;
 }
 
+using ChordPtr = const std::pair<const ReducedFraction, MidiChord>*;
+
+// state of the search of the best tuplet selection in one bar
+class TupletSearch
+{
+public:
+    explicit TupletSearch(size_t maxSteps)
+        : maxSteps_(maxSteps)
+    {}
+
+    // returns false if the budget is exhausted and the search should stop
+    bool nextStep()
+    {
+        if (exhausted_) {
+            return false;
+        }
+        ++steps_;
+        if (steps_ > maxSteps_) {
+            exhausted_ = true;
+            return false;
+        }
+        return true;
+    }
+
+    bool isExhausted() const { return exhausted_; }
+
+    // quant errors of chords don't depend on the selection, so they are computed only once
+    const ReducedFraction& chordQuantError(ChordPtr chord, const ReducedFraction& basicQuant)
+    {
+        auto it = chordQuantErrors_.find(chord);
+        if (it == chordQuantErrors_.end()) {
+            it = chordQuantErrors_.insert({ chord, Quantize::findOnTimeQuantError(*chord, basicQuant) }).first;
+        }
+        return it->second;
+    }
+
+private:
+    size_t steps_ = 0;
+    size_t maxSteps_ = 0;
+    bool exhausted_ = false;
+    std::unordered_map<ChordPtr, ReducedFraction> chordQuantErrors_;
+};
+
 TupletErrorResult findTupletError(
     const std::vector<int>& tupletIndexes,
     const std::vector<TupletInfo>& tuplets,
     size_t voiceCount,
-    const ReducedFraction& basicQuant)
+    const ReducedFraction& basicQuant,
+    TupletSearch& search)
 {
     ReducedFraction sumError{ 0, 1 };
     ReducedFraction sumLengthOfRests{ 0, 1 };
@@ -297,7 +346,7 @@ TupletErrorResult findTupletError(
             if (usedChords.find(&*chord.second) != usedChords.end()) {
                 continue;
             }
-            sumError += Quantize::findOnTimeQuantError(*chord.second, basicQuant);
+            sumError += search.chordQuantError(&*chord.second, basicQuant);
         }
     }
 
@@ -473,11 +522,12 @@ void tryUpdateBestIndexes(
     const std::vector<int>& selectedTuplets,
     const std::vector<TupletInfo>& tuplets,
     const std::map<int, std::vector<std::pair<ReducedFraction, ReducedFraction> > >& voiceIntervals,
-    const ReducedFraction& basicQuant)
+    const ReducedFraction& basicQuant,
+    TupletSearch& search)
 {
     const size_t voiceCount = voiceIntervals.size();
     const auto error = findTupletError(selectedTuplets, tuplets,
-                                       voiceCount, basicQuant);
+                                       voiceCount, basicQuant, search);
     if (!minCurrentError.isInitialized() || error < minCurrentError) {
         minCurrentError = error;
         bestTupletIndexes = selectedTuplets;
@@ -582,9 +632,13 @@ void findNextTuplet(
     const std::vector<TupletInfo>& tuplets,
     const std::vector<std::pair<ReducedFraction, ReducedFraction> >& tupletIntervals,
     size_t commonsSize,
-    const ReducedFraction& basicQuant)
+    const ReducedFraction& basicQuant,
+    TupletSearch& search)
 {
     while (!validTuplets.empty()) {
+        if (!search.nextStep()) {
+            return;
+        }
         size_t index = validTuplets.first();
 
         bool isCommonGroupBegins = (selectedTuplets.empty() && index == commonsSize);
@@ -621,7 +675,7 @@ void findNextTuplet(
             }
             if (!canAddMoreIndexes) {
                 tryUpdateBestIndexes(bestTupletIndexes, minCurrentError,
-                                     selectedTuplets, tuplets, voiceIntervals, basicQuant);
+                                     selectedTuplets, tuplets, voiceIntervals, basicQuant, search);
             }
             return;
         }
@@ -658,11 +712,11 @@ void findNextTuplet(
             }
             if (!canAddMoreIndexes) {
                 tryUpdateBestIndexes(bestTupletIndexes, minCurrentError,
-                                     selectedTuplets, tuplets, voiceIntervals, basicQuant);
+                                     selectedTuplets, tuplets, voiceIntervals, basicQuant, search);
             }
         } else {
             findNextTuplet(selectedTuplets, validTuplets, bestTupletIndexes, minCurrentError,
-                           tupletCommons, tuplets, tupletIntervals, commonsSize, basicQuant);
+                           tupletCommons, tuplets, tupletIntervals, commonsSize, basicQuant, search);
         }
 
         selectedTuplets.pop_back();
@@ -692,7 +746,8 @@ std::vector<int> findBestTuplets(
     const std::vector<TupletCommon>& tupletCommons,
     const std::vector<TupletInfo>& tuplets,
     size_t commonsSize,
-    const ReducedFraction& basicQuant)
+    const ReducedFraction& basicQuant,
+    TupletSearch& search)
 {
     std::vector<int> bestTupletIndexes;
     std::vector<int> selectedTuplets;
@@ -702,7 +757,15 @@ std::vector<int> findBestTuplets(
     ValidTuplets validTuplets(int(tuplets.size()));
 
     findNextTuplet(selectedTuplets, validTuplets, bestTupletIndexes, minCurrentError,
-                   tupletCommons, tuplets, tupletIntervals, commonsSize, basicQuant);
+                   tupletCommons, tuplets, tupletIntervals, commonsSize, basicQuant, search);
+
+    // nothing was evaluated before the budget ran out:
+    // the longest group of uncommon tuplets (at the end) is a valid selection anyway
+    if (search.isExhausted() && bestTupletIndexes.empty()) {
+        for (size_t i = commonsSize; i < tuplets.size(); ++i) {
+            bestTupletIndexes.push_back(int(i));
+        }
+    }
 
     return bestTupletIndexes;
 }
@@ -744,11 +807,11 @@ void removeExtraTuplets(std::vector<TupletInfo>& tuplets)
 // in the case if there are enough notes in this first chord
 // to be split into different voices
 
-void filterTuplets(std::vector<TupletInfo>& tuplets,
+bool filterTuplets(std::vector<TupletInfo>& tuplets,
                    const ReducedFraction& basicQuant)
 {
     if (tuplets.empty()) {
-        return;
+        return true;
     }
 #ifdef QT_DEBUG
     Q_ASSERT_X(!areTupletChordsEmpty(tuplets),
@@ -770,8 +833,11 @@ void filterTuplets(std::vector<TupletInfo>& tuplets,
     }
     const auto tupletCommons = findTupletCommons(tuplets);
 
+    const auto& opers = midiImportOperations.data()->trackOpers;
+    TupletSearch search(static_cast<size_t>(opers.tupletSearchMaxSteps.value()));
+
     const std::vector<int> bestIndexes = findBestTuplets(tupletCommons, tuplets,
-                                                         commonsSize, basicQuant);
+                                                         commonsSize, basicQuant, search);
 #ifdef QT_DEBUG
     Q_ASSERT_X(validateSelectedTuplets(bestIndexes.begin(), bestIndexes.end(), tuplets),
                "MIDI tuplets: filterTuplets", "Tuplets have common chords but they shouldn't");
@@ -782,6 +848,14 @@ void filterTuplets(std::vector<TupletInfo>& tuplets,
     }
 
     std::swap(tuplets, newTuplets);
+
+    return !search.isExhausted();
+}
+
+int searchMaxStepsFromPreferences()
+{
+    auto conf = mu::modularity::ioc()->resolve<mu::iex::midi::IMidiImportExportConfiguration>("iex_midi");
+    return conf ? conf->midiTupletSearchMaxSteps() : DEFAULT_SEARCH_MAX_STEPS;
 }
 } // namespace MidiTuplet
 } // namespace mu::iex::midi
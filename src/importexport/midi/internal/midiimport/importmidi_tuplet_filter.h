@@ -30,7 +30,14 @@ class ReducedFraction;
 namespace MidiTuplet {
 struct TupletInfo;
 
-void filterTuplets(std::vector<TupletInfo>& tuplets, const ReducedFraction& basicQuant);
+// returns false if the search budget was exhausted and the best selection found so far was used
+bool filterTuplets(std::vector<TupletInfo>& tuplets, const ReducedFraction& basicQuant);
+
+// default budget of the tuplet selection search in one bar
+constexpr int DEFAULT_SEARCH_MAX_STEPS = 500000;
+
+// budget of the tuplet selection search in one bar, as set in the preferences
+int searchMaxStepsFromPreferences();
 } // namespace MidiTuplet
 } // namespace mu::iex::midi
 
@@ -32,6 +32,8 @@
 #include "engraving/dom/mscore.h"
 #include "engraving/dom/durationtype.h"
 
+#include "concurrency/taskscheduler.h"
+
 using namespace mu::engraving;
 
 namespace mu::iex::midi {
@@ -1062,62 +1064,70 @@ void sortVoices(
     }
 }
 
-bool separateVoices(std::multimap<int, MTrack>& tracks, const TimeSigMap* sigmap)
+bool separateTrackVoices(MTrack& mtrack, const TimeSigMap* sigmap)
 {
     auto& opers = midiImportOperations;
-    bool changed = false;
-
-    for (auto& track: tracks) {
-        MTrack& mtrack = track.second;
-        if (mtrack.mtrack->drumTrack()) {
-            continue;
-        }
-        auto& chords = track.second.chords;
-        if (chords.empty()) {
-            continue;
-        }
-        const auto userVoiceCount = toIntVoiceCount(
-            opers.data()->trackOpers.maxVoiceCount.value(mtrack.indexOfOperation));
-        // pass current track index through MidiImportOperations
-        // for further usage
-        MidiOperations::CurrentTrackSetter setCurrentTrack{ opers, mtrack.indexOfOperation };
+    const auto userVoiceCount = toIntVoiceCount(
+        opers.data()->trackOpers.maxVoiceCount.value(mtrack.indexOfOperation));
+    // pass current track index through MidiImportOperations
+    // for further usage
+    MidiOperations::CurrentTrackSetter setCurrentTrack{ opers, mtrack.indexOfOperation };
 
-        if (userVoiceCount > 1 && static_cast<int>(userVoiceCount) <= voiceLimit()) {
+    if (userVoiceCount <= 1 || static_cast<int>(userVoiceCount) > voiceLimit()) {
+        return false;
+    }
 #ifdef QT_DEBUG
-            Q_ASSERT_X(MidiTuplet::areAllTupletsReferenced(mtrack.chords, mtrack.tuplets),
-                       "MidiVoice::separateVoices",
-                       "Not all tuplets are referenced in chords or notes "
-                       "before voice separation");
-            Q_ASSERT_X(areVoicesSame(mtrack.chords),
-                       "MidiVoice::separateVoices", "Different voices of chord and tuplet "
-                                                    "before voice separation");
+    Q_ASSERT_X(MidiTuplet::areAllTupletsReferenced(mtrack.chords, mtrack.tuplets),
+               "MidiVoice::separateVoices",
+               "Not all tuplets are referenced in chords or notes "
+               "before voice separation");
+    Q_ASSERT_X(areVoicesSame(mtrack.chords),
+               "MidiVoice::separateVoices", "Different voices of chord and tuplet "
+                                            "before voice separation");
 #endif
-            if (doVoiceSeparation(mtrack.chords, sigmap, mtrack.tuplets)) {
-                changed = true;
-            }
+    const bool changed = doVoiceSeparation(mtrack.chords, sigmap, mtrack.tuplets);
 #ifdef QT_DEBUG
-            Q_ASSERT_X(MidiTuplet::areAllTupletsReferenced(mtrack.chords, mtrack.tuplets),
-                       "MidiVoice::separateVoices",
-                       "Not all tuplets are referenced in chords or notes "
-                       "after voice separation, before voice sort");
-            Q_ASSERT_X(areVoicesSame(mtrack.chords),
-                       "MidiVoice::separateVoices", "Different voices of chord and tuplet "
-                                                    "after voice separation, before voice sort");
+    Q_ASSERT_X(MidiTuplet::areAllTupletsReferenced(mtrack.chords, mtrack.tuplets),
+               "MidiVoice::separateVoices",
+               "Not all tuplets are referenced in chords or notes "
+               "after voice separation, before voice sort");
+    Q_ASSERT_X(areVoicesSame(mtrack.chords),
+               "MidiVoice::separateVoices", "Different voices of chord and tuplet "
+                                            "after voice separation, before voice sort");
 #endif
-            sortVoices(mtrack.chords, sigmap);
+    sortVoices(mtrack.chords, sigmap);
 #ifdef QT_DEBUG
-            Q_ASSERT_X(MidiTuplet::areAllTupletsReferenced(mtrack.chords, mtrack.tuplets),
-                       "MidiVoice::separateVoices",
-                       "Not all tuplets are referenced in chords or notes "
-                       "after voice sort");
-            Q_ASSERT_X(areVoicesSame(mtrack.chords),
-                       "MidiVoice::separateVoices", "Different voices of chord and tuplet "
-                                                    "after voice sort");
+    Q_ASSERT_X(MidiTuplet::areAllTupletsReferenced(mtrack.chords, mtrack.tuplets),
+               "MidiVoice::separateVoices",
+               "Not all tuplets are referenced in chords or notes "
+               "after voice sort");
+    Q_ASSERT_X(areVoicesSame(mtrack.chords),
+               "MidiVoice::separateVoices", "Different voices of chord and tuplet "
+                                            "after voice sort");
 #endif
+    return changed;
+}
+
+bool separateVoices(std::multimap<int, MTrack>& tracks, const TimeSigMap* sigmap)
+{
+    std::vector<MTrack*> tracksToSeparate;
+    for (auto& track: tracks) {
+        MTrack& mtrack = track.second;
+        if (mtrack.mtrack->drumTrack() || mtrack.chords.empty()) {
+            continue;
         }
+        tracksToSeparate.push_back(&mtrack);
     }
 
-    return changed;
+    //! NOTE Voices of different tracks are separated independently,
+    //! so the tracks are processed in parallel. This is called on the main thread,
+    //! which takes only chunks of this loop while it waits, never unrelated queued tasks
+    std::vector<char> changedTracks(tracksToSeparate.size(), 0);
+    TaskScheduler::instance()->parallelFor(0, tracksToSeparate.size(), [&](size_t i) {
+        changedTracks[i] = separateTrackVoices(*tracksToSeparate[i], sigmap);
+    });
+
+    return std::find(changedTracks.begin(), changedTracks.end(), 1) != changedTracks.end();
 }
 } // namespace MidiVoice
 } // namespace mu::iex::midi
@@ -46,6 +46,6 @@ static mu::testing::SuiteEnvironment importexport_se(
 
     mu::engraving::loadInstrumentTemplates(":/data/instruments.xml");
 
-    LOGW() << "WARNING: actually all MIDI import/export tests are disabled!";
+    LOGW() << "WARNING: actually most MIDI import/export tests are disabled!";
 }
     );
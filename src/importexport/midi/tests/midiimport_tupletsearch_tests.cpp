@@ -0,0 +1,135 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "testing/qtestsuite.h"
+
+#include "engraving/compat/scoreaccess.h"
+#include "engraving/engravingerrors.h"
+#include "engraving/dom/chord.h"
+#include "engraving/dom/masterscore.h"
+#include "engraving/dom/segment.h"
+
+#include "importexport/midi/internal/midiimport/importmidi_operations.h"
+#include "importexport/midi/internal/midiimport/importmidi_tuplet_filter.h"
+
+namespace mu::iex::midi {
+extern engraving::Err importMidi(engraving::MasterScore*, const QString& name);
+}
+
+using namespace mu::engraving;
+using namespace mu::iex::midi;
+
+static const QString MIDIIMPORT_DIR("midiimport_data/");
+
+//---------------------------------------------------------
+//   TestMidiImportTupletSearch
+//---------------------------------------------------------
+
+class TestMidiImportTupletSearch : public QObject
+{
+    Q_OBJECT
+
+    QString midiFilePath(const QString& fileName) const
+    {
+        return QString(iex_midi_tests_DATA_ROOT) + "/" + MIDIIMPORT_DIR + fileName + ".mid";
+    }
+
+    MasterScore* importWithBudget(const QString& path, int maxSteps) const
+    {
+        auto& opers = midiImportOperations;
+        opers.addNewMidiFile(path);
+        {
+            MidiOperations::CurrentMidiFileSetter setCurrentMidiFile(opers, path);
+            opers.data()->trackOpers.tupletSearchMaxSteps.setValue(maxSteps);
+        }
+
+        MasterScore* score = compat::ScoreAccess::createMasterScoreWithBaseStyle();
+        if (importMidi(score, path) != Err::NoError) {
+            delete score;
+            return nullptr;
+        }
+        return score;
+    }
+
+    std::map<int, std::vector<int> > reportedBars(const QString& path) const
+    {
+        auto& opers = midiImportOperations;
+        MidiOperations::CurrentMidiFileSetter setCurrentMidiFile(opers, path);
+        return opers.data()->simplifiedTupletBars;
+    }
+
+    static size_t noteCount(const Score* score)
+    {
+        size_t count = 0;
+        for (Segment* s = score->firstSegment(SegmentType::ChordRest); s; s = s->next1(SegmentType::ChordRest)) {
+            for (const EngravingItem* e : s->elist()) {
+                if (e && e->isChord()) {
+                    count += toChord(e)->notes().size();
+                }
+            }
+        }
+        return count;
+    }
+
+private slots:
+    void exhaustedBudget_FallbackAndReportedBars();
+};
+
+//---------------------------------------------------------
+//   exhaustedBudget_FallbackAndReportedBars
+//    a tuplet search without any budget falls back to the simplified selection,
+//    keeps every note and reports the bar; a reimport with the default budget
+//    replaces the report
+//---------------------------------------------------------
+
+void TestMidiImportTupletSearch::exhaustedBudget_FallbackAndReportedBars()
+{
+    const QString path = midiFilePath("tuplet_3_5_7_tuplets");
+
+    MasterScore* reference = importWithBudget(path, MidiTuplet::DEFAULT_SEARCH_MAX_STEPS);
+    QVERIFY(reference);
+    QVERIFY(reportedBars(path).empty());
+
+    midiImportOperations.excludeMidiFile(path);
+
+    MasterScore* simplified = importWithBudget(path, 0);
+    QVERIFY(simplified);
+
+    const std::map<int, std::vector<int> > expectedBars { { 0, { 0 } } };
+    QVERIFY(reportedBars(path) == expectedBars);
+    QCOMPARE(simplified->nmeasures(), reference->nmeasures());
+    QCOMPARE(noteCount(simplified), noteCount(reference));
+
+    // the same opened file processed again, as after changing the operations in the import panel
+    MasterScore* reimported = importWithBudget(path, MidiTuplet::DEFAULT_SEARCH_MAX_STEPS);
+    QVERIFY(reimported);
+    QVERIFY(reportedBars(path).empty());
+
+    midiImportOperations.excludeMidiFile(path);
+
+    delete reimported;
+    delete simplified;
+    delete reference;
+}
+
+QTEST_MAIN(TestMidiImportTupletSearch)
+#include "midiimport_tupletsearch_tests.moc"
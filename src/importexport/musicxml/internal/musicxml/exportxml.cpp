@@ -40,6 +40,11 @@
 #include "exportxml.h"
 
 #include <math.h>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <QString>
 #include <QBuffer>
 #include <QDate>
@@ -50,6 +55,7 @@
 #include "io/buffer.h"
 #include "io/fileinfo.h"
 #include "global/deprecated/qzipwriter_p.h"
+#include "concurrency/taskscheduler.h"
 
 #include "engraving/style/style.h"
 #include "engraving/rw/xmlwriter.h"
@@ -277,6 +283,7 @@ class SlurHandler
 public:
     SlurHandler();
     void doSlurs(const ChordRest* chordRest, Notations& notations, XmlWriter& xml);
+    bool isEmpty() const;
 
 private:
     void doSlurStart(const Slur* s, Notations& notations, XmlWriter& xml);
@@ -297,6 +304,7 @@ public:
     GlissandoHandler();
     void doGlissandoStart(Glissando* gliss, Notations& notations, XmlWriter& xml);
     void doGlissandoStop(Glissando* gliss, Notations& notations, XmlWriter& xml);
+    bool isEmpty() const;
 };
 
 //---------------------------------------------------------
@@ -350,6 +358,7 @@ class ExportMusicXml
     INJECT_STATIC(mu::iex::musicxml::IMusicXmlConfiguration, configuration)
 
     Score* _score;
+    mu::io::IODevice* _dev = nullptr;
     XmlWriter _xml;
     SlurHandler sh;
     GlissandoHandler gh;
@@ -369,6 +378,16 @@ class ExportMusicXml
     TrillHash _trillStart;
     TrillHash _trillStop;
     MxmlInstrumentMap instrMap;
+    KeySig* _defaultKeySig = nullptr;     // C major keysig written when the score has none at tick 0
+
+    // the texts without a valid layout are converted from a temporary clone, which is added to
+    // and removed from the parent like any other element: that is done before the parts are written concurrently
+    struct TextConversion {
+        QString plainText;
+        std::list<TextFragment> fragments;
+    };
+    using TextConversions = std::unordered_map<const TextBase*, TextConversion>;
+    std::shared_ptr<const TextConversions> _textConversions;
 
     int findBracket(const TextLineBase* tl) const;
     int findDashes(const TextLineBase* tl) const;
@@ -404,7 +423,13 @@ class ExportMusicXml
                       const MeasurePrintContext& mpc, QSet<const Spanner*>& spannersStopped);
     void repeatAtMeasureStart(Attributes& attr, const Measure* const m, track_idx_t strack, track_idx_t etrack, track_idx_t track);
     void repeatAtMeasureStop(const Measure* const m, track_idx_t strack, track_idx_t etrack, track_idx_t track);
+    void writePart(const size_t partIndex, const int staffCount);
+    mu::ByteArray writePartToBuffer(const size_t partIndex, const int staffCount);
+    bool hasOpenSpanners() const;
     void writeParts();
+    void convertTextsWithoutLayout();
+    QString plainText(const TextBase* text) const;
+    std::list<TextFragment> fragmentList(const TextBase* text) const;
 
     static QString fermataPosition(const Fermata* const fermata);
     static QString elementPosition(const ExportMusicXml* const expMxml, const EngravingItem* const elm);
@@ -422,6 +447,21 @@ public:
         millimeters = _score->style().spatium() * tenths / (10 * DPMM);
     }
 
+    // exporter of single parts, continuing from the state \a other has reached
+    explicit ExportMusicXml(const ExportMusicXml* other)
+        : _score(other->_score), sh(other->sh), gh(other->gh), _tick(other->_tick), _jumpElements(other->_jumpElements),
+        div(other->div), millimeters(other->millimeters), tenths(other->tenths), _defaultKeySig(other->_defaultKeySig),
+        _textConversions(other->_textConversions)
+    {
+        for (int i = 0; i < MAX_NUMBER_LEVEL; ++i) {
+            brackets[i] = other->brackets[i];
+            dashes[i] = other->dashes[i];
+            hairpins[i] = other->hairpins[i];
+            ottavas[i] = other->ottavas[i];
+            trills[i] = other->trills[i];
+        }
+    }
+
     void write(mu::io::IODevice* dev);
     void credits(XmlWriter& xml);
     void moveToTick(const Fraction& t);
@@ -707,6 +747,20 @@ SlurHandler::SlurHandler()
     }
 }
 
+//---------------------------------------------------------
+//   isEmpty -- no slur is in progress
+//---------------------------------------------------------
+
+bool SlurHandler::isEmpty() const
+{
+    for (int i = 0; i < MAX_NUMBER_LEVEL; ++i) {
+        if (slur[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
 static QString slurTieLineStyle(const SlurTie* s)
 {
     QString lineType;
@@ -962,6 +1016,20 @@ GlissandoHandler::GlissandoHandler()
     }
 }
 
+//---------------------------------------------------------
+//   isEmpty -- no glissando or slide is in progress
+//---------------------------------------------------------
+
+bool GlissandoHandler::isEmpty() const
+{
+    for (int i = 0; i < MAX_NUMBER_LEVEL; ++i) {
+        if (glissNote[i] || slideNote[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
 //---------------------------------------------------------
 //   findNote -- get index of Note in note table for subtype type
 //   return -1 if not found
@@ -4521,9 +4589,9 @@ static void beatUnit(XmlWriter& xml, const TDuration dur)
 //   wordsMetronome
 //---------------------------------------------------------
 
-static void wordsMetronome(XmlWriter& xml, const MStyle& s, TextBase const* const text, const int offset)
+static void wordsMetronome(XmlWriter& xml, const MStyle& s, TextBase const* const text, const std::list<TextFragment>& list,
+                           const int offset)
 {
-    const std::list<TextFragment> list = text->fragmentList();
     std::list<TextFragment> wordsLeft;          // words left of metronome
     bool hasParen;                          // parenthesis
     QString metroLeft;                      // left part of metronome
@@ -4581,7 +4649,7 @@ static void wordsMetronome(XmlWriter& xml, const MStyle& s, TextBase const* cons
         attr += ExportMusicXml::positioningAttributes(text);
         MScoreTextToMXML mttm("words", attr, defFmt, mtf);
         //LOGD("words('%s')", qPrintable(text->text()));
-        mttm.writeTextFragments(text->fragmentList(), xml);
+        mttm.writeTextFragments(list, xml);
         xml.endElement();
     }
 
@@ -4606,7 +4674,7 @@ void ExportMusicXml::tempoText(TempoText const* const text, staff_idx_t staff)
     */
     _attr.doAttr(_xml, false);
     _xml.startElement("direction", { { "placement", (text->placement() == PlacementV::BELOW) ? "below" : "above" } });
-    wordsMetronome(_xml, _score->style(), text, offset);
+    wordsMetronome(_xml, _score->style(), text, fragmentList(text), offset);
 
     if (staff) {
         _xml.tag("staff", static_cast<int>(staff));
@@ -4636,14 +4704,14 @@ void ExportMusicXml::words(TextBase const* const text, staff_idx_t staff)
            qPrintable(text->plainText()));
     */
 
-    if (text->plainText() == "") {
+    if (plainText(text) == "") {
         // sometimes empty Texts are present, exporting would result
         // in invalid MusicXML (as an empty direction-type would be created)
         return;
     }
 
     directionTag(_xml, _attr, text);
-    wordsMetronome(_xml, _score->style(), text, offset);
+    wordsMetronome(_xml, _score->style(), text, fragmentList(text), offset);
     directionETag(_xml, staff);
 }
 
@@ -4667,7 +4735,7 @@ QString ExportMusicXml::positioningAttributesForTboxText(const QPointF position,
 
 void ExportMusicXml::tboxTextAsWords(TextBase const* const text, const staff_idx_t staff, const QPointF relativePosition)
 {
-    if (text->plainText() == "") {
+    if (plainText(text) == "") {
         // sometimes empty Texts are present, exporting would result
         // in invalid MusicXML (as an empty direction-type would be created)
         return;
@@ -4691,7 +4759,7 @@ void ExportMusicXml::tboxTextAsWords(TextBase const* const text, const staff_idx
     attr += ExportMusicXml::positioningAttributesForTboxText(relativePosition, text->spatium());
     attr += " valign=\"top\"";
     MScoreTextToMXML mttm("words", attr, defFmt, mtf);
-    mttm.writeTextFragments(text->fragmentList(), _xml);
+    mttm.writeTextFragments(fragmentList(text), _xml);
     _xml.endElement();
     directionETag(_xml, staff);
 }
@@ -4702,7 +4770,7 @@ void ExportMusicXml::tboxTextAsWords(TextBase const* const text, const staff_idx
 
 void ExportMusicXml::rehearsal(RehearsalMark const* const rmk, staff_idx_t staff)
 {
-    if (rmk->plainText() == "") {
+    if (plainText(rmk) == "") {
         // sometimes empty Texts are present, exporting would result
         // in invalid MusicXML (as an empty direction-type would be created)
         return;
@@ -4720,7 +4788,7 @@ void ExportMusicXml::rehearsal(RehearsalMark const* const rmk, staff_idx_t staff
     const CharFormat defFmt = formatForWords(style);
     // write formatted
     MScoreTextToMXML mttm("rehearsal", attr, defFmt, mtf);
-    mttm.writeTextFragments(rmk->fragmentList(), _xml);
+    mttm.writeTextFragments(fragmentList(rmk), _xml);
     _xml.endElement();
     const auto offset = calculateTimeDeltaInDivisions(rmk->tick(), tick(), div);
     if (offset) {
@@ -5207,7 +5275,7 @@ void ExportMusicXml::dynamic(Dynamic const* const dyn, staff_idx_t staff)
 
         QString dynText = dynTypeName;
         if (dyn->dynamicType() == DynamicType::OTHER || hasCustomText) {
-            dynText = dyn->plainText();
+            dynText = plainText(dyn);
         }
 
         // collect consecutive runs of either dynamics glyphs
@@ -5337,7 +5405,7 @@ void ExportMusicXml::lyrics(const std::vector<Lyrics*>& ll, const track_idx_t tr
                 defFmt.setFontSize(_score->style().styleD(Sid::lyricsOddFontSize));
                 // write formatted
                 MScoreTextToMXML mttm("text", attr, defFmt, mtf);
-                mttm.writeTextFragments(l->fragmentList(), _xml);
+                mttm.writeTextFragments(fragmentList(l), _xml);
                 if (l->ticks().isNotZero()) {
                     _xml.tag("extend");
                 }
@@ -6287,12 +6355,7 @@ void ExportMusicXml::keysigTimesig(const Measure* m, const Part* p)
     } else {
         // always write a keysig at tick = 0
         if (m->tick().isZero()) {
-            //KeySigEvent kse;
-            //kse.setKey(Key::C);
-            KeySig* ks = Factory::createKeySig(_score->dummy()->segment());
-            ks->setKey(Key::C);
-            keysig(ks, p->staff(0)->clef(m->tick()));
-            delete ks;
+            keysig(_defaultKeySig, p->staff(0)->clef(m->tick()));
         }
     }
 
@@ -7564,76 +7627,328 @@ void MeasurePrintContext::measureWritten(const Measure* m)
     prevMeasure = m;
 }
 
+//---------------------------------------------------------
+//  writePart
+//---------------------------------------------------------
+
+/**
+ Write part \a partIndex, whose first staff is \a staffCount.
+ */
+
+void ExportMusicXml::writePart(const size_t partIndex, const int staffCount)
+{
+    const auto part = _score->parts().at(partIndex);
+    _tick = { 0, 1 };
+    _xml.startElementRaw(QString("part id=\"P%1\"").arg(partIndex + 1));
+
+    _trillStart.clear();
+    _trillStop.clear();
+    initInstrMap(instrMap, part->instruments(), _score);
+
+    MeasureNumberStateHandler mnsh;
+    FigBassMap fbMap;                     // pending figured bass extends
+
+    // set of spanners already stopped in this part
+    // required to prevent multiple spanner stops for the same spanner
+    QSet<const Spanner*> spannersStopped;
+
+    const auto& pages = _score->pages();
+    MeasurePrintContext mpc;
+
+    for (size_t pageIndex = 0; pageIndex < pages.size(); ++pageIndex) {
+        const auto page = pages.at(pageIndex);
+        mpc.pageStart = true;
+        const auto& systems = page->systems();
+
+        for (int systemIndex = 0; systemIndex < static_cast<int>(systems.size()); ++systemIndex) {
+            const auto system = systems.at(systemIndex);
+            mpc.systemStart = true;
+
+            for (const auto mb : system->measures()) {
+                if (!mb->isMeasure()) {
+                    continue;
+                }
+                const auto m = toMeasure(mb);
+
+                if (m->isMMRest()) {
+                    // in case of a multimeasure rest (which is a single measure in MuseScore), write the measure range it replaces
+                    const auto m2 = m->mmRestLast()->nextMeasure();
+                    for (auto m1 = m->mmRestFirst(); m1 != m2; m1 = m1->nextMeasure()) {
+                        if (m1->isMeasure()) {
+                            writeMeasure(m1, static_cast<int>(partIndex), staffCount, mnsh, fbMap, mpc, spannersStopped);
+                            mpc.measureWritten(m1);
+                        }
+                    }
+                } else {
+                    // write the measure (or, if measure repeat, the "underlying" measure that it indicates for the musician to play)
+                    writeMeasure(m, static_cast<int>(partIndex), staffCount, mnsh, fbMap, mpc, spannersStopped);
+                    mpc.measureWritten(m);
+                }
+            }
+            mpc.prevSystem = system;
+        }
+        mpc.lastSystemPrevPage = mpc.prevSystem;
+    }
+
+    _xml.endElement();
+}
+
+//---------------------------------------------------------
+//  writePartToBuffer
+//---------------------------------------------------------
+
+/**
+ Write part \a partIndex and return it as it appears in the document.
+ */
+
+mu::ByteArray ExportMusicXml::writePartToBuffer(const size_t partIndex, const int staffCount)
+{
+    mu::io::Buffer buf;
+    buf.open(mu::io::IODevice::WriteOnly);
+    _xml.setDevice(&buf);
+
+    // the parent element is only written to get the indentation of the document
+    _xml.startElement("score-partwise");
+    _xml.flush();
+    const size_t parentSize = buf.data().size();
+
+    writePart(partIndex, staffCount);
+    _xml.flush();
+    _xml.setDevice(nullptr);
+
+    return buf.data().right(buf.data().size() - parentSize);
+}
+
+//---------------------------------------------------------
+//  hasOpenSpanners
+//---------------------------------------------------------
+
+/**
+ Return true if a spanner is left in progress, it would be carried to the next part.
+ */
+
+bool ExportMusicXml::hasOpenSpanners() const
+{
+    for (int i = 0; i < MAX_NUMBER_LEVEL; ++i) {
+        if (brackets[i] || dashes[i] || hairpins[i] || ottavas[i] || trills[i]) {
+            return true;
+        }
+    }
+
+    return !sh.isEmpty() || !gh.isEmpty();
+}
+
+//---------------------------------------------------------
+//  convertTextsWithoutLayout
+//---------------------------------------------------------
+
+/**
+ Convert the texts without a valid layout, see TextConversion.
+ */
+
+void ExportMusicXml::convertTextsWithoutLayout()
+{
+    std::shared_ptr<TextConversions> conversions = std::make_shared<TextConversions>();
+
+    _score->scanElements(conversions.get(), [](void* data, EngravingItem* e) {
+        if (!e->isTextBase()) {
+            return;
+        }
+
+        const TextBase* text = toTextBase(e);
+        const TextBase::LayoutData* ldata = text->layoutData();
+        if (ldata && !ldata->layoutInvalid) {
+            return;
+        }
+
+        TextConversion& conversion = (*static_cast<TextConversions*>(data))[text];
+        conversion.plainText = text->plainText();
+        conversion.fragments = text->fragmentList();
+    });
+
+    _textConversions = conversions;
+}
+
+//---------------------------------------------------------
+//  plainText
+//---------------------------------------------------------
+
+/**
+ Return the plain text of \a text.
+ */
+
+QString ExportMusicXml::plainText(const TextBase* text) const
+{
+    if (_textConversions) {
+        auto it = _textConversions->find(text);
+        if (it != _textConversions->end()) {
+            return it->second.plainText;
+        }
+    }
+
+    return text->plainText();
+}
+
+//---------------------------------------------------------
+//  fragmentList
+//---------------------------------------------------------
+
+/**
+ Return the text fragments of \a text.
+ */
+
+std::list<TextFragment> ExportMusicXml::fragmentList(const TextBase* text) const
+{
+    if (_textConversions) {
+        auto it = _textConversions->find(text);
+        if (it != _textConversions->end()) {
+            return it->second.fragments;
+        }
+    }
+
+    return text->fragmentList();
+}
+
 //---------------------------------------------------------
 //  writeParts
 //---------------------------------------------------------
 
 /**
  Write all parts.
+ The parts are written concurrently, each one by its own exporter starting with no spanners
+ in progress, and put in the document in order as soon as they are complete; the parts are
+ started in order and at most a few ahead of the last one in the document, so only these are
+ held in memory. A part that leaves a spanner in progress would change the next ones, so these
+ are written again continuing its state: the document is always the same as written part by part.
  */
 
 void ExportMusicXml::writeParts()
 {
-    int staffCount = 0;
     const auto& parts = _score->parts();
 
-    for (size_t partIndex = 0; partIndex < parts.size(); ++partIndex) {
-        const auto part = parts.at(partIndex);
-        _tick = { 0, 1 };
-        _xml.startElementRaw(QString("part id=\"P%1\"").arg(partIndex + 1));
+    std::vector<int> staffCounts;
+    int staffCount = 0;
+    for (const Part* part : parts) {
+        staffCounts.push_back(staffCount);
+        staffCount += static_cast<int>(part->nstaves());
+    }
 
-        _trillStart.clear();
-        _trillStop.clear();
-        initInstrMap(instrMap, part->instruments(), _score);
+    if (parts.size() < 2) {
+        for (size_t partIndex = 0; partIndex < parts.size(); ++partIndex) {
+            writePart(partIndex, staffCounts.at(partIndex));
+        }
+        return;
+    }
 
-        MeasureNumberStateHandler mnsh;
-        FigBassMap fbMap;                     // pending figured bass extends
+    // the data read by all parts which is lazily created on first access
+    _score->spannerMap().updateIfDirty();
+    convertTextsWithoutLayout();
+
+    struct PartJob {
+        std::unique_ptr<ExportMusicXml> exporter;
+        mu::ByteArray data;
+        bool done = false;
+    };
+
+    TaskScheduler* scheduler = TaskScheduler::instance();
+    const size_t helperCount = std::min<size_t>(parts.size() - 1, scheduler->threadPoolSize());
+    const size_t window = 2 * (helperCount + 1);
+
+    std::vector<PartJob> jobs(parts.size());
+    std::atomic<size_t> nextPart = 0;
+    std::atomic<size_t> writtenParts = 0;
+    std::atomic<size_t> activeHelpers = 0;
+    std::mutex mutex;
+    std::condition_variable partDone;
+
+    auto writeNextPart = [&]() {
+        // claim the next part only while it is in the window, the check and the claim being one step
+        size_t partIndex = nextPart.load();
+        do {
+            if (partIndex >= parts.size() || partIndex >= writtenParts.load() + window) {
+                return false;
+            }
+        } while (!nextPart.compare_exchange_weak(partIndex, partIndex + 1));
 
-        // set of spanners already stopped in this part
-        // required to prevent multiple spanner stops for the same spanner
-        QSet<const Spanner*> spannersStopped;
+        std::unique_ptr<ExportMusicXml> exporter = std::make_unique<ExportMusicXml>(this);
+        mu::ByteArray data = exporter->writePartToBuffer(partIndex, staffCounts.at(partIndex));
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            jobs[partIndex].exporter = std::move(exporter);
+            jobs[partIndex].data = std::move(data);
+            jobs[partIndex].done = true;
+        }
+        partDone.notify_all();
+        return true;
+    };
 
-        const auto& pages = _score->pages();
-        MeasurePrintContext mpc;
+    auto helper = [&]() {
+        while (writeNextPart()) {
+        }
+        activeHelpers.fetch_sub(1);
+    };
 
-        for (size_t pageIndex = 0; pageIndex < pages.size(); ++pageIndex) {
-            const auto page = pages.at(pageIndex);
-            mpc.pageStart = true;
-            const auto& systems = page->systems();
+    TaskScheduler::TaskGroup group(scheduler);
+    auto startHelpers = [&]() {
+        while (activeHelpers.load() < helperCount && nextPart.load() < parts.size()) {
+            activeHelpers.fetch_add(1);
+            group.run(helper);
+        }
+    };
 
-            for (int systemIndex = 0; systemIndex < static_cast<int>(systems.size()); ++systemIndex) {
-                const auto system = systems.at(systemIndex);
-                mpc.systemStart = true;
+    startHelpers();
 
-                for (const auto mb : system->measures()) {
-                    if (!mb->isMeasure()) {
-                        continue;
-                    }
-                    const auto m = toMeasure(mb);
-
-                    if (m->isMMRest()) {
-                        // in case of a multimeasure rest (which is a single measure in MuseScore), write the measure range it replaces
-                        const auto m2 = m->mmRestLast()->nextMeasure();
-                        for (auto m1 = m->mmRestFirst(); m1 != m2; m1 = m1->nextMeasure()) {
-                            if (m1->isMeasure()) {
-                                writeMeasure(m1, static_cast<int>(partIndex), staffCount, mnsh, fbMap, mpc, spannersStopped);
-                                mpc.measureWritten(m1);
-                            }
-                        }
-                    } else {
-                        // write the measure (or, if measure repeat, the "underlying" measure that it indicates for the musician to play)
-                        writeMeasure(m, static_cast<int>(partIndex), staffCount, mnsh, fbMap, mpc, spannersStopped);
-                        mpc.measureWritten(m);
-                    }
+    _xml.flush();
+
+    for (size_t partIndex = 0; partIndex < parts.size(); ++partIndex) {
+        PartJob& job = jobs[partIndex];
+
+        // write parts here too instead of only waiting for the helpers
+        for (;;) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (job.done) {
+                    break;
                 }
-                mpc.prevSystem = system;
             }
-            mpc.lastSystemPrevPage = mpc.prevSystem;
+
+            if (!writeNextPart()) {
+                std::unique_lock<std::mutex> lock(mutex);
+                partDone.wait(lock, [&job]() { return job.done; });
+                break;
+            }
         }
 
-        staffCount += static_cast<int>(part->nstaves());
-        _xml.endElement();
+        if (partIndex > 0 && jobs[partIndex - 1].exporter->hasOpenSpanners()) {
+            job.exporter = std::make_unique<ExportMusicXml>(jobs[partIndex - 1].exporter.get());
+            job.data = job.exporter->writePartToBuffer(partIndex, staffCounts.at(partIndex));
+        }
+
+        _dev->write(job.data);
+        job.data = mu::ByteArray();
+        if (partIndex > 0) {
+            jobs[partIndex - 1].exporter.reset();
+        }
+
+        writtenParts.store(partIndex + 1);
+        startHelpers();
+    }
+
+    group.wait();
+
+    // continue with the state of the last part, as if written here
+    const ExportMusicXml* last = jobs.back().exporter.get();
+    sh = last->sh;
+    gh = last->gh;
+    for (int i = 0; i < MAX_NUMBER_LEVEL; ++i) {
+        brackets[i] = last->brackets[i];
+        dashes[i] = last->dashes[i];
+        hairpins[i] = last->hairpins[i];
+        ottavas[i] = last->ottavas[i];
+        trills[i] = last->trills[i];
     }
+
+    _textConversions.reset();
 }
 
 //---------------------------------------------------------
@@ -7688,6 +8003,10 @@ void ExportMusicXml::write(mu::io::IODevice* dev)
 
     _jumpElements = findJumpElements(_score);
 
+    _defaultKeySig = Factory::createKeySig(_score->dummy()->segment());
+    _defaultKeySig->setKey(Key::C);
+
+    _dev = dev;
     _xml.setDevice(dev);
     _xml.startDocument();
     _xml.writeDoctype(u"score-partwise PUBLIC \"-//Recordare//DTD MusicXML 4.0 Partwise//EN\" \"http://www.musicxml.org/dtds/partwise.dtd\"");
@@ -7706,6 +8025,10 @@ void ExportMusicXml::write(mu::io::IODevice* dev)
     writeParts();
 
     _xml.endElement();
+    _xml.flush();
+
+    delete _defaultKeySig;
+    _defaultKeySig = nullptr;
 
     if (concertPitch) {
         // restore concert pitch
@@ -7765,6 +8088,42 @@ bool saveXml(Score* score, const QString& name)
 //     </rootfiles>
 // </container>
 
+//---------------------------------------------------------
+//   ZipFileDevice
+//---------------------------------------------------------
+
+/**
+ Write-only device passing the data to the file being added to a zip archive.
+ */
+
+class ZipFileDevice : public mu::io::IODevice
+{
+public:
+    explicit ZipFileDevice(MQZipWriter& zipwriter)
+        : m_zipwriter(zipwriter) {}
+
+protected:
+    bool doOpen(OpenMode m) override { return m == OpenMode::WriteOnly; }
+    size_t dataSize() const override { return m_size; }
+    const uint8_t* rawData() const override { return nullptr; }
+
+    bool resizeData(size_t size) override
+    {
+        m_size = size;
+        return true;
+    }
+
+    size_t writeData(const uint8_t* data, size_t len) override
+    {
+        m_zipwriter.writeFileData(reinterpret_cast<const char*>(data), static_cast<qint64>(len));
+        return len;
+    }
+
+private:
+    MQZipWriter& m_zipwriter;
+    size_t m_size = 0;
+};
+
 static void writeMxlArchive(Score* score, MQZipWriter& zipwriter, const QString& filename)
 {
     mu::io::Buffer cbuf;
@@ -7783,12 +8142,13 @@ static void writeMxlArchive(Score* score, MQZipWriter& zipwriter, const QString&
 
     zipwriter.addFile("META-INF/container.xml", cbuf.data().toQByteArrayNoCopy());
 
-    mu::io::Buffer dbuf;
-    dbuf.open(mu::io::IODevice::ReadWrite);
+    // the document is compressed while it is written, it is never held in memory as a whole
+    ZipFileDevice dev(zipwriter);
+    dev.open(mu::io::IODevice::WriteOnly);
+    zipwriter.startFile(filename);
     ExportMusicXml em(score);
-    em.write(&dbuf);
-    dbuf.seek(0);
-    zipwriter.addFile(filename, dbuf.data().toQByteArrayNoCopy());
+    em.write(&dev);
+    zipwriter.finishFile();
 }
 
 bool saveMxl(Score* score, QIODevice* device)
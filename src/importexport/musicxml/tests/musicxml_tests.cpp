@@ -24,6 +24,7 @@
 
 #include "engraving/engravingerrors.h"
 #include "engraving/dom/masterscore.h"
+#include "engraving/dom/spanner.h"
 
 #include "settings.h"
 #include "importexport/musicxml/imusicxmlconfiguration.h"
@@ -784,6 +785,37 @@ TEST_F(Musicxml_Tests, sound1) {
 TEST_F(Musicxml_Tests, sound2) {
     mxmlIoTestRef("testSound2");
 }
+TEST_F(Musicxml_Tests, spannersAcrossParts) {
+    MScore::debugMode = true;
+
+    setValue(PREF_EXPORT_MUSICXML_EXPORTBREAKS, Val(IMusicXmlConfiguration::MusicxmlExportBreaksType::Manual));
+    setValue(PREF_EXPORT_MUSICXML_EXPORTLAYOUT, Val(false));
+    setValue(PREF_EXPORT_MUSICXML_EXPORTINVISIBLE, Val(true));
+
+    MasterScore* score = readScore(XML_IO_DATA_DIR + u"testTextLines.mscx");
+    ASSERT_TRUE(score);
+    fixupScore(score);
+
+    // end the hairpin of the first part within a note: its stop is never written, so it is
+    // still in progress when the second part is written, which must continue its state
+    Spanner* hairpin = nullptr;
+    for (auto it : score->spanner()) {
+        if (it.second->isHairpin() && it.second->staffIdx() == 0) {
+            hairpin = it.second;
+            break;
+        }
+    }
+    ASSERT_TRUE(hairpin);
+    score->removeSpanner(hairpin);
+    hairpin->setTick2(Fraction(3, 2));
+    score->addSpanner(hairpin);
+    score->doLayout();
+
+    // the reference is the document written part by part with a single exporter
+    EXPECT_TRUE(saveCompareMusicXmlScore(score, u"testSpannersAcrossParts.xml",
+                                         XML_IO_DATA_DIR + u"testSpannersAcrossParts_ref.xml"));
+    delete score;
+}
 TEST_F(Musicxml_Tests, specialCharacters) {
     mxmlIoTest("testSpecialCharacters");
 }
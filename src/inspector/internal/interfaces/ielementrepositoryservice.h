@@ -23,13 +23,24 @@
 #define MU_INSPECTOR_IELEMENTREPOSITORYSERVICE_H
 
 #include "engraving/dom/engravingitem.h"
+#include "engraving/dom/property.h"
 #include "engraving/dom/select.h"
+#include "engraving/style/styledef.h"
 
 #include <QList>
 #include <QObject>
+#include <QVariant>
 #include <functional>
 
 namespace mu::inspector {
+//! NOTE The value of a property over all elements of a list, as it is shown in the inspector
+struct AggregatedPropertyValue
+{
+    QVariant value;
+    QVariant defaultValue;
+    bool isUndefined = false;
+};
+
 class IElementRepositoryService
 {
 public:
@@ -47,6 +58,16 @@ public:
     const = 0;
     virtual QList<mu::engraving::EngravingItem*> takeAllElements() const = 0;
 
+    //! NOTE The aggregated values are shared between all models that show the same element list.
+    //! They are kept until the selection changes or the property is reported as changed
+    using AggregatePropertyValueFunc = std::function<AggregatedPropertyValue()>;
+    virtual AggregatedPropertyValue aggregatedPropertyValue(const QList<mu::engraving::EngravingItem*>& elements,
+                                                            const mu::engraving::Pid pid,
+                                                            const AggregatePropertyValueFunc& aggregateFunc) const = 0;
+    virtual void invalidatePropertyValues(const mu::engraving::PropertyIdSet& propertyIdSet,
+                                          const mu::engraving::StyleIdSet& styleIdSet) = 0;
+    virtual void resetCache() = 0;
+
 signals:
     virtual void elementsUpdated(const QList<mu::engraving::EngravingItem*>& newRawElementList) = 0;
 };
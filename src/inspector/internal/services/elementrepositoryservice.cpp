@@ -69,6 +69,8 @@ void ElementRepositoryService::updateElementList(const QList<EngravingItem*>& ne
         return;
     }
 
+    resetCache();
+
     m_exposedElementList = exposeRawElements(newRawElementList);
     m_rawElementList = newRawElementList;
     m_selectionState = selectionState;
@@ -77,6 +79,16 @@ void ElementRepositoryService::updateElementList(const QList<EngravingItem*>& ne
 }
 
 QList<mu::engraving::EngravingItem*> ElementRepositoryService::findElementsByType(const mu::engraving::ElementType elementType) const
+{
+    auto it = m_elementsByType.constFind(elementType);
+    if (it == m_elementsByType.cend()) {
+        it = m_elementsByType.insert(elementType, collectElementsByType(elementType));
+    }
+
+    return it.value();
+}
+
+QList<mu::engraving::EngravingItem*> ElementRepositoryService::collectElementsByType(const mu::engraving::ElementType elementType) const
 {
     switch (elementType) {
     case mu::engraving::ElementType::CHORD: return findChords();
@@ -139,6 +151,52 @@ QList<mu::engraving::EngravingItem*> ElementRepositoryService::takeAllElements()
     return m_exposedElementList;
 }
 
+AggregatedPropertyValue ElementRepositoryService::aggregatedPropertyValue(const QList<EngravingItem*>& elements, const Pid pid,
+                                                                          const AggregatePropertyValueFunc& aggregateFunc) const
+{
+    if (elements.isEmpty()) {
+        return aggregateFunc();
+    }
+
+    PropertyValueCache& cache = m_propertyValueCaches[elements.constData()];
+    if (cache.elements.isEmpty()) {
+        cache.elements = elements;
+    } else if (cache.elements.size() != elements.size()) {
+        return aggregateFunc();
+    }
+
+    auto it = cache.values.find(pid);
+    if (it == cache.values.end()) {
+        it = cache.values.emplace(pid, aggregateFunc()).first;
+    }
+
+    return it->second;
+}
+
+void ElementRepositoryService::invalidatePropertyValues(const PropertyIdSet& propertyIdSet, const StyleIdSet& styleIdSet)
+{
+    //! NOTE Any styled property may depend on the changed styles
+    if (!styleIdSet.empty()) {
+        for (auto& pair : m_propertyValueCaches) {
+            pair.second.values.clear();
+        }
+
+        return;
+    }
+
+    for (auto& pair : m_propertyValueCaches) {
+        for (const Pid pid : propertyIdSet) {
+            pair.second.values.erase(pid);
+        }
+    }
+}
+
+void ElementRepositoryService::resetCache()
+{
+    m_elementsByType.clear();
+    m_propertyValueCaches.clear();
+}
+
 QList<mu::engraving::EngravingItem*> ElementRepositoryService::exposeRawElements(const QList<mu::engraving::EngravingItem*>& rawElementList)
 const
 {
@@ -25,6 +25,9 @@
 #include "internal/interfaces/ielementrepositoryservice.h"
 
 #include <QObject>
+#include <QHash>
+
+#include <unordered_map>
 
 namespace mu::inspector {
 class ElementRepositoryService : public QObject, public IElementRepositoryService
@@ -45,12 +48,19 @@ public:
     override;
     QList<mu::engraving::EngravingItem*> takeAllElements() const override;
 
+    AggregatedPropertyValue aggregatedPropertyValue(const QList<mu::engraving::EngravingItem*>& elements, const mu::engraving::Pid pid,
+                                                    const AggregatePropertyValueFunc& aggregateFunc) const override;
+    void invalidatePropertyValues(const mu::engraving::PropertyIdSet& propertyIdSet, const mu::engraving::StyleIdSet& styleIdSet) override;
+    void resetCache() override;
+
 signals:
     void elementsUpdated(const QList<mu::engraving::EngravingItem*>& newRawElementList) override;
 
 private:
     QList<mu::engraving::EngravingItem*> exposeRawElements(const QList<mu::engraving::EngravingItem*>& rawElementList) const;
 
+    QList<mu::engraving::EngravingItem*> collectElementsByType(const mu::engraving::ElementType elementType) const;
+
     QList<mu::engraving::EngravingItem*> findChords() const;
     QList<mu::engraving::EngravingItem*> findNotes() const;
     QList<mu::engraving::EngravingItem*> findElementsForNotes() const;
@@ -70,6 +80,17 @@ private:
     QList<mu::engraving::EngravingItem*> m_exposedElementList;
     QList<mu::engraving::EngravingItem*> m_rawElementList;
     mu::engraving::SelState m_selectionState = mu::engraving::SelState::NONE;
+
+    struct PropertyValueCache {
+        //! NOTE Holds the list data, so the address used as the key can't be reused by another list
+        QList<mu::engraving::EngravingItem*> elements;
+        std::unordered_map<mu::engraving::Pid, AggregatedPropertyValue> values;
+    };
+
+    //! NOTE The models showing the same element type get the same list,
+    //! so the property values of this list are aggregated only once for all of them
+    mutable QHash<mu::engraving::ElementType, QList<mu::engraving::EngravingItem*> > m_elementsByType;
+    mutable std::unordered_map<const void*, PropertyValueCache> m_propertyValueCaches;
 };
 }
 
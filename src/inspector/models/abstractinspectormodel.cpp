@@ -113,17 +113,34 @@ static QMap<mu::engraving::LayoutBreakType, InspectorModelType> LAYOUT_BREAK_ELE
 
 AbstractInspectorModel::AbstractInspectorModel(QObject* parent, IElementRepositoryService* repository,
                                                mu::engraving::ElementType elementType)
-    : QObject(parent), m_elementType(elementType), m_updatePropertiesAllowed(true)
+    : QObject(parent), m_elementType(elementType), m_updatePropertiesAllowed(true),
+    m_notationChanges("inspector.notationChanges", [](std::tuple<ChangesRange>& pending, const ChangesRange& range) {
+        std::get<0>(pending).merge(range);
+    })
 {
     m_repository = repository;
 
+    m_notationChanges.onReceive(this, [this](const ChangesRange& range) {
+        if (isEmpty()) {
+            return;
+        }
+
+        PropertyIdSet expandedPropertyIdSet = propertyIdSetFromStyleIdSet(range.changedStyleIdSet);
+        expandedPropertyIdSet.insert(range.changedPropertyIdSet.cbegin(), range.changedPropertyIdSet.cend());
+        onNotationChanged(expandedPropertyIdSet, range.changedStyleIdSet);
+    });
+
     if (!m_repository) {
         return;
     }
 
     connect(m_repository->getQObject(), SIGNAL(elementsUpdated(const QList<mu::engraving::EngravingItem*>&)), this,
             SLOT(updateProperties()));
-    connect(this, &AbstractInspectorModel::requestReloadPropertyItems, this, &AbstractInspectorModel::updateProperties);
+    connect(this, &AbstractInspectorModel::requestReloadPropertyItems, this, [this]() {
+        //! NOTE The model has changed the elements itself, so nothing cached about them can be trusted
+        m_repository->resetCache();
+        updateProperties();
+    });
 }
 
 void AbstractInspectorModel::init()
@@ -133,6 +150,9 @@ void AbstractInspectorModel::init()
 
 void AbstractInspectorModel::onCurrentNotationChanged()
 {
+    //! NOTE The pending changes belong to the previous notation
+    m_notationChanges.cancel();
+
     INotationPtr notation = currentNotation();
     if (!notation) {
         return;
@@ -144,9 +164,7 @@ void AbstractInspectorModel::onCurrentNotationChanged()
         }
 
         if (m_updatePropertiesAllowed && !isEmpty()) {
-            PropertyIdSet expandedPropertyIdSet = propertyIdSetFromStyleIdSet(range.changedStyleIdSet);
-            expandedPropertyIdSet.insert(range.changedPropertyIdSet.cbegin(), range.changedPropertyIdSet.cend());
-            onNotationChanged(expandedPropertyIdSet, range.changedStyleIdSet);
+            m_notationChanges.send(range);
         }
 
         m_updatePropertiesAllowed = true;
@@ -558,10 +576,30 @@ void AbstractInspectorModel::loadPropertyItem(PropertyItem* propertyItem, const
     mu::engraving::Sid styleId = styleIdByPropertyId(pid);
     propertyItem->setStyleId(styleId);
 
-    QVariant propertyValue;
-    QVariant defaultPropertyValue;
+    //! NOTE The converted values may compare differently than the original ones,
+    //! so only the unconverted aggregations are shared
+    AggregatedPropertyValue aggregated;
+    if (m_repository && !convertElementPropertyValueFunc) {
+        aggregated = m_repository->aggregatedPropertyValue(elements, pid, [this, pid, &elements]() {
+            return aggregatePropertyValue(pid, elements);
+        });
+    } else {
+        aggregated = aggregatePropertyValue(pid, elements, convertElementPropertyValueFunc);
+    }
+
+    //@note Some elements may support the property, some don't. If element doesn't support property it'll return invalid value.
+    //      So we use that knowledge here
+    propertyItem->setIsEnabled(aggregated.value.isValid());
 
-    bool isUndefined = false;
+    QVariant propertyValue = aggregated.isUndefined ? QVariant() : aggregated.value;
+
+    propertyItem->fillValues(propertyValue, aggregated.defaultValue);
+}
+
+AggregatedPropertyValue AbstractInspectorModel::aggregatePropertyValue(const mu::engraving::Pid pid, const QList<EngravingItem*>& elements,
+                                                                       ConvertPropertyValueFunc convertElementPropertyValueFunc) const
+{
+    AggregatedPropertyValue result;
 
     for (const mu::engraving::EngravingItem* element : elements) {
         IF_ASSERT_FAILED(element) {
@@ -582,27 +620,19 @@ void AbstractInspectorModel::loadPropertyItem(PropertyItem* propertyItem, const
             elementDefaultValue = convertElementPropertyValueFunc(elementDefaultValue);
         }
 
-        if (!(propertyValue.isValid() && defaultPropertyValue.isValid())) {
-            propertyValue = elementCurrentValue;
-            defaultPropertyValue = elementDefaultValue;
+        if (!(result.value.isValid() && result.defaultValue.isValid())) {
+            result.value = elementCurrentValue;
+            result.defaultValue = elementDefaultValue;
         }
 
-        isUndefined = propertyValue != elementCurrentValue;
+        result.isUndefined = result.value != elementCurrentValue;
 
-        if (isUndefined) {
+        if (result.isUndefined) {
             break;
         }
     }
 
-    //@note Some elements may support the property, some don't. If element doesn't support property it'll return invalid value.
-    //      So we use that knowledge here
-    propertyItem->setIsEnabled(propertyValue.isValid());
-
-    if (isUndefined) {
-        propertyValue = QVariant();
-    }
-
-    propertyItem->fillValues(propertyValue, defaultPropertyValue);
+    return result;
 }
 
 bool AbstractInspectorModel::isNotationExisting() const
@@ -26,6 +26,7 @@
 #include <functional>
 
 #include "async/asyncable.h"
+#include "async/coalescedchannel.h"
 
 #include "engraving/dom/engravingitem.h"
 #include "engraving/dom/property.h"
@@ -223,6 +224,9 @@ private:
                           std::function<void(const mu::engraving::Sid styleId,
                                              const QVariant& newValue)> onStyleChangedCallBack = nullptr);
 
+    AggregatedPropertyValue aggregatePropertyValue(const mu::engraving::Pid pid, const QList<engraving::EngravingItem*>& elements,
+                                                   ConvertPropertyValueFunc convertElementPropertyValueFunc = nullptr) const;
+
     mu::engraving::Sid styleIdByPropertyId(const mu::engraving::Pid pid) const;
     mu::engraving::PropertyIdSet propertyIdSetFromStyleIdSet(const mu::engraving::StyleIdSet& styleIdSet) const;
 
@@ -232,6 +236,9 @@ private:
     InspectorModelType m_modelType = InspectorModelType::TYPE_UNDEFINED;
     mu::engraving::ElementType m_elementType = mu::engraving::ElementType::INVALID;
     bool m_updatePropertiesAllowed = false;
+
+    //! NOTE The changes made during one event loop turn (e.g. while dragging) update the model once
+    async::CoalescedChannel<notation::ChangesRange> m_notationChanges;
 };
 
 using InspectorModelType = AbstractInspectorModel::InspectorModelType;
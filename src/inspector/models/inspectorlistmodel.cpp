@@ -43,6 +43,8 @@ InspectorListModel::InspectorListModel(QObject* parent)
 
     listenSelectionChanged();
     context()->currentNotationChanged().onNotify(this, [this]() {
+        m_repository->resetCache();
+
         listenSelectionChanged();
 
         notifyModelsAboutNotationChanged();
@@ -309,5 +311,10 @@ void InspectorListModel::listenSelectionChanged()
     INotationPtr notation = context()->currentNotation();
     if (notation) {
         notation->interaction()->selectionChanged().onNotify(this, updateElementList);
+
+        //! NOTE Drops only the cached values of the changed properties before the models reload them
+        notation->undoStack()->changesChannel().onReceive(this, [this](const ChangesRange& range) {
+            m_repository->invalidatePropertyValues(range.changedPropertyIdSet, range.changedStyleIdSet);
+        });
     }
 }
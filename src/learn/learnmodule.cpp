@@ -44,6 +44,11 @@ std::string LearnModule::moduleName() const
     return "learn";
 }
 
+bool LearnModule::isInitOnDemandAllowed() const
+{
+    return true;
+}
+
 void LearnModule::registerExports()
 {
     m_learnConfiguration = std::make_shared<LearnConfiguration>();
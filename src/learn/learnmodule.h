@@ -33,6 +33,7 @@ class LearnModule : public modularity::IModuleSetup
 {
 public:
     std::string moduleName() const override;
+    bool isInitOnDemandAllowed() const override;
     void registerExports() override;
     void registerResources() override;
     void registerUiTypes() override;
@@ -22,46 +22,59 @@
 #include "ipc.h"
 
 #include <QDataStream>
-
-#include <QJsonDocument>
-#include <QJsonObject>
-#include <QJsonArray>
-
 #include <QLocalSocket>
 
 #include "ipclog.h"
 
+//! NOTE Binary framing: every field is written as a length-prefixed utf8 string,
+//! the args as their count followed by the args
+static constexpr QDataStream::Version STREAM_VERSION = QDataStream::Qt_5_15;
+
 void mu::ipc::serialize(const Msg& msg, QByteArray& data)
 {
-    QJsonObject msgObj;
+    data.clear();
+
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    stream.setVersion(STREAM_VERSION);
 
-    msgObj["srcID"] = msg.srcID;
-    msgObj["destID"] = msg.destID;
-    msgObj["type"] = static_cast<int>(msg.type);
-    msgObj["method"] = msg.method;
+    stream << msg.srcID.toUtf8();
+    stream << msg.destID.toUtf8();
+    stream << static_cast<qint8>(msg.type);
+    stream << msg.method.toUtf8();
 
-    QJsonArray argsArr;
+    stream << static_cast<quint32>(msg.args.size());
     for (const QString& arg : qAsConst(msg.args)) {
-        argsArr.append(arg);
+        stream << arg.toUtf8();
     }
-    msgObj["args"] = argsArr;
-
-    data = QJsonDocument(msgObj).toJson(QJsonDocument::Compact);
 }
 
 void mu::ipc::deserialize(const QByteArray& data, Msg& msg)
 {
-    QJsonDocument doc = QJsonDocument::fromJson(data);
-    QJsonObject msgObj = doc.object();
-
-    msg.srcID =  msgObj.value("srcID").toString();
-    msg.destID =  msgObj.value("destID").toString();
-    msg.type = static_cast<MsgType>(msgObj.value("type").toInt());
-    msg.method = msgObj.value("method").toString();
+    QDataStream stream(data);
+    stream.setVersion(STREAM_VERSION);
+
+    QByteArray srcID;
+    QByteArray destID;
+    qint8 type = 0;
+    QByteArray method;
+    quint32 argsCount = 0;
+
+    stream >> srcID >> destID >> type >> method >> argsCount;
+
+    msg.srcID = QString::fromUtf8(srcID);
+    msg.destID = QString::fromUtf8(destID);
+    msg.type = static_cast<MsgType>(type);
+    msg.method = QString::fromUtf8(method);
+
+    for (quint32 i = 0; i < argsCount && stream.status() == QDataStream::Ok; ++i) {
+        QByteArray arg;
+        stream >> arg;
+        msg.args << QString::fromUtf8(arg);
+    }
 
-    QJsonArray argsArr = msgObj.value("args").toArray();
-    for (int i = 0; i < argsArr.count(); ++i) {
-        msg.args << argsArr.at(i).toString();
+    if (stream.status() != QDataStream::Ok) {
+        LOGE() << "failed to deserialize ipc message";
+        msg = Msg();
     }
 }
 
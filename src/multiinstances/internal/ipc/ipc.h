@@ -30,7 +30,8 @@
 class QLocalSocket;
 
 namespace mu::ipc {
-static const QString SERVER_NAME("musescore-app-ipc");
+//! NOTE The version is a part of the name, instances with a different message format don't see each other
+static const QString SERVER_NAME("musescore-app-ipc-v2");
 
 using ID = QString;
 
@@ -0,0 +1,309 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "ipcregistry.h"
+
+#include <atomic>
+#include <thread>
+
+#include <QSharedMemory>
+
+#include "ipclog.h"
+
+using namespace mu::ipc;
+
+static const QString REGISTRY_NAME = SERVER_NAME + "-registry";
+
+static constexpr uint32_t REGISTRY_MAGIC = 0x4D534952; // MSIR
+static constexpr uint32_t REGISTRY_VERSION = 1;
+static constexpr int MAX_INSTANCES = 64;
+static constexpr int MAX_READ_ATTEMPTS = 100;
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free && std::atomic<uint64_t>::is_always_lock_free,
+              "The registry relies on lock-free atomics in shared memory");
+
+//! NOTE The layout is shared between processes, so it may only contain lock-free atomics.
+//! The shared memory is zero-filled on creation, which is a valid initial state for all the fields.
+struct IpcRegistry::Data {
+    struct Slot {
+        std::atomic<uint32_t> seq;   // odd while the slot is being written
+        std::atomic<uint32_t> flags;
+        std::atomic<uint64_t> idHi;  // zero id means a free slot
+        std::atomic<uint64_t> idLo;
+        std::atomic<uint64_t> projectHash;
+    };
+
+    std::atomic<uint32_t> magic;
+    std::atomic<uint32_t> version;
+    Slot slots[MAX_INSTANCES];
+};
+
+static bool idToNumbers(const ID& id, uint64_t& hi, uint64_t& lo)
+{
+    //! NOTE The ids are uuids in the Id128 format (32 hex digits)
+    if (id.size() != 32) {
+        return false;
+    }
+
+    bool okHi = false;
+    bool okLo = false;
+    hi = id.left(16).toULongLong(&okHi, 16);
+    lo = id.mid(16).toULongLong(&okLo, 16);
+
+    return okHi && okLo && (hi || lo);
+}
+
+static ID idFromNumbers(uint64_t hi, uint64_t lo)
+{
+    return QString("%1%2").arg(hi, 16, 16, QChar('0')).arg(lo, 16, 16, QChar('0'));
+}
+
+IpcRegistry::IpcRegistry() = default;
+
+IpcRegistry::~IpcRegistry()
+{
+    detach();
+}
+
+IpcRegistry::Data* IpcRegistry::data() const
+{
+    return m_memory ? static_cast<Data*>(m_memory->data()) : nullptr;
+}
+
+bool IpcRegistry::attach(const ID& selfID, const QList<ID>& liveInstances)
+{
+    if (isAttached()) {
+        return true;
+    }
+
+    if (!idToNumbers(selfID, m_selfHi, m_selfLo)) {
+        LOGE() << "unexpected instance id: " << selfID;
+        return false;
+    }
+    m_selfID = selfID;
+
+    if (!m_memory) {
+        m_memory = new QSharedMemory(REGISTRY_NAME);
+    }
+
+    if (!m_memory->isAttached() && !m_memory->attach()) {
+        if (!m_memory->create(sizeof(Data)) && !m_memory->attach()) {
+            LOGW() << "failed to create the instances registry, err: " << m_memory->errorString();
+            return false;
+        }
+    }
+
+    if (m_memory->size() < static_cast<int>(sizeof(Data))) {
+        LOGE() << "unexpected size of the instances registry: " << m_memory->size();
+        m_memory->detach();
+        return false;
+    }
+
+    m_memory->lock();
+
+    Data* d = data();
+    if (d->magic.load() == 0) {
+        d->version.store(REGISTRY_VERSION);
+        d->magic.store(REGISTRY_MAGIC);
+    }
+
+    bool ok = d->magic.load() == REGISTRY_MAGIC && d->version.load() == REGISTRY_VERSION;
+    if (ok) {
+        m_selfSlot = acquireSlot(liveInstances);
+        ok = m_selfSlot >= 0;
+    }
+
+    if (ok) {
+        writeSlot(d, m_selfSlot, m_selfHi, m_selfLo, m_flags, m_projectHash);
+    }
+
+    m_memory->unlock();
+
+    if (!ok) {
+        LOGW() << "the instances registry is not available";
+        m_memory->detach();
+        m_selfSlot = -1;
+        return false;
+    }
+
+    IPCLOG() << "attached to the instances registry, slot: " << m_selfSlot;
+
+    return true;
+}
+
+void IpcRegistry::detach()
+{
+    if (!m_memory) {
+        return;
+    }
+
+    if (isAttached()) {
+        m_memory->lock();
+
+        int slot = findSelfSlot();
+        if (slot >= 0) {
+            writeSlot(data(), slot, 0, 0, NoFlags, 0);
+        }
+
+        m_memory->unlock();
+        m_memory->detach();
+    }
+
+    delete m_memory;
+    m_memory = nullptr;
+    m_selfSlot = -1;
+}
+
+bool IpcRegistry::isAttached() const
+{
+    return m_memory && m_memory->isAttached() && m_selfSlot >= 0;
+}
+
+int IpcRegistry::findSelfSlot() const
+{
+    const Data* d = data();
+    for (int i = 0; i < MAX_INSTANCES; ++i) {
+        if (d->slots[i].idHi.load() == m_selfHi && d->slots[i].idLo.load() == m_selfLo) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+int IpcRegistry::acquireSlot(const QList<ID>& liveInstances)
+{
+    int slot = findSelfSlot();
+    if (slot >= 0) {
+        return slot;
+    }
+
+    const Data* d = data();
+    for (int i = 0; i < MAX_INSTANCES; ++i) {
+        if (d->slots[i].idHi.load() == 0 && d->slots[i].idLo.load() == 0) {
+            return i;
+        }
+    }
+
+    //! NOTE The registry may be full of the slots of crashed instances
+    if (liveInstances.isEmpty()) {
+        return -1;
+    }
+
+    for (int i = 0; i < MAX_INSTANCES; ++i) {
+        ID id = idFromNumbers(d->slots[i].idHi.load(), d->slots[i].idLo.load());
+        if (!liveInstances.contains(id)) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+//! NOTE Must be called under the lock, readers see either the old or the new state of the slot
+void IpcRegistry::writeSlot(Data* data, int idx, uint64_t hi, uint64_t lo, uint32_t flags, uint64_t projectHash)
+{
+    Data::Slot& slot = data->slots[idx];
+
+    uint32_t seq = slot.seq.load(std::memory_order_relaxed);
+    slot.seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.idHi.store(hi, std::memory_order_relaxed);
+    slot.idLo.store(lo, std::memory_order_relaxed);
+    slot.flags.store(flags, std::memory_order_relaxed);
+    slot.projectHash.store(projectHash, std::memory_order_relaxed);
+
+    slot.seq.store(seq + 2, std::memory_order_release);
+}
+
+bool IpcRegistry::publish(uint32_t flags, uint64_t projectHash)
+{
+    m_flags = flags;
+    m_projectHash = projectHash;
+
+    if (!isAttached()) {
+        return false;
+    }
+
+    m_memory->lock();
+
+    //! NOTE The slot might have been reused, if another instance considered this one to be dead
+    m_selfSlot = acquireSlot({});
+    if (m_selfSlot >= 0) {
+        writeSlot(data(), m_selfSlot, m_selfHi, m_selfLo, m_flags, m_projectHash);
+    }
+
+    m_memory->unlock();
+
+    return m_selfSlot >= 0;
+}
+
+std::vector<IpcRegistry::Instance> IpcRegistry::instances() const
+{
+    std::vector<Instance> result;
+    if (!isAttached()) {
+        return result;
+    }
+
+    const Data* d = data();
+    for (int i = 0; i < MAX_INSTANCES; ++i) {
+        const Data::Slot& slot = d->slots[i];
+
+        for (int attempt = 0; attempt < MAX_READ_ATTEMPTS; ++attempt) {
+            uint32_t seqBefore = slot.seq.load(std::memory_order_acquire);
+            if (seqBefore & 1) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            uint64_t hi = slot.idHi.load(std::memory_order_relaxed);
+            uint64_t lo = slot.idLo.load(std::memory_order_relaxed);
+            uint32_t flags = slot.flags.load(std::memory_order_relaxed);
+            uint64_t projectHash = slot.projectHash.load(std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.seq.load(std::memory_order_relaxed) != seqBefore) {
+                continue;
+            }
+
+            if (hi || lo) {
+                result.push_back({ idFromNumbers(hi, lo), flags, projectHash });
+            }
+            break;
+        }
+    }
+
+    return result;
+}
+
+uint64_t IpcRegistry::projectHash(const QString& projectPath)
+{
+    //! NOTE FNV-1a, it must give the same result in all processes (unlike qHash, which is seeded)
+    uint64_t hash = 14695981039346656037ULL;
+    const QByteArray bytes = projectPath.toUtf8();
+    for (char c : bytes) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
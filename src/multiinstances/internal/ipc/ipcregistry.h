@@ -0,0 +1,88 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_IPC_IPCREGISTRY_H
+#define MU_IPC_IPCREGISTRY_H
+
+#include <cstdint>
+#include <vector>
+
+#include <QList>
+#include <QString>
+
+#include "ipc.h"
+
+class QSharedMemory;
+
+namespace mu::ipc {
+//! NOTE Registry of the running instances in shared memory.
+//! It lets the instances answer the simple queries (is a project opened, is there an instance without a project...)
+//! without a round trip over the socket. Every instance writes only its own slot, under the system lock;
+//! readers do not take any lock, each slot is guarded by a sequence counter instead.
+class IpcRegistry
+{
+public:
+    IpcRegistry();
+    ~IpcRegistry();
+
+    enum InstanceFlag : uint32_t {
+        NoFlags = 0,
+        HasProject = 1 << 0,
+        PreferencesOpened = 1 << 1,
+    };
+
+    struct Instance {
+        ID id;
+        uint32_t flags = NoFlags;
+        uint64_t projectHash = 0;
+    };
+
+    //! NOTE Slots of the instances that are not in liveInstances can be reused, if the registry is full
+    bool attach(const ID& selfID, const QList<ID>& liveInstances = {});
+    void detach();
+    bool isAttached() const;
+
+    bool publish(uint32_t flags, uint64_t projectHash);
+
+    std::vector<Instance> instances() const;
+
+    static uint64_t projectHash(const QString& projectPath);
+
+private:
+    struct Data;
+
+    Data* data() const;
+    int findSelfSlot() const;
+    int acquireSlot(const QList<ID>& liveInstances);
+    static void writeSlot(Data* data, int idx, uint64_t hi, uint64_t lo, uint32_t flags, uint64_t projectHash);
+
+    QSharedMemory* m_memory = nullptr;
+    ID m_selfID;
+    uint64_t m_selfHi = 0;
+    uint64_t m_selfLo = 0;
+    int m_selfSlot = -1;
+
+    uint32_t m_flags = NoFlags;
+    uint64_t m_projectHash = 0;
+};
+}
+
+#endif // MU_IPC_IPCREGISTRY_H
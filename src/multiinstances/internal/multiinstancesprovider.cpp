@@ -23,10 +23,10 @@
 
 #include <QProcess>
 #include <QCoreApplication>
-#include <QTimer>
-#include <QEventLoop>
 
 #include "types/uri.h"
+#include "project/inotationproject.h"
+#include "ipc/ipcloop.h"
 #include "settings.h"
 #include "log.h"
 
@@ -70,9 +70,82 @@ void MultiInstancesProvider::init()
     m_selfID = m_ipcChannel->selfID().toStdString();
 
     m_ipcChannel->msgReceived().onReceive(this, [this](const Msg& msg) { onMsg(msg); });
-    m_ipcChannel->instancesChanged().onNotify(this, [this]() { m_instancesChanged.notify(); });
+    m_ipcChannel->instancesChanged().onNotify(this, [this]() {
+        attachToRegistry();
+        m_instancesChanged.notify();
+    });
 
     m_ipcChannel->connect();
+
+    attachToRegistry();
+
+    globalContext()->currentProjectChanged().onNotify(this, [this]() {
+        if (project::INotationProjectPtr project = globalContext()->currentProject()) {
+            project->pathChanged().onNotify(this, [this]() { publishToRegistry(); });
+        }
+        publishToRegistry();
+    });
+
+    interactive()->currentUri().ch.onReceive(this, [this](const Uri&) { publishToRegistry(); });
+}
+
+void MultiInstancesProvider::attachToRegistry()
+{
+    if (m_registry.isAttached()) {
+        return;
+    }
+
+    //! NOTE If the registry is not available, the requests are sent over the socket
+    if (m_registry.attach(m_ipcChannel->selfID(), m_ipcChannel->instances())) {
+        publishToRegistry();
+    }
+}
+
+void MultiInstancesProvider::publishToRegistry()
+{
+    uint32_t flags = IpcRegistry::NoFlags;
+    uint64_t projectHash = 0;
+
+    if (project::INotationProjectPtr project = globalContext()->currentProject()) {
+        flags |= IpcRegistry::HasProject;
+        projectHash = IpcRegistry::projectHash(project->path().toQString());
+    }
+
+    if (interactive()->isOpened(PREFERENCES_URI).val) {
+        flags |= IpcRegistry::PreferencesOpened;
+    }
+
+    m_registry.publish(flags, projectHash);
+}
+
+mu::RetVal<bool> MultiInstancesProvider::findInRegistry(const std::function<bool(const IpcRegistry::Instance&)>& predicate) const
+{
+    if (!m_registry.isAttached()) {
+        return make_ret(Ret::Code::NotSupported);
+    }
+
+    QList<ipc::ID> liveInstances = m_ipcChannel->instances();
+    liveInstances.removeAll(m_ipcChannel->selfID());
+
+    //! NOTE Only the live instances are taken into account, the registry may contain the slots of crashed ones
+    int registeredCount = 0;
+    for (const IpcRegistry::Instance& instance : m_registry.instances()) {
+        if (!liveInstances.contains(instance.id)) {
+            continue;
+        }
+
+        ++registeredCount;
+        if (predicate(instance)) {
+            return RetVal<bool>::make_ok(true);
+        }
+    }
+
+    //! NOTE Some of the instances are not in the registry, they have to be asked over the socket
+    if (registeredCount < liveInstances.size()) {
+        return make_ret(Ret::Code::NotSupported);
+    }
+
+    return RetVal<bool>::make_ok(false);
 }
 
 bool MultiInstancesProvider::isInited() const
@@ -149,6 +222,15 @@ bool MultiInstancesProvider::isProjectAlreadyOpened(const io::path_t& projectPat
         return false;
     }
 
+    const uint64_t projectHash = IpcRegistry::projectHash(projectPath.toQString());
+    RetVal<bool> found = findInRegistry([projectHash](const IpcRegistry::Instance& instance) {
+        return (instance.flags & IpcRegistry::HasProject) && instance.projectHash == projectHash;
+    });
+
+    if (found.ret) {
+        return found.val;
+    }
+
     int ret = 0;
     m_ipcChannel->syncRequestToAll(METHOD_PROJECT_IS_OPENED, { projectPath.toQString() }, [&ret](const QStringList& args) {
         IF_ASSERT_FAILED(!args.empty()) {
@@ -184,6 +266,14 @@ bool MultiInstancesProvider::isHasAppInstanceWithoutProject() const
         return false;
     }
 
+    RetVal<bool> found = findInRegistry([](const IpcRegistry::Instance& instance) {
+        return !(instance.flags & IpcRegistry::HasProject);
+    });
+
+    if (found.ret) {
+        return found.val;
+    }
+
     int ret = 0;
     m_ipcChannel->syncRequestToAll(METHOD_IS_WITHOUT_PROJECT, {}, [&ret](const QStringList& args) {
         IF_ASSERT_FAILED(!args.empty()) {
@@ -230,30 +320,21 @@ bool MultiInstancesProvider::openNewAppInstance(const QStringList& args)
         return ok;
     }
 
-    auto sleep = [](int msec) {
-        QTimer timer;
-        QEventLoop loop;
-        QObject::connect(&timer, &QTimer::timeout, &loop, &QEventLoop::quit);
-        timer.start(msec);
-        loop.exec();
-    };
-
-    auto waitNewInstance = [this, sleep, currentApps](int waitMs, int count) {
-        for (int i = 0; i < count; ++i) {
-            sleep(waitMs);
-            QList<ipc::ID> apps = m_ipcChannel->instances();
-            for (const ipc::ID& id : apps) {
-                if (!currentApps.contains(id)) {
-                    LOGI() << "created new instance with ID: " << id;
-                    return true;
-                }
+    //! NOTE Waiting for a new instance to be registered, the server notifies about it
+    IpcLoop loop;
+    async::Asyncable waiter;
+    m_ipcChannel->instancesChanged().onNotify(&waiter, [this, &loop, currentApps]() {
+        QList<ipc::ID> apps = m_ipcChannel->instances();
+        for (const ipc::ID& id : apps) {
+            if (!currentApps.contains(id)) {
+                LOGI() << "created new instance with ID: " << id;
+                loop.exit(Code::Success);
+                return;
             }
         }
-        return false;
-    };
+    });
 
-    //! NOTE Waiting for a new instance to be created
-    ok = waitNewInstance(100, 50);
+    ok = loop.exec(5000) == Code::Success;
     if (!ok) {
         LOGE() << "we didn't wait for registration and response from the new instance";
     }
@@ -267,6 +348,14 @@ bool MultiInstancesProvider::isPreferencesAlreadyOpened() const
         return false;
     }
 
+    RetVal<bool> found = findInRegistry([](const IpcRegistry::Instance& instance) {
+        return instance.flags & IpcRegistry::PreferencesOpened;
+    });
+
+    if (found.ret) {
+        return found.val;
+    }
+
     int ret = 0;
     m_ipcChannel->syncRequestToAll(METHOD_PREFERENCES_IS_OPENED, {}, [&ret](const QStringList& args) {
         IF_ASSERT_FAILED(!args.empty()) {
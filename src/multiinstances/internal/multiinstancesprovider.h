@@ -28,6 +28,7 @@
 
 #include "ipc/ipcchannel.h"
 #include "ipc/ipclock.h"
+#include "ipc/ipcregistry.h"
 
 #include "modularity/ioc.h"
 #include "actions/iactionsdispatcher.h"
@@ -35,6 +36,7 @@
 #include "iinteractive.h"
 #include "async/asyncable.h"
 #include "project/iprojectfilescontroller.h"
+#include "context/iglobalcontext.h"
 #include "ui/imainwindow.h"
 
 namespace mu::mi {
@@ -44,6 +46,7 @@ class MultiInstancesProvider : public IMultiInstancesProvider, public actions::A
     INJECT(framework::IInteractive, interactive)
     INJECT(project::IProjectFilesController, projectFilesController)
     INJECT(ui::IMainWindow, mainWindow)
+    INJECT(context::IGlobalContext, globalContext)
 
 public:
     MultiInstancesProvider() = default;
@@ -93,7 +96,12 @@ private:
 
     ipc::IpcLock* lock(const std::string& name);
 
+    void attachToRegistry();
+    void publishToRegistry();
+    RetVal<bool> findInRegistry(const std::function<bool(const ipc::IpcRegistry::Instance&)>& predicate) const;
+
     ipc::IpcChannel* m_ipcChannel = nullptr;
+    ipc::IpcRegistry m_registry;
     std::string m_selfID;
 
     async::Notification m_instancesChanged;
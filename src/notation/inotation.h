@@ -96,6 +96,9 @@ public:
 
     // notify
     virtual async::Notification notationChanged() const = 0;
+
+    //! NOTE The canvas area changed by the last change of the notation, null if it may be all of it
+    virtual RectF changedRegion() const = 0;
 };
 }
 
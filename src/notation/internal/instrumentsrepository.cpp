@@ -28,22 +28,51 @@
 
 using namespace mu::notation;
 
+thread_local bool InstrumentsRepository::s_loadingTemplates = false;
+
+InstrumentsRepository::~InstrumentsRepository()
+{
+    mu::engraving::setInstrumentTemplatesLoader(nullptr);
+}
+
 void InstrumentsRepository::init()
 {
     configuration()->scoreOrderListPathsChanged().onNotify(this, [this]() {
-        load();
+        //! NOTE Reload right away only if the templates are in use already,
+        //! also if their last load failed: the new paths may fix it
+        if (m_loadAttempted) {
+            load();
+        }
     });
 
-    load();
+    mu::engraving::setInstrumentTemplatesLoader([this]() {
+        ensureLoaded();
+    });
+}
+
+//! NOTE The templates may be looked up from several threads, e.g. by the importers,
+//! so they are loaded once and the other threads wait for that
+void InstrumentsRepository::ensureLoaded() const
+{
+    //! NOTE The reader looks up the templates read so far, which must not load them again
+    if (s_loadingTemplates) {
+        return;
+    }
+
+    std::call_once(m_loadOnce, [this]() {
+        load();
+    });
 }
 
 const InstrumentTemplateList& InstrumentsRepository::instrumentTemplates() const
 {
+    ensureLoaded();
     return m_instrumentTemplates;
 }
 
 const InstrumentTemplate& InstrumentsRepository::instrumentTemplate(const std::string& instrumentId) const
 {
+    ensureLoaded();
     const InstrumentTemplateList& templates = m_instrumentTemplates;
 
     auto it = std::find_if(templates.begin(), templates.end(), [instrumentId](const InstrumentTemplate* templ) {
@@ -61,11 +90,13 @@ const InstrumentTemplate& InstrumentsRepository::instrumentTemplate(const std::s
 
 const ScoreOrderList& InstrumentsRepository::orders() const
 {
+    ensureLoaded();
     return mu::engraving::instrumentOrders;
 }
 
 const ScoreOrder& InstrumentsRepository::order(const std::string& orderId) const
 {
+    ensureLoaded();
     const ScoreOrderList& orders = mu::engraving::instrumentOrders;
 
     auto it = std::find_if(orders.begin(), orders.end(), [orderId](const ScoreOrder& order) {
@@ -82,18 +113,24 @@ const ScoreOrder& InstrumentsRepository::order(const std::string& orderId) const
 
 const InstrumentGenreList& InstrumentsRepository::genres() const
 {
+    ensureLoaded();
     return m_genres;
 }
 
 const InstrumentGroupList& InstrumentsRepository::groups() const
 {
+    ensureLoaded();
     return m_groups;
 }
 
-void InstrumentsRepository::load()
+void InstrumentsRepository::load() const
 {
     TRACEFUNC;
 
+    std::lock_guard<std::mutex> lock(m_loadMutex);
+
+    s_loadingTemplates = true;
+
     m_instrumentTemplates.clear();
     m_genres.clear();
     m_groups.clear();
@@ -126,4 +163,7 @@ void InstrumentsRepository::load()
             m_instrumentTemplates << templ;
         }
     }
+
+    s_loadingTemplates = false;
+    m_loadAttempted = true;
 }
@@ -22,6 +22,9 @@
 #ifndef MU_NOTATION_INSTRUMENTSREPOSITORY_H
 #define MU_NOTATION_INSTRUMENTSREPOSITORY_H
 
+#include <atomic>
+#include <mutex>
+
 #include "modularity/ioc.h"
 
 #include "async/channel.h"
@@ -36,6 +39,8 @@ class InstrumentsRepository : public IInstrumentsRepository, public async::Async
     INJECT(INotationConfiguration, configuration)
 
 public:
+    ~InstrumentsRepository() override;
+
     void init();
 
     const InstrumentTemplateList& instrumentTemplates() const override;
@@ -48,12 +53,19 @@ public:
     const InstrumentGroupList& groups() const override;
 
 private:
-    void load();
+    void ensureLoaded() const;
+    void load() const;
     void clear();
 
-    InstrumentTemplateList m_instrumentTemplates;
-    InstrumentGroupList m_groups;
-    InstrumentGenreList m_genres;
+    //! NOTE The templates are loaded on first access, not on startup
+    mutable std::once_flag m_loadOnce;
+    mutable std::mutex m_loadMutex;
+    mutable std::atomic<bool> m_loadAttempted = false;
+    static thread_local bool s_loadingTemplates;
+
+    mutable InstrumentTemplateList m_instrumentTemplates;
+    mutable InstrumentGroupList m_groups;
+    mutable InstrumentGenreList m_genres;
 };
 }
 
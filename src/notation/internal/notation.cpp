@@ -25,6 +25,7 @@
 #include <QScreen>
 
 #include "engraving/dom/masterscore.h"
+#include "engraving/dom/shadownote.h"
 
 #include "notationpainting.h"
 #include "notationviewstate.h"
@@ -84,6 +85,11 @@ Notation::Notation(mu::engraving::Score* score)
     });
 
     engravingConfiguration()->selectionColorChanged().onReceive(this, [this](int, const mu::draw::Color&) {
+        //! NOTE Not a change of the score, but the selection may be anywhere on the canvas
+        if (m_score) {
+            m_score->setUpdateAll();
+            m_score->update();
+        }
         notifyAboutNotationChanged();
     });
 
@@ -285,6 +291,23 @@ mu::async::Notification Notation::notationChanged() const
     return m_notationChanged;
 }
 
+mu::RectF Notation::changedRegion() const
+{
+    if (!m_score) {
+        return RectF();
+    }
+
+    RectF region = m_score->changedRegion();
+
+    //! NOTE The shadow note is hidden on every change, so the area it covers is redrawn too
+    const ShadowNote* shadowNote = m_score->shadowNote();
+    if (!region.isNull() && shadowNote && shadowNote->visible()) {
+        region.unite(shadowNote->canvasBoundingRect(LD_ACCESS::MAYBE_NOTINITED));
+    }
+
+    return region;
+}
+
 INotationAccessibilityPtr Notation::accessibility() const
 {
     return m_accessibility;
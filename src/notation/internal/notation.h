@@ -74,6 +74,7 @@ public:
     INotationPartsPtr parts() const override;
 
     async::Notification notationChanged() const override;
+    RectF changedRegion() const override;
 
 protected:
     mu::engraving::Score* score() const override;
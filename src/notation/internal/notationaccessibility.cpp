@@ -45,13 +45,17 @@ using namespace mu::accessibility;
 NotationAccessibility::NotationAccessibility(const Notation* notation)
     : m_getScore(notation)
 {
+    m_accessibilityInfoUpdate.onNotify(this, [this]() {
+        updateAccessibilityInfo();
+    });
+
     notation->interaction()->selectionChanged().onNotify(this, [this]() {
         setTriggeredCommand("");
-        updateAccessibilityInfo();
+        m_accessibilityInfoUpdate.notify();
     });
 
     notation->notationChanged().onNotify(this, [this]() {
-        updateAccessibilityInfo();
+        m_accessibilityInfoUpdate.notify();
     });
 }
 
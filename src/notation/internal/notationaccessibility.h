@@ -28,6 +28,7 @@
 
 #include "async/asyncable.h"
 #include "async/notification.h"
+#include "async/coalescedchannel.h"
 
 namespace mu::notation {
 class IGetScore;
@@ -58,6 +59,9 @@ private:
 
     const IGetScore* m_getScore = nullptr;
     ValCh<std::string> m_accessibilityInfo;
+
+    //! NOTE A range edit sends many changes, the info is built once per event loop turn
+    async::CoalescedNotification m_accessibilityInfoUpdate { "notation.accessibilityInfoUpdate" };
 };
 }
 
@@ -33,6 +33,16 @@ using namespace mu::async;
 NotationUndoStack::NotationUndoStack(IGetScore* getScore, Notification notationChanged)
     : m_getScore(getScore), m_notationChanged(notationChanged)
 {
+    if (!engravingConfiguration()) {
+        return;
+    }
+
+    //! NOTE The limit is applied to the open score as well, not only to the ones opened later
+    engravingConfiguration()->undoHistoryMemoryLimitChanged().onNotify(this, [this]() {
+        if (mu::engraving::UndoStack* stack = undoStack()) {
+            stack->setMemoryLimit(engravingConfiguration()->undoHistoryMemoryLimit());
+        }
+    });
 }
 
 bool NotationUndoStack::canUndo() const
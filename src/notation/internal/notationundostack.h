@@ -23,6 +23,10 @@
 #ifndef MU_NOTATION_UNDOSTACK
 #define MU_NOTATION_UNDOSTACK
 
+#include "async/asyncable.h"
+#include "modularity/ioc.h"
+#include "engraving/iengravingconfiguration.h"
+
 #include "inotationundostack.h"
 #include "igetscore.h"
 
@@ -34,8 +38,10 @@ class EditData;
 }
 
 namespace mu::notation {
-class NotationUndoStack : public INotationUndoStack
+class NotationUndoStack : public INotationUndoStack, public async::Asyncable
 {
+    INJECT(engraving::IEngravingConfiguration, engravingConfiguration)
+
 public:
     NotationUndoStack(IGetScore* getScore, async::Notification notationChanged);
 
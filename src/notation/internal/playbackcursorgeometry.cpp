@@ -0,0 +1,208 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "playbackcursorgeometry.h"
+
+#include <algorithm>
+
+#include "engraving/dom/measure.h"
+#include "engraving/dom/page.h"
+#include "engraving/dom/score.h"
+#include "engraving/dom/segment.h"
+#include "engraving/dom/staff.h"
+#include "engraving/dom/system.h"
+
+#include "log.h"
+
+using namespace mu::notation;
+using namespace mu::engraving;
+
+void PlaybackCursorGeometry::setScore(const Score* score)
+{
+    if (m_score == score) {
+        return;
+    }
+
+    m_score = score;
+    invalidate();
+}
+
+void PlaybackCursorGeometry::invalidate()
+{
+    m_valid = false;
+    m_measures.clear();
+    m_breakpoints.clear();
+    m_systems.clear();
+}
+
+void PlaybackCursorGeometry::ensureUpToDate() const
+{
+    if (!m_score) {
+        return;
+    }
+
+    if (m_valid && m_layoutRevision == m_score->layoutRevision()) {
+        return;
+    }
+
+    build();
+}
+
+void PlaybackCursorGeometry::build() const
+{
+    TRACEFUNC;
+
+    m_measures.clear();
+    m_breakpoints.clear();
+    m_systems.clear();
+
+    m_spatium = m_score->style().spatium();
+
+    const System* lastSystem = nullptr;
+
+    for (const Measure* measure = m_score->firstMeasureMM(); measure; measure = measure->nextMeasureMM()) {
+        MeasureSpan span;
+        span.measure = measure;
+        span.tick = measure->tick().ticks();
+        span.endTick = measure->endTick().ticks();
+        span.firstBreakpoint = m_breakpoints.size();
+        span.systemIdx = NO_SYSTEM;
+
+        const System* system = measure->system();
+        if (!system) {
+            span.lastBreakpoint = span.firstBreakpoint;
+            m_measures.push_back(span);
+            continue;
+        }
+
+        if (system != lastSystem) {
+            lastSystem = system;
+
+            //! NOTE The cursor covers the whole system, down to the last visible staff
+            double y2 = 0.0;
+            for (size_t i = 0; i < m_score->nstaves(); ++i) {
+                const SysStaff* ss = system->staff(i);
+                if (!ss->show() || !m_score->staff(i)->show()) {
+                    continue;
+                }
+                y2 = ss->bbox().bottom();
+            }
+
+            SystemGeometry geometry;
+            geometry.y = system->staffYpage(0) + system->page()->pos().y() - 3 * m_spatium;
+            geometry.height = 6 * m_spatium + y2;
+            m_systems.push_back(geometry);
+        }
+
+        span.systemIdx = m_systems.size() - 1;
+
+        //! NOTE The first segment is taken even if it is invisible, the next ones only if they are visible
+        for (const Segment* s = measure->first(SegmentType::ChordRest); s;) {
+            m_breakpoints.push_back({ s->tick().ticks(), s->canvasPos().x() });
+
+            s = s->next(SegmentType::ChordRest);
+            while (s && !s->visible()) {
+                s = s->next(SegmentType::ChordRest);
+            }
+        }
+
+        span.lastBreakpoint = m_breakpoints.size();
+
+        // measure->width is not good enough because of courtesy keysig, timesig
+        const Segment* seg = measure->findSegment(SegmentType::EndBarLine, measure->tick() + measure->ticks());
+        if (seg) {
+            span.endX = seg->canvasPos().x();
+        } else {
+            span.endX = measure->canvasPos().x() + measure->width(); // safety, should not happen
+        }
+
+        m_measures.push_back(span);
+    }
+
+    m_layoutRevision = m_score->layoutRevision();
+    m_valid = true;
+}
+
+const PlaybackCursorGeometry::MeasureSpan* PlaybackCursorGeometry::measureSpan(int tick) const
+{
+    ensureUpToDate();
+
+    if (m_measures.empty()) {
+        return nullptr;
+    }
+
+    tick = std::max(tick, 0);
+
+    auto it = std::upper_bound(m_measures.cbegin(), m_measures.cend(), tick, [](int tick, const MeasureSpan& span) {
+        return tick < span.tick;
+    });
+
+    if (it == m_measures.cbegin()) {
+        return nullptr;
+    }
+
+    --it;
+
+    // check last measure
+    if (std::next(it) == m_measures.cend() && tick > it->endTick) {
+        return nullptr;
+    }
+
+    return &(*it);
+}
+
+const Measure* PlaybackCursorGeometry::measure(int tick) const
+{
+    const MeasureSpan* span = measureSpan(tick);
+    return span ? span->measure : nullptr;
+}
+
+mu::RectF PlaybackCursorGeometry::cursorRect(int tick) const
+{
+    const MeasureSpan* span = measureSpan(tick);
+    if (!span || span->systemIdx == NO_SYSTEM || tick >= span->endTick) {
+        return RectF();
+    }
+
+    auto begin = m_breakpoints.cbegin() + span->firstBreakpoint;
+    auto end = m_breakpoints.cbegin() + span->lastBreakpoint;
+
+    auto next = std::upper_bound(begin, end, tick, [](int tick, const Breakpoint& breakpoint) {
+        return tick < breakpoint.tick;
+    });
+
+    if (next == begin) {
+        return RectF();
+    }
+
+    const Breakpoint& prev = *std::prev(next);
+
+    int t1 = prev.tick;
+    int x1 = prev.x;
+    int t2 = next != end ? next->tick : span->endTick;
+    double x2 = next != end ? next->x : span->endX;
+
+    double x = x1 + (x2 - x1) * (tick - t1) / (t2 - t1);
+
+    const SystemGeometry& system = m_systems.at(span->systemIdx);
+
+    return RectF(x - m_spatium, system.y, 8, system.height);
+}
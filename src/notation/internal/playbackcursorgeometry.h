@@ -0,0 +1,92 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_NOTATION_PLAYBACKCURSORGEOMETRY_H
+#define MU_NOTATION_PLAYBACKCURSORGEOMETRY_H
+
+#include <cstdint>
+#include <vector>
+
+#include "draw/types/geometry.h"
+
+namespace mu::engraving {
+class Measure;
+class Score;
+}
+
+namespace mu::notation {
+//! NOTE Geometry of the playback cursor, collected once per layout of the score:
+//! the sorted ticks and x positions of the visible chord/rest segments of every measure
+//! and the rect of every system. The cursor is placed by a binary search and an interpolation
+//! instead of walking the segments on every move. The index is rebuilt on demand when
+//! the layout revision of the score changes
+class PlaybackCursorGeometry
+{
+public:
+    PlaybackCursorGeometry() = default;
+
+    void setScore(const engraving::Score* score);
+    void invalidate();
+
+    RectF cursorRect(int tick) const;
+
+    //! NOTE Same as Score::tick2measureMM, but in logarithmic time
+    const engraving::Measure* measure(int tick) const;
+
+private:
+    struct Breakpoint {
+        int tick = 0;
+        double x = 0.0;
+    };
+
+    struct MeasureSpan {
+        const engraving::Measure* measure = nullptr;
+        int tick = 0;
+        int endTick = 0;
+        double endX = 0.0;
+        size_t firstBreakpoint = 0;
+        size_t lastBreakpoint = 0;
+        size_t systemIdx = 0;
+    };
+
+    struct SystemGeometry {
+        double y = 0.0;
+        double height = 0.0;
+    };
+
+    static constexpr size_t NO_SYSTEM = static_cast<size_t>(-1);
+
+    void ensureUpToDate() const;
+    void build() const;
+    const MeasureSpan* measureSpan(int tick) const;
+
+    const engraving::Score* m_score = nullptr;
+
+    mutable bool m_valid = false;
+    mutable uint64_t m_layoutRevision = 0;
+    mutable double m_spatium = 0.0;
+    mutable std::vector<MeasureSpan> m_measures;
+    mutable std::vector<Breakpoint> m_breakpoints;
+    mutable std::vector<SystemGeometry> m_systems;
+};
+}
+
+#endif // MU_NOTATION_PLAYBACKCURSORGEOMETRY_H
@@ -30,6 +30,8 @@
 
 #include "engraving/types/types.h"
 
+#include "playbackcursorgeometry.h"
+
 #include "log.h"
 #include "global/deprecated/xmlwriter.h"
 
@@ -66,7 +68,7 @@ static void writeEventPosition(mu::framework::XmlWriter& writer, const std::stri
     writer.writeEndElement();
 }
 
-static void writeMeasureEvents(mu::framework::XmlWriter& writer, Measure* m, int offset, const QHash<void*, int>& segments)
+static void writeMeasureEvents(mu::framework::XmlWriter& writer, const Measure* m, int offset, const QHash<void*, int>& segments)
 {
     for (mu::engraving::Segment* s = m->first(mu::engraving::SegmentType::ChordRest); s;
          s = s->next(mu::engraving::SegmentType::ChordRest)) {
@@ -227,11 +229,14 @@ void PositionsWriter::writeEventsPositions(mu::framework::XmlWriter& writer, con
 
     score->masterScore()->setExpandRepeats(true);
 
+    PlaybackCursorGeometry geometry;
+    geometry.setScore(score);
+
     for (const mu::engraving::RepeatSegment* repeatSegment : score->repeatList()) {
         int startTick = repeatSegment->tick;
         int endTick = startTick + repeatSegment->len();
         int tickOffset = repeatSegment->utick - repeatSegment->tick;
-        for (Measure* measure = score->tick2measureMM(Fraction::fromTicks(startTick)); measure; measure = measure->nextMeasureMM()) {
+        for (const Measure* measure = geometry.measure(startTick); measure; measure = measure->nextMeasureMM()) {
             if (m_elementType == ElementType::SEGMENT) {
                 writeMeasureEvents(writer, measure, tickOffset, elementIds);
             } else {
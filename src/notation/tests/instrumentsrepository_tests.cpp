@@ -0,0 +1,77 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include "notation/internal/instrumentsrepository.h"
+
+#include "stubs/notation/notationconfigurationstub.h"
+
+using namespace mu;
+using namespace mu::notation;
+
+static const io::path_t INSTRUMENTS_DATA_DIR(io::path_t(notation_test_DATA_ROOT) + "/instrumentsrepository_data/");
+
+class Notation_InstrumentsRepositoryTests : public ::testing::Test
+{
+protected:
+    class Configuration : public NotationConfigurationStub
+    {
+    public:
+        io::path_t instrumentListPath() const override { return instrumentsPath; }
+        async::Notification scoreOrderListPathsChanged() const override { return pathsChanged; }
+
+        io::path_t instrumentsPath;
+        async::Notification pathsChanged;
+    };
+
+    void SetUp() override
+    {
+        m_configuration = std::make_shared<Configuration>();
+        m_repository = std::make_shared<InstrumentsRepository>();
+        m_repository->setconfiguration(m_configuration);
+    }
+
+    std::shared_ptr<Configuration> m_configuration;
+    std::shared_ptr<InstrumentsRepository> m_repository;
+};
+
+TEST_F(Notation_InstrumentsRepositoryTests, FailedLoad_ReloadsWhenPathsChange)
+{
+    //! [GIVEN] The instruments path is wrong
+    m_configuration->instrumentsPath = INSTRUMENTS_DATA_DIR + "missing.xml";
+    m_repository->init();
+
+    //! [WHEN] The templates are used
+    //! [THEN] None are loaded
+    EXPECT_TRUE(m_repository->instrumentTemplates().empty());
+
+    //! [WHEN] The path is fixed
+    m_configuration->instrumentsPath = INSTRUMENTS_DATA_DIR + "instruments.xml";
+    m_configuration->pathsChanged.notify();
+
+    //! [THEN] The templates are loaded again
+    ASSERT_EQ(m_repository->instrumentTemplates().size(), 1);
+    EXPECT_EQ(m_repository->instrumentTemplates().front()->id, u"flute");
+    EXPECT_EQ(m_repository->groups().size(), 1);
+}
@@ -231,8 +231,15 @@ void AbstractNotationPaintView::onLoadNotation(INotationPtr)
     INotationInteractionPtr interaction = notationInteraction();
 
     m_notation->notationChanged().onNotify(this, [this, interaction]() {
+        //! NOTE Drag anchors, grips and the text cursor are drawn over the score, so while they
+        //! are shown the whole view is redrawn rather than only the area changed by the score
+        RectF region;
+        if (!interaction->isDragStarted() && !interaction->isElementEditStarted() && !interaction->isTextEditingStarted()) {
+            region = m_notation->changedRegion();
+        }
+
         interaction->hideShadowNote();
-        redraw();
+        redraw(region.isNull() ? RectF() : fromLogical(region));
     });
 
     onNoteInputStateChanged();
@@ -27,6 +27,7 @@
 #include "draw/types/geometry.h"
 
 #include "notation/inotation.h"
+#include "notation/internal/playbackcursorgeometry.h"
 
 class QColor;
 
@@ -56,6 +57,7 @@ private:
     RectF m_rect;
 
     INotationPtr m_notation;
+    PlaybackCursorGeometry m_geometry;
 };
 }
 
@@ -99,8 +99,10 @@ void ExampleView::layoutChanged()
 {
 }
 
-void ExampleView::dataChanged(const RectF&)
+void ExampleView::dataChanged(const RectF& rect)
 {
+    // one pixel more for the antialiasing
+    update(m_matrix.map(rect).toQRect().adjusted(-1, -1, 1, 1));
 }
 
 void ExampleView::updateAll()
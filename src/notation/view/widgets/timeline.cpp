@@ -22,11 +22,15 @@
 
 #include "timeline.h"
 
+#include <cmath>
+
 #include <QGraphicsTextItem>
 #include <QMenu>
+#include <QPainter>
 #include <QScrollBar>
 #include <QTextDocument>
 #include <QMouseEvent>
+#include <QStyleOptionGraphicsItem>
 
 #include "translation.h"
 
@@ -703,6 +707,133 @@ QString TRowLabels::cursorIsOn()
     }
 }
 
+//---------------------------------------------------------
+//   TimelineGrid
+//---------------------------------------------------------
+
+TimelineGrid::TimelineGrid(int rows, int cols, const QSizeF& cellSize)
+    : m_rows(rows), m_cols(cols), m_cellSize(cellSize)
+{
+    m_cells.resize(static_cast<size_t>(rows) * cols, CELL_EMPTY);
+
+    //! NOTE Needed to get the exposed rect in paint()
+    setFlag(QGraphicsItem::ItemUsesExtendedStyleOption);
+}
+
+void TimelineGrid::setTop(qreal top)
+{
+    if (m_top == top) {
+        return;
+    }
+
+    prepareGeometryChange();
+    m_top = top;
+}
+
+void TimelineGrid::setColors(const QColor& penColor, const QColor& hasNotesColor, const QColor& emptyColor)
+{
+    if (m_penColor == penColor && m_hasNotesColor == hasNotesColor && m_emptyColor == emptyColor) {
+        return;
+    }
+
+    m_penColor = penColor;
+    m_hasNotesColor = hasNotesColor;
+    m_emptyColor = emptyColor;
+    update();
+}
+
+void TimelineGrid::setHasNotes(int col, int row, bool hasNotes)
+{
+    uint8_t& cell = m_cells[index(col, row)];
+    cell = hasNotes ? (cell | CELL_HAS_NOTES) : (cell & ~CELL_HAS_NOTES);
+}
+
+void TimelineGrid::setSelected(int col, int row)
+{
+    const size_t idx = index(col, row);
+    if (m_cells[idx] & CELL_SELECTED) {
+        return;
+    }
+
+    m_cells[idx] |= CELL_SELECTED;
+    m_selectedCells.push_back(idx);
+}
+
+void TimelineGrid::clearSelection()
+{
+    for (size_t idx : m_selectedCells) {
+        m_cells[idx] &= ~CELL_SELECTED;
+    }
+    m_selectedCells.clear();
+}
+
+QRectF TimelineGrid::cellRect(int col, int row) const
+{
+    return QRectF(col * m_cellSize.width(), m_top + row * m_cellSize.height(), m_cellSize.width(), m_cellSize.height());
+}
+
+bool TimelineGrid::cellAt(const QPointF& pos, int& col, int& row) const
+{
+    if (pos.x() < 0 || pos.y() < m_top) {
+        return false;
+    }
+
+    col = static_cast<int>(pos.x() / m_cellSize.width());
+    row = static_cast<int>((pos.y() - m_top) / m_cellSize.height());
+
+    return col < m_cols && row < m_rows;
+}
+
+QRectF TimelineGrid::boundingRect() const
+{
+    // Half of the pen width sticks out of the cells
+    return QRectF(0, m_top, m_cols * m_cellSize.width(), m_rows * m_cellSize.height()).adjusted(-0.5, -0.5, 0.5, 0.5);
+}
+
+QColor TimelineGrid::cellColor(uint8_t cell) const
+{
+    const QColor& color = (cell & CELL_HAS_NOTES) ? m_hasNotesColor : m_emptyColor;
+    if (cell & CELL_SELECTED) {
+        return QColor(color.red(), color.green(), 255);
+    }
+
+    return color;
+}
+
+void TimelineGrid::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget*)
+{
+    const QRectF exposedRect = option->exposedRect.intersected(boundingRect());
+    if (m_cells.empty() || exposedRect.isEmpty()) {
+        return;
+    }
+
+    const int colFrom = std::max(0, static_cast<int>(std::floor(exposedRect.left() / m_cellSize.width())));
+    const int colTo = std::min(m_cols - 1, static_cast<int>(std::floor(exposedRect.right() / m_cellSize.width())));
+    const int rowFrom = std::max(0, static_cast<int>(std::floor((exposedRect.top() - m_top) / m_cellSize.height())));
+    const int rowTo = std::min(m_rows - 1, static_cast<int>(std::floor((exposedRect.bottom() - m_top) / m_cellSize.height())));
+
+    // Group the cells by their state, so that the brush changes at most once per state
+    constexpr size_t STATES_COUNT = CELL_HAS_NOTES | CELL_SELECTED;
+    QVector<QRectF> rects[STATES_COUNT + 1];
+
+    for (int col = colFrom; col <= colTo; ++col) {
+        for (int row = rowFrom; row <= rowTo; ++row) {
+            rects[cell(col, row)].push_back(cellRect(col, row));
+        }
+    }
+
+    painter->setPen(QPen(m_penColor));
+
+    for (size_t state = 0; state <= STATES_COUNT; ++state) {
+        if (rects[state].empty()) {
+            continue;
+        }
+
+        painter->setBrush(QBrush(cellColor(static_cast<uint8_t>(state))));
+        painter->drawRects(rects[state]);
+    }
+}
+
 //---------------------------------------------------------
 //   Timeline
 //---------------------------------------------------------
@@ -960,10 +1091,9 @@ void Timeline::drawGrid(int globalRows, int globalCols, int startMeasure, int en
     }
 
     const bool rebuildAll = (
-        gridRows != globalRows || gridCols != globalCols
+        !m_grid || gridRows != globalRows || gridCols != globalCols
         || (startMeasure == 0 && 2 * (endMeasure - startMeasure) > globalCols)  // rebuild all if more than half of score has changed
         );
-    const bool rebuildPartial = !rebuildAll && (startMeasure >= 0);
 
     const unsigned numMetas = nmetas();
 
@@ -972,19 +1102,6 @@ void Timeline::drawGrid(int globalRows, int globalCols, int startMeasure, int en
         startMeasure = 0;
         endMeasure = globalCols;
     } else {
-        if (rebuildPartial) {
-            const QRectF replacedRect
-                = getMeasureRect(startMeasure, 0, numMetas) | getMeasureRect(endMeasure - 1, globalRows - 1, numMetas);
-            const QList<QGraphicsItem*> replacedItems = scene()->items(replacedRect, Qt::ContainsItemShape);
-            for (QGraphicsItem* item : replacedItems) {
-                if (item->data(keyItemType).value<ItemType>() != ItemType::TYPE_MEASURE) {
-                    continue;
-                }
-                scene()->removeItem(item);
-                delete item;
-            }
-        }
-
         // Meta rows are still rebuilt from scratch, remove old meta rows manually
         const QList<QGraphicsItem*> items = scene()->items();
         for (QGraphicsItem* item : items) {
@@ -997,6 +1114,7 @@ void Timeline::drawGrid(int globalRows, int globalCols, int startMeasure, int en
     }
 
     _metaRows.clear();
+    m_toolTipCell = -1;
 
     if (globalRows == 0 || globalCols == 0) {
         return;
@@ -1007,46 +1125,36 @@ void Timeline::drawGrid(int globalRows, int globalCols, int startMeasure, int en
     setMinimumWidth(_gridWidth * 3);
     _globalZValue = 1;
 
+    m_gridMeasures.clear();
+    m_gridMeasureIndices.clear();
+    m_gridMeasures.reserve(globalCols);
+    for (Measure* measure = score()->firstMeasure(); measure; measure = measure->nextMeasure()) {
+        m_gridMeasureIndices.emplace(measure, static_cast<int>(m_gridMeasures.size()));
+        m_gridMeasures.push_back(measure);
+    }
+
     // Draw grid
-    Measure* currMeasure = score()->firstMeasure();
-    for (int i = 0; i < startMeasure; ++i) {
-        currMeasure = currMeasure->nextMeasure();
+    if (rebuildAll) {
+        m_grid = new TimelineGrid(globalRows, globalCols, QSizeF(_gridWidth, _gridHeight));
+        m_grid->setData(keyItemType, QVariant::fromValue(ItemType::TYPE_MEASURE));
+        m_grid->setZValue(-3);
+        scene()->addItem(m_grid);
     }
 
-    QList<Part*> partList = getParts();
+    m_grid->setTop(getMeasureRect(0, 0, numMetas).top());
+    m_grid->setColors(activeTheme().backgroundColor, activeTheme().colorBoxColor, QColor(224, 224, 224));
 
+    // Only the cells of the changed measures are recomputed
     for (int col = startMeasure; col < endMeasure; col++) {
         for (int row = 0; row < globalRows; row++) {
-            QGraphicsRectItem* graphicsRectItem = new QGraphicsRectItem(getMeasureRect(col, row, numMetas));
-            graphicsRectItem->setData(keyItemType, QVariant::fromValue(ItemType::TYPE_MEASURE));
-
-            setMetaData(graphicsRectItem, row, ElementType::INVALID, currMeasure, false, 0);
-
-            QString translateMeasure = qtrc("notation/timeline", "Measure");
-            QChar initialLetter = translateMeasure[0];
-            QTextDocument doc;
-            QString partName = "";
-            if (partList.size() > row) {
-                doc.setHtml(partList.at(row)->longName());
-                partName = doc.toPlainText();
-                if (partName.isEmpty()) {         // No Long instrument name? Fall back to Part name
-                    doc.setHtml(partList.at(row)->partName());
-                    partName = doc.toPlainText();
-                }
-                if (partName.isEmpty()) {       // No Part name? Fall back to Instrument name
-                    partName = partList.at(row)->instrumentName();
-                }
-            }
-
-            graphicsRectItem->setToolTip(initialLetter + QString(" ") + QString::number(currMeasure->no() + 1) + QString(", ") + partName);
-            graphicsRectItem->setPen(QPen(activeTheme().backgroundColor));
-            graphicsRectItem->setBrush(QBrush(colorBox(graphicsRectItem)));
-            graphicsRectItem->setZValue(-3);
-            scene()->addItem(graphicsRectItem);
+            m_grid->setHasNotes(col, row, cellHasNotes(m_gridMeasures[col], static_cast<staff_idx_t>(row)));
         }
+    }
 
-        currMeasure = currMeasure->nextMeasure();
+    if (startMeasure < endMeasure) {
+        m_grid->update(m_grid->cellRect(startMeasure, 0) | m_grid->cellRect(endMeasure - 1, globalRows - 1));
     }
+
     setSceneRect(0, 0, getWidth(), getHeight());
 
     // Draw meta rows and separator
@@ -1839,6 +1947,8 @@ void Timeline::clearScene()
     scene()->clear();
 
     // clear pointers to scene items, they have been deleted by clear()
+    m_grid = nullptr;
+    m_toolTipCell = -1;
     nonVisiblePathItem = nullptr;
     visiblePathItem = nullptr;
     selectionItem = nullptr;
@@ -2083,20 +2193,29 @@ void Timeline::drawSelection()
                 }
             }
         }
-        // Change color from gray to only blue
-        else if (it != metaLabelsSet.end()) {
-            QGraphicsRectItem* graphicsRectItem = qgraphicsitem_cast<QGraphicsRectItem*>(graphicsItem);
-            graphicsRectItem->setBrush(QBrush(QColor(graphicsRectItem->brush().color().red(),
-                                                     graphicsRectItem->brush().color().green(),
-                                                     255)));
-            _selectionPath.addRect(graphicsRectItem->rect());
-        } else {
-            // Ensure unselected measures are not marked selected
-            QGraphicsRectItem* graphicsRectItem = qgraphicsitem_cast<QGraphicsRectItem*>(graphicsItem);
-            if (graphicsRectItem && graphicsRectItem->data(keyItemType).value<ItemType>() == ItemType::TYPE_MEASURE) {
-                graphicsRectItem->setBrush(QBrush(colorBox(graphicsRectItem)));
+    }
+
+    // Mark the selected cells of the grid
+    if (m_grid) {
+        const int numMetas = nmetas();
+        m_grid->clearSelection();
+
+        for (const std::tuple<Measure*, int, ElementType>& metaLabel : metaLabelsSet) {
+            const int stave = std::get<1>(metaLabel);
+            if (stave < 0 || stave >= m_grid->rows() || std::get<2>(metaLabel) != ElementType::INVALID) {
+                continue;
             }
+
+            auto measureIt = m_gridMeasureIndices.find(std::get<0>(metaLabel));
+            if (measureIt == m_gridMeasureIndices.end()) {
+                continue;
+            }
+
+            m_grid->setSelected(measureIt->second, stave);
+            _selectionPath.addRect(getMeasureRect(measureIt->second, stave, numMetas));
         }
+
+        m_grid->update();
     }
 
     if (selectionItem) {
@@ -2156,9 +2275,16 @@ void Timeline::mousePressEvent(QMouseEvent* event)
             maxZValue = graphicsItem->zValue();
         }
     }
+    int stave = -1;
+    Measure* currMeasure = nullptr;
     if (currGraphicsItem) {
-        int stave = currGraphicsItem->data(0).value<int>();
-        Measure* currMeasure = static_cast<Measure*>(currGraphicsItem->data(2).value<void*>());
+        stave = currGraphicsItem->data(0).value<int>();
+        currMeasure = static_cast<Measure*>(currGraphicsItem->data(2).value<void*>());
+    } else {
+        currMeasure = gridCellAt(scenePt, stave);
+    }
+
+    if (currGraphicsItem || currMeasure) {
         if (numToStaff(stave) && !numToStaff(stave)->show()) {
             return;
         }
@@ -2170,17 +2296,8 @@ void Timeline::mousePressEvent(QMouseEvent* event)
             // Handle measure box clicks
             if (scenePt.y() > (nmeta - 1) * _gridHeight + verticalScrollBar()->value()
                 && scenePt.y() < bottomOfMeta) {
-                QRectF tmp(scenePt.x(), 0, 3, nmeta * _gridHeight + nstaves() * _gridHeight);
-                QList<QGraphicsItem*> gl = scene()->items(tmp);
-                Measure* measure = nullptr;
-
-                for (QGraphicsItem* graphicsItem : gl) {
-                    measure = static_cast<Measure*>(graphicsItem->data(2).value<void*>());
-                    //-3 z value is the grid square values
-                    if (graphicsItem->zValue() == -3 && measure) {
-                        break;
-                    }
-                }
+                const int col = static_cast<int>(scenePt.x()) / _gridWidth;
+                Measure* measure = (col >= 0 && col < static_cast<int>(m_gridMeasures.size())) ? m_gridMeasures[col] : nullptr;
 
                 if (measure) {
                     interaction()->showItem(measure);
@@ -2190,21 +2307,14 @@ void Timeline::mousePressEvent(QMouseEvent* event)
                 return;
             }
 
-            QList<QGraphicsItem*> gl = items(event->pos());
-            for (QGraphicsItem* graphicsItem : gl) {
-                currMeasure = static_cast<Measure*>(graphicsItem->data(2).value<void*>());
-                stave = graphicsItem->data(0).value<int>();
-                if (currMeasure) {
-                    break;
-                }
-            }
+            currMeasure = gridCellAt(scenePt, stave);
             if (!currMeasure) {
                 interaction()->clearSelection();
                 return;
             }
         }
 
-        bool metaValueClicked = currGraphicsItem->data(3).value<bool>();
+        bool metaValueClicked = currGraphicsItem && currGraphicsItem->data(3).value<bool>();
 
         scene()->clearSelection();
         if (metaValueClicked) {
@@ -2329,6 +2439,8 @@ void Timeline::mouseMoveEvent(QMouseEvent* event)
 {
     QPointF newLoc = mapToScene(event->pos());
     if (!_mousePressed) {
+        updateCellToolTip(newLoc);
+
         if (cursorIsOn(event->pos()) == "meta") {
             setCursor(Qt::ArrowCursor);
             mouseOver(newLoc);
@@ -2390,72 +2502,47 @@ void Timeline::mouseReleaseEvent(QMouseEvent*)
         scene()->removeItem(_selectionBox);
         interaction()->clearSelection();
 
-        int width, height;
-        QPoint loc = mapFromScene(_selectionBox->rect().topLeft());
-        width = int(_selectionBox->rect().width());
-        height = int(_selectionBox->rect().height());
-
-        QList<QGraphicsItem*> graphicsItemList = items(QRect(loc.x(), loc.y(), width, height));
-        // Find top left and bottom right to create selection
-        QGraphicsItem* tlGraphicsItem = nullptr;
-        QGraphicsItem* brGraphicsItem = nullptr;
-        for (QGraphicsItem* graphicsItem : graphicsItemList) {
-            Measure* currMeasure = static_cast<Measure*>(graphicsItem->data(2).value<void*>());
-            if (!currMeasure) {
-                continue;
-            }
-            int stave = graphicsItem->data(0).value<int>();
-            if (stave == -1) {
-                continue;
-            }
-
-            if (!tlGraphicsItem && !brGraphicsItem) {
-                tlGraphicsItem = graphicsItem;
-                brGraphicsItem = graphicsItem;
-                continue;
+        // Find top left and bottom right cells of the lasso to create selection
+        const QRectF lassoRect = _selectionBox->rect();
+        int tlStave = -1;
+        int brStave = -1;
+        Measure* tlMeasure = nullptr;
+        Measure* brMeasure = nullptr;
+
+        if (m_grid && !m_gridMeasures.empty()) {
+            const QRectF gridRect = m_grid->cellRect(0, 0) | m_grid->cellRect(m_grid->cols() - 1, m_grid->rows() - 1);
+            const QRectF rect = lassoRect.intersected(gridRect);
+
+            int tlCol = 0;
+            int brCol = 0;
+            if (!rect.isEmpty() && m_grid->cellAt(rect.topLeft(), tlCol, tlStave)
+                // The right and bottom edges of the rect belong to the next cells
+                && m_grid->cellAt(rect.bottomRight() - QPointF(0.001, 0.001), brCol, brStave)) {
+                tlMeasure = m_gridMeasures[tlCol];
+                brMeasure = m_gridMeasures[brCol];
             }
+        }
 
-            if (graphicsItem->boundingRect().top() < tlGraphicsItem->boundingRect().top()) {
-                tlGraphicsItem = graphicsItem;
+        // Select single top left cell and then range to bottom right cell
+        if (tlMeasure && brMeasure) {
+            // Focus selection of mmRests here
+            if (tlMeasure->mmRest()) {
+                tlMeasure = tlMeasure->mmRest();
+            } else if (tlMeasure->mmRestCount() == -1) {
+                tlMeasure = tlMeasure->prevMeasureMM();
             }
-            if (graphicsItem->boundingRect().left() < tlGraphicsItem->boundingRect().left()) {
-                tlGraphicsItem = graphicsItem;
+            if (brMeasure->mmRest()) {
+                brMeasure = brMeasure->mmRest();
+            } else if (brMeasure->mmRestCount() == -1) {
+                brMeasure = brMeasure->prevMeasureMM();
             }
 
-            if (graphicsItem->boundingRect().bottom() > brGraphicsItem->boundingRect().bottom()) {
-                brGraphicsItem = graphicsItem;
-            }
-            if (graphicsItem->boundingRect().right() > brGraphicsItem->boundingRect().right()) {
-                brGraphicsItem = graphicsItem;
+            if (tlMeasure) {
+                interaction()->select({ tlMeasure }, SelectType::SINGLE, tlStave);
             }
-        }
-
-        // Select single tlGraphicsItem and then range brGraphicsItem
-        if (tlGraphicsItem && brGraphicsItem) {
-            Measure* tlMeasure = static_cast<Measure*>(tlGraphicsItem->data(2).value<void*>());
-            int tlStave = tlGraphicsItem->data(0).value<int>();
-            Measure* brMeasure = static_cast<Measure*>(brGraphicsItem->data(2).value<void*>());
-            int brStave = brGraphicsItem->data(0).value<int>();
-            if (tlMeasure && brMeasure) {
-                // Focus selection of mmRests here
-                if (tlMeasure->mmRest()) {
-                    tlMeasure = tlMeasure->mmRest();
-                } else if (tlMeasure->mmRestCount() == -1) {
-                    tlMeasure = tlMeasure->prevMeasureMM();
-                }
-                if (brMeasure->mmRest()) {
-                    brMeasure = brMeasure->mmRest();
-                } else if (brMeasure->mmRestCount() == -1) {
-                    brMeasure = brMeasure->prevMeasureMM();
-                }
-
-                if (tlMeasure) {
-                    interaction()->select({ tlMeasure }, SelectType::SINGLE, tlStave);
-                }
 
-                if (brMeasure) {
-                    interaction()->select({ brMeasure }, SelectType::RANGE, brStave);
-                }
+            if (brMeasure) {
+                interaction()->select({ brMeasure }, SelectType::RANGE, brStave);
             }
 
             if (tlMeasure) {
@@ -2593,6 +2680,55 @@ void Timeline::updateGridFromCmdState()
     updateGrid(startMeasureIndex, endMeasureIndex);
 }
 
+//---------------------------------------------------------
+//   updateCells
+//    recompute only the grid cells within the changed range,
+//    the rest of the timeline is updated by the following updateGrid()
+//---------------------------------------------------------
+
+void Timeline::updateCells(const ChangesRange& range)
+{
+    if (!score() || !m_grid) {
+        return;
+    }
+
+    TRACEFUNC;
+
+    const int rows = nstaves();
+    const int cols = static_cast<int>(score()->nmeasures());
+    if (m_grid->rows() != rows || m_grid->cols() != cols) {
+        // The whole grid is rebuilt by the next updateGrid()
+        return;
+    }
+
+    int col = 0;
+    Measure* measure = score()->firstMeasure();
+    Fraction endTick = score()->endTick();
+    int staffFrom = 0;
+    int staffTo = rows - 1;
+
+    if (range.isValidBoundary()) {
+        if (Measure* startMeasure = score()->tick2measure(Fraction::fromTicks(range.tickFrom))) {
+            measure = startMeasure;
+            col = measure->measureIndex();
+        }
+        endTick = Fraction::fromTicks(range.tickTo);
+        staffFrom = std::max(0, static_cast<int>(range.staffIdxFrom));
+        staffTo = std::min(rows - 1, static_cast<int>(range.staffIdxTo));
+    }
+
+    const int startCol = col;
+    for (; measure && col < cols && measure->tick() <= endTick; measure = measure->nextMeasure(), ++col) {
+        for (int row = staffFrom; row <= staffTo; ++row) {
+            m_grid->setHasNotes(col, row, cellHasNotes(measure, static_cast<staff_idx_t>(row)));
+        }
+    }
+
+    if (startCol < col && staffFrom <= staffTo) {
+        m_grid->update(m_grid->cellRect(startCol, staffFrom) | m_grid->cellRect(col - 1, staffTo));
+    }
+}
+
 //---------------------------------------------------------
 //   Timeline::setNotation
 //---------------------------------------------------------
@@ -2757,28 +2893,90 @@ int Timeline::nstaves() const
 }
 
 //---------------------------------------------------------
-//   Timeline::colorBox
+//   Timeline::cellHasNotes
 //---------------------------------------------------------
 
-QColor Timeline::colorBox(QGraphicsRectItem* item)
+bool Timeline::cellHasNotes(const Measure* measure, staff_idx_t stave) const
 {
-    Measure* measure = static_cast<Measure*>(item->data(2).value<void*>());
-    staff_idx_t stave = static_cast<staff_idx_t>(item->data(0).value<int>());
-    for (Segment* seg = measure->first(); seg; seg = seg->next()) {
+    for (const Segment* seg = measure->first(); seg; seg = seg->next()) {
         if (!seg->isChordRestType()) {
             continue;
         }
         for (track_idx_t track = stave * VOICES; track < stave * VOICES + VOICES; track++) {
-            ChordRest* chordRest = seg->cr(track);
+            const ChordRest* chordRest = seg->cr(track);
             if (chordRest) {
                 ElementType crt = chordRest->type();
                 if (crt == ElementType::CHORD || crt == ElementType::MEASURE_REPEAT) {
-                    return activeTheme().colorBoxColor;
+                    return true;
                 }
             }
         }
     }
-    return QColor(224, 224, 224);
+    return false;
+}
+
+//---------------------------------------------------------
+//   Timeline::gridCellAt
+//---------------------------------------------------------
+
+Measure* Timeline::gridCellAt(const QPointF& scenePt, int& stave) const
+{
+    int col = 0;
+    int row = 0;
+    if (!m_grid || !m_grid->cellAt(scenePt, col, row) || col >= static_cast<int>(m_gridMeasures.size())) {
+        return nullptr;
+    }
+
+    stave = row;
+    return m_gridMeasures[col];
+}
+
+//---------------------------------------------------------
+//   Timeline::cellToolTip
+//---------------------------------------------------------
+
+QString Timeline::cellToolTip(int col, int row)
+{
+    QString translateMeasure = qtrc("notation/timeline", "Measure");
+    QChar initialLetter = translateMeasure[0];
+    QTextDocument doc;
+    QString partName = "";
+    QList<Part*> partList = getParts();
+    if (partList.size() > row) {
+        doc.setHtml(partList.at(row)->longName());
+        partName = doc.toPlainText();
+        if (partName.isEmpty()) {         // No Long instrument name? Fall back to Part name
+            doc.setHtml(partList.at(row)->partName());
+            partName = doc.toPlainText();
+        }
+        if (partName.isEmpty()) {       // No Part name? Fall back to Instrument name
+            partName = partList.at(row)->instrumentName();
+        }
+    }
+
+    return initialLetter + QString(" ") + QString::number(m_gridMeasures[col]->no() + 1) + QString(", ") + partName;
+}
+
+//---------------------------------------------------------
+//   Timeline::updateCellToolTip
+//    the grid is a single item, so its tooltip follows the hovered cell
+//---------------------------------------------------------
+
+void Timeline::updateCellToolTip(const QPointF& scenePt)
+{
+    int col = 0;
+    int row = 0;
+    if (!m_grid || !m_grid->cellAt(scenePt, col, row) || col >= static_cast<int>(m_gridMeasures.size())) {
+        return;
+    }
+
+    const int cell = col * m_grid->rows() + row;
+    if (cell == m_toolTipCell) {
+        return;
+    }
+
+    m_toolTipCell = cell;
+    m_grid->setToolTip(cellToolTip(col, row));
 }
 
 //---------------------------------------------------------
@@ -3185,6 +3383,14 @@ QString Timeline::cursorIsOn(const QPoint& cursorPos)
             return "invalid";
         }
     }
+
+    int stave = -1;
+    if (gridCellAt(QPointF(cursorPos), stave)) {
+        const Staff* st = numToStaff(stave);
+        if (!(st && st->show())) {
+            return "invalid";
+        }
+    }
     return "instrument";
 }
 
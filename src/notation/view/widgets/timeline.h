@@ -31,7 +31,9 @@
 #include "async/asyncable.h"
 #include "actions/iactionsdispatcher.h"
 
+#include <unordered_map>
 #include <vector>
+#include <QGraphicsItem>
 #include <QGraphicsView>
 #include <QSplitter>
 
@@ -106,6 +108,55 @@ struct TimelineTheme {
     QColor metaValuePenColor, metaValueBrushColor;
 };
 
+//! NOTE Paints the staff/measure cells of the timeline as one scene item.
+//! The state of the cells is kept in a compact per-measure, per-staff bitmap
+//! and only the cells inside the exposed rect are painted, so the cost of
+//! a repaint depends on the size of the viewport rather than on the size of the score
+class TimelineGrid : public QGraphicsItem
+{
+public:
+    enum CellFlag : uint8_t {
+        CELL_EMPTY = 0,
+        CELL_HAS_NOTES = 1 << 0,
+        CELL_SELECTED = 1 << 1,
+    };
+
+    TimelineGrid(int rows, int cols, const QSizeF& cellSize);
+
+    int rows() const { return m_rows; }
+    int cols() const { return m_cols; }
+
+    void setTop(qreal top);
+    void setColors(const QColor& penColor, const QColor& hasNotesColor, const QColor& emptyColor);
+
+    uint8_t cell(int col, int row) const { return m_cells[index(col, row)]; }
+    void setHasNotes(int col, int row, bool hasNotes);
+    void setSelected(int col, int row);
+    void clearSelection();
+
+    QRectF cellRect(int col, int row) const;
+    bool cellAt(const QPointF& pos, int& col, int& row) const;
+
+    QRectF boundingRect() const override;
+    void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget = nullptr) override;
+
+private:
+    size_t index(int col, int row) const { return static_cast<size_t>(col) * m_rows + row; }
+    QColor cellColor(uint8_t cell) const;
+
+    int m_rows = 0;
+    int m_cols = 0;
+    QSizeF m_cellSize;
+    qreal m_top = 0;
+
+    std::vector<uint8_t> m_cells;
+    std::vector<size_t> m_selectedCells;
+
+    QColor m_penColor;
+    QColor m_hasNotesColor;
+    QColor m_emptyColor;
+};
+
 class Timeline : public QGraphicsView, public mu::async::Asyncable
 {
     Q_OBJECT
@@ -127,6 +178,7 @@ public:
 
     void updateGridView() { updateGrid(-1, -1); }
     void updateGridFromCmdState();
+    void updateCells(const ChangesRange& range);
     void setNotation(INotationPtr notation);
 
     TRowLabels* labelsColumn() const;
@@ -170,6 +222,11 @@ private:
     QGraphicsPathItem* visiblePathItem = nullptr;
     QGraphicsPathItem* selectionItem = nullptr;
 
+    TimelineGrid* m_grid = nullptr;
+    std::vector<engraving::Measure*> m_gridMeasures;
+    std::unordered_map<const engraving::Measure*, int> m_gridMeasureIndices;
+    int m_toolTipCell = -1;
+
     QGraphicsRectItem* _selectionBox { nullptr };
     std::vector<std::pair<QGraphicsItem*, int> > _metaRows;
 
@@ -256,7 +313,10 @@ private:
 
     void updateGridFull() { updateGrid(0, -1); }
 
-    QColor colorBox(QGraphicsRectItem* item);
+    bool cellHasNotes(const engraving::Measure* measure, engraving::staff_idx_t stave) const;
+    engraving::Measure* gridCellAt(const QPointF& scenePt, int& stave) const;
+    QString cellToolTip(int col, int row);
+    void updateCellToolTip(const QPointF& scenePt);
 
     std::vector<std::pair<QString, bool> > getLabels();
 
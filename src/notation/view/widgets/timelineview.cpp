@@ -49,6 +49,11 @@ public:
         m_msTimeline->updateGridFromCmdState();
     }
 
+    void updateCells(const ChangesRange& range)
+    {
+        m_msTimeline->updateCells(range);
+    }
+
     void setNotation(INotationPtr notation)
     {
         m_msTimeline->setNotation(notation);
@@ -123,15 +128,25 @@ void TimelineView::componentComplete()
             return;
         }
 
+        notation->undoStack()->changesChannel().onReceive(this, [timeline](const ChangesRange& range) {
+            timeline->updateCells(range);
+        });
+
         notation->undoStack()->stackChanged().onNotify(this, [=] {
+            //! NOTE The full update covers the selection too
+            m_selectionChanged.cancel();
             updateView();
         });
 
-        notation->interaction()->selectionChanged().onNotify(this, [=] {
-            updateView();
+        notation->interaction()->selectionChanged().onNotify(this, [this] {
+            m_selectionChanged.notify();
         });
     };
 
+    m_selectionChanged.onNotify(this, [updateView]() {
+        updateView();
+    });
+
     globalContext()->currentNotationChanged().onNotify(this, [initTimeline]() {
         initTimeline();
     });
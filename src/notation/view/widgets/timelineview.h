@@ -28,6 +28,7 @@
 #include "modularity/ioc.h"
 #include "context/iglobalcontext.h"
 #include "async/asyncable.h"
+#include "async/coalescedchannel.h"
 
 namespace mu::notation {
 class TimelineView : public uicomponents::WidgetView, public async::Asyncable
@@ -41,6 +42,9 @@ public:
 
 private:
     void componentComplete() override;
+
+    //! NOTE The selection may change many times per event loop turn (e.g. lasso), the view is updated once
+    async::CoalescedNotification m_selectionChanged { "timeline.selectionChanged" };
 };
 }
 
@@ -22,6 +22,7 @@
 #include "palettecelliconengine.h"
 
 #include <QPainter>
+#include <QPixmapCache>
 
 #include "draw/types/geometry.h"
 #include "draw/painter.h"
@@ -37,6 +38,8 @@ using namespace mu::palette;
 using namespace mu::draw;
 using namespace mu::engraving;
 
+static int s_cacheGeneration = 0;
+
 PaletteCellIconEngine::PaletteCellIconEngine(PaletteCellConstPtr cell, qreal extraMag)
     : QIconEngine(), m_cell(cell), m_extraMag(extraMag)
 {
@@ -50,11 +53,65 @@ QIconEngine* PaletteCellIconEngine::clone() const
 void PaletteCellIconEngine::paint(QPainter* qp, const QRect& rect, QIcon::Mode mode, QIcon::State state)
 {
     qreal dpi = qp->device()->logicalDpiX();
-    Painter p(qp, "palettecell");
-    p.save();
-    p.setAntialiasing(true);
-    paintCell(p, RectF::fromQRectF(rect), mode == QIcon::Selected, state == QIcon::On, dpi);
-    p.restore();
+    qreal dpr = qp->device()->devicePixelRatioF();
+    bool selected = mode == QIcon::Selected;
+    bool current = state == QIcon::On;
+
+    //! NOTE Laying out and drawing the elements is expensive, while the cells are repainted
+    //! on every scroll, hover and selection change, so the cells are rendered once and then only blitted
+    QString key = cacheKey(rect.size(), dpr, dpi, selected, current);
+
+    QPixmap pixmap;
+    if (!QPixmapCache::find(key, &pixmap)) {
+        pixmap = QPixmap(rect.size() * dpr);
+        pixmap.setDevicePixelRatio(dpr);
+        pixmap.fill(Qt::transparent);
+
+        {
+            QPainter pixmapPainter(&pixmap);
+            Painter p(&pixmapPainter, "palettecell");
+            p.setAntialiasing(true);
+            paintCell(p, RectF(0, 0, rect.width(), rect.height()), selected, current, dpi);
+        }
+
+        QPixmapCache::insert(key, pixmap);
+    }
+
+    qp->drawPixmap(rect.topLeft(), pixmap);
+}
+
+void PaletteCellIconEngine::invalidateCache()
+{
+    ++s_cacheGeneration;
+}
+
+QString PaletteCellIconEngine::cacheKey(const QSize& size, qreal dpr, qreal dpi, bool selected, bool current) const
+{
+    QStringList parts;
+    parts << QStringLiteral("palettecell") << QString::number(s_cacheGeneration);
+
+    if (m_cell) {
+        parts << m_cell->id
+              << QString::number(reinterpret_cast<quintptr>(m_cell->element.get()))
+              << QString::number(m_cell->mag)
+              << QString::number(m_cell->xoffset)
+              << QString::number(m_cell->yoffset)
+              << QString::number(m_cell->drawStaff);
+    }
+
+    parts << QString::number(m_extraMag)
+          << QString::number(size.width()) << QString::number(size.height())
+          << QString::number(dpr) << QString::number(dpi)
+          << QString::number(selected) << QString::number(current)
+          << QString::number(configuration()->elementsColor().rgba())
+          << QString::number(configuration()->accentColor().rgba())
+          << QString::number(configuration()->paletteSpatium());
+
+    if (gpaletteScore) {
+        parts << gpaletteScore->style().value(Sid::MusicalSymbolFont).value<String>().toQString();
+    }
+
+    return parts.join(u'_');
 }
 
 void PaletteCellIconEngine::paintCell(Painter& painter, const RectF& rect, bool selected, bool current, qreal dpi) const
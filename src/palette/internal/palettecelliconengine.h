@@ -56,7 +56,13 @@ public:
 
     static void paintPaletteItem(void* context, mu::engraving::EngravingItem* element);
 
+    //! NOTE The rendered cells are cached as pixmaps, call it when the cells might look different
+    //! although their properties did not change (e.g. the elements were edited in place)
+    static void invalidateCache();
+
 private:
+    QString cacheKey(const QSize& size, qreal dpr, qreal dpi, bool selected, bool current) const;
+
     void paintCell(draw::Painter& painter, const RectF& rect, bool selected, bool current, qreal dpi) const;
     void paintBackground(draw::Painter& painter, const RectF& rect, bool selected, bool current) const;
     void paintActionIcon(draw::Painter& painter, const RectF& rect, mu::engraving::EngravingItem* element) const;
@@ -28,6 +28,7 @@
 #include "view/palettemodel.h"
 
 #include "ipaletteprovider.h"
+#include "palettecelliconengine.h"
 #include "async/asyncable.h"
 
 #include "modularity/ioc.h"
@@ -272,6 +273,7 @@ signals:
 private slots:
     void notifyAboutUserPaletteChanged()
     {
+        PaletteCellIconEngine::invalidateCache();
         m_userPaletteChanged.notify();
         emit userPaletteChanged();
     }
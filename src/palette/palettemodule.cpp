@@ -66,6 +66,11 @@ std::string PaletteModule::moduleName() const
     return "palette";
 }
 
+bool PaletteModule::isInitOnDemandAllowed() const
+{
+    return true;
+}
+
 void PaletteModule::registerExports()
 {
     m_paletteProvider = std::make_shared<PaletteProvider>();
@@ -36,6 +36,7 @@ class PaletteModule : public modularity::IModuleSetup
 {
 public:
     std::string moduleName() const override;
+    bool isInitOnDemandAllowed() const override;
 
     void registerExports() override;
     void resolveImports() override;
@@ -24,16 +24,98 @@
 #include "cursor.h"
 #include "elements.h"
 
+#include "engraving/dom/chord.h"
 #include "engraving/dom/factory.h"
 #include "engraving/dom/instrtemplate.h"
 #include "engraving/dom/measure.h"
+#include "engraving/dom/note.h"
 #include "engraving/dom/score.h"
 #include "engraving/dom/segment.h"
 #include "engraving/dom/text.h"
+#include "engraving/dom/undo.h"
 
 using namespace mu::engraving;
 
 namespace mu::plugins::api {
+//---------------------------------------------------------
+//   noteDataEntry
+//---------------------------------------------------------
+
+static QVariantMap noteDataEntry(const mu::engraving::Note* note)
+{
+    const mu::engraving::Chord* chord = note->chord();
+    const mu::engraving::Chord* mainChord = chord;
+    int grace = -1;
+
+    if (chord->isGrace()) {
+        mainChord = toChord(chord->explicitParent());
+        const std::vector<mu::engraving::Chord*>& graceNotes = mainChord->graceNotes();
+        grace = static_cast<int>(std::find(graceNotes.cbegin(), graceNotes.cend(), chord) - graceNotes.cbegin());
+    }
+
+    const std::vector<mu::engraving::Note*>& notes = chord->notes();
+    int index = static_cast<int>(std::find(notes.cbegin(), notes.cend(), note) - notes.cbegin());
+
+    QVariantMap entry;
+    entry["pitch"] = note->pitch();
+    entry["tpc"] = note->tpc();
+    entry["tpc1"] = note->tpc1();
+    entry["tpc2"] = note->tpc2();
+    entry["tick"] = mainChord->tick().ticks();
+    entry["duration"] = chord->actualTicks().ticks();
+    entry["track"] = static_cast<int>(chord->track());
+    entry["voice"] = static_cast<int>(chord->voice());
+    entry["staff"] = static_cast<int>(chord->staffIdx());
+    entry["index"] = index;
+    entry["grace"] = grace;
+
+    return entry;
+}
+
+//---------------------------------------------------------
+//   findNote
+//---------------------------------------------------------
+
+static mu::engraving::Note* findNote(const mu::engraving::Score* score, const QVariantMap& change)
+{
+    bool trackOk = false;
+    bool tickOk = false;
+    bool indexOk = false;
+    int track = change.value("track").toInt(&trackOk);
+    int tick = change.value("tick").toInt(&tickOk);
+    int index = change.value("index").toInt(&indexOk);
+    int grace = change.value("grace", -1).toInt();
+
+    if (!trackOk || !tickOk || !indexOk || track < 0 || track >= static_cast<int>(score->ntracks())) {
+        return nullptr;
+    }
+
+    mu::engraving::Segment* segment = score->tick2segment(mu::engraving::Fraction::fromTicks(tick), true,
+                                                          mu::engraving::SegmentType::ChordRest);
+    if (!segment) {
+        return nullptr;
+    }
+
+    mu::engraving::EngravingItem* element = segment->element(track);
+    if (!element || !element->isChord()) {
+        return nullptr;
+    }
+
+    mu::engraving::Chord* chord = toChord(element);
+    if (grace >= 0) {
+        if (grace >= static_cast<int>(chord->graceNotes().size())) {
+            return nullptr;
+        }
+        chord = chord->graceNotes().at(grace);
+    }
+
+    if (index < 0 || index >= static_cast<int>(chord->notes().size())) {
+        return nullptr;
+    }
+
+    return chord->notes().at(index);
+}
+
 //---------------------------------------------------------
 //   Score::newCursor
 //---------------------------------------------------------
@@ -246,4 +328,156 @@ void Score::endCmd(bool rollback)
 
     notation()->notationChanged().notify();
 }
+
+//---------------------------------------------------------
+//   Score::noteData
+//---------------------------------------------------------
+
+QVariantList Score::noteData(int startTick, int endTick, int startStaff, int endStaff) const
+{
+    const mu::engraving::Score* s = score();
+
+    size_t nstaves = s->nstaves();
+    track_idx_t startTrack = static_cast<track_idx_t>(std::max(startStaff, 0)) * VOICES;
+    track_idx_t endTrack = (endStaff < 0 ? nstaves : std::min(static_cast<size_t>(endStaff), nstaves)) * VOICES;
+
+    QVariantList result;
+
+    mu::engraving::Measure* measure = s->tick2measure(mu::engraving::Fraction::fromTicks(std::max(startTick, 0)));
+    for (mu::engraving::Segment* segment = measure ? measure->first(mu::engraving::SegmentType::ChordRest) : nullptr; segment;
+         segment = segment->next1(mu::engraving::SegmentType::ChordRest)) {
+        int tick = segment->tick().ticks();
+        if (tick < startTick) {
+            continue;
+        }
+        if (endTick >= 0 && tick >= endTick) {
+            break;
+        }
+
+        for (track_idx_t track = startTrack; track < endTrack; ++track) {
+            mu::engraving::EngravingItem* element = segment->element(track);
+            if (!element || !element->isChord()) {
+                continue;
+            }
+
+            const mu::engraving::Chord* chord = toChord(element);
+            for (const mu::engraving::Chord* graceChord : chord->graceNotes()) {
+                for (const mu::engraving::Note* note : graceChord->notes()) {
+                    result << noteDataEntry(note);
+                }
+            }
+            for (const mu::engraving::Note* note : chord->notes()) {
+                result << noteDataEntry(note);
+            }
+        }
+    }
+
+    return result;
+}
+
+//---------------------------------------------------------
+//   Score::selectedNoteData
+//---------------------------------------------------------
+
+QVariantList Score::selectedNoteData() const
+{
+    QVariantList result;
+
+    for (const mu::engraving::Note* note : score()->selection().noteList()) {
+        result << noteDataEntry(note);
+    }
+
+    return result;
+}
+
+//---------------------------------------------------------
+//   Score::measureData
+//---------------------------------------------------------
+
+QVariantList Score::measureData() const
+{
+    QVariantList result;
+
+    int index = 0;
+    for (const mu::engraving::Measure* measure = score()->firstMeasure(); measure; measure = measure->nextMeasure()) {
+        QVariantMap entry;
+        entry["index"] = index++;
+        entry["tick"] = measure->tick().ticks();
+        entry["ticks"] = measure->ticks().ticks();
+        entry["timesigNumerator"] = measure->timesig().numerator();
+        entry["timesigDenominator"] = measure->timesig().denominator();
+
+        result << entry;
+    }
+
+    return result;
+}
+
+//---------------------------------------------------------
+//   Score::applyNoteChanges
+//---------------------------------------------------------
+
+int Score::applyNoteChanges(const QVariantList& changes)
+{
+    static const QStringList NOTE_KEYS { "track", "tick", "index", "grace" };
+
+    // all the changes make a single undoable command, unless the plugin opened one itself
+    const bool ownCmd = !score()->undoStack()->active();
+    if (ownCmd) {
+        startCmd();
+    }
+
+    int changed = 0;
+
+    for (const QVariant& value : changes) {
+        const QVariantMap change = value.toMap();
+
+        mu::engraving::Note* note = findNote(score(), change);
+        if (!note) {
+            LOGW() << "note not found";
+            continue;
+        }
+
+        // a short-living wrapper applies the values the same way as assigning them from QML
+        mu::plugins::api::Note wrapper(note, Ownership::SCORE);
+
+        // a change with an unknown or read-only property is rejected as a whole, not applied halfway
+        const QMetaObject* meta = wrapper.metaObject();
+        bool valid = true;
+        for (auto it = change.cbegin(); it != change.cend(); ++it) {
+            if (NOTE_KEYS.contains(it.key())) {
+                continue;
+            }
+
+            int propertyIdx = meta->indexOfProperty(it.key().toUtf8().constData());
+            if (propertyIdx < 0 || !meta->property(propertyIdx).isWritable()) {
+                LOGW() << "unknown or read-only note property: " << it.key();
+                valid = false;
+                break;
+            }
+        }
+
+        if (!valid) {
+            continue;
+        }
+
+        for (auto it = change.cbegin(); it != change.cend(); ++it) {
+            if (NOTE_KEYS.contains(it.key())) {
+                continue;
+            }
+
+            if (!wrapper.setProperty(it.key().toUtf8().constData(), it.value())) {
+                LOGW() << "invalid value of note property: " << it.key();
+            }
+        }
+
+        ++changed;
+    }
+
+    if (ownCmd) {
+        endCmd();
+    }
+
+    return changed;
+}
 } // namespace mu::plugins::api
@@ -231,6 +231,50 @@ public:
      */
     Q_INVOKABLE void endCmd(bool rollback = false);
 
+    /**
+     * Returns the notes of the given range as an array of plain objects with
+     * the following fields: \p pitch, \p tpc, \p tpc1, \p tpc2, \p tick,
+     * \p duration (in ticks), \p track, \p voice, \p staff, \p index
+     * (position of the note in its chord) and \p grace (position of the grace
+     * chord in its parent chord, -1 for ordinary notes).
+     * Unlike visiting the notes with a Cursor, no wrapper objects are created,
+     * which is much faster on large scores.
+     * \param startTick - first tick of the range
+     * \param endTick - tick after the range, -1 for the end of the score
+     * \param startStaff - first staff of the range
+     * \param endStaff - staff after the range, -1 for all the staves
+     * \see applyNoteChanges
+     * \since MuseScore 4.2
+     */
+    Q_INVOKABLE QVariantList noteData(int startTick = 0, int endTick = -1, int startStaff = 0, int endStaff = -1) const;
+    /**
+     * Returns the selected notes in the same format as noteData().
+     * \since MuseScore 4.2
+     */
+    Q_INVOKABLE QVariantList selectedNoteData() const;
+    /**
+     * Returns the measures of the score as an array of plain objects with
+     * the following fields: \p index, \p tick, \p ticks (actual length in ticks),
+     * \p timesigNumerator and \p timesigDenominator (nominal time signature).
+     * \since MuseScore 4.2
+     */
+    Q_INVOKABLE QVariantList measureData() const;
+    /**
+     * Applies many changes to the notes at once, as a single undoable command
+     * unless called between startCmd() and endCmd().
+     * \param changes - array of objects which identify a note by the \p track,
+     * \p tick, \p index and optional \p grace fields (as returned by noteData()), all the other
+     * fields are the names and new values of Note properties, e.g.
+     * \code
+     * curScore.applyNoteChanges([{ track: 0, tick: 480, index: 0, pitch: 62, tpc1: 16, tpc2: 16 }]);
+     * \endcode
+     * A change is skipped if its note is not found or if it has a field which is not
+     * a writable Note property.
+     * \returns the number of changes which were applied
+     * \since MuseScore 4.2
+     */
+    Q_INVOKABLE int applyNoteChanges(const QVariantList& changes);
+
     /**
      * Create PlayEvents for all notes based on ornamentation.
      * You need to call this if you are manipulating PlayEvent's
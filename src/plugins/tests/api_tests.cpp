@@ -21,10 +21,25 @@
  */
 #include <gtest/gtest.h>
 
-#include <QQmlEngine>
-
 #include "plugins/view/pluginview.h"
 #include "plugins/api/qmlplugin.h"
+#include "plugins/api/score.h"
+
+#include "engraving/compat/scoreaccess.h"
+#include "engraving/compat/mscxcompat.h"
+#include "engraving/dom/chord.h"
+#include "engraving/dom/masterscore.h"
+#include "engraving/dom/note.h"
+#include "engraving/dom/segment.h"
+#include "engraving/dom/undo.h"
+
+#include "mocks/globalcontextmock.h"
+#include "mocks/notationmock.h"
+#include "mocks/notationundostackmock.h"
+
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
 
 using namespace mu;
 using namespace mu::plugins;
@@ -32,6 +47,41 @@ using namespace mu::plugins;
 class Plugins_ApiTests : public ::testing::Test
 {
 public:
+    engraving::MasterScore* readScore(const String& path) const
+    {
+        engraving::MasterScore* score = engraving::compat::ScoreAccess::createMasterScoreWithBaseStyle();
+        if (!engraving::compat::loadMsczOrMscx(score, String::fromUtf8(plugins_tests_DATA_ROOT "/") + path)) {
+            delete score;
+            return nullptr;
+        }
+
+        score->doLayout();
+        return score;
+    }
+
+    //! NOTE The undo stack of the current notation opens and closes the commands of the score itself
+    void setCurrentScore(api::Score& apiScore, engraving::Score* score) const
+    {
+        auto undoStack = std::make_shared<NiceMock<NotationUndoStackMock> >();
+        ON_CALL(*undoStack, prepareChanges()).WillByDefault(Invoke([score]() { score->startCmd(); }));
+        ON_CALL(*undoStack, commitChanges()).WillByDefault(Invoke([score]() { score->endCmd(); }));
+        ON_CALL(*undoStack, rollbackChanges()).WillByDefault(Invoke([score]() { score->endCmd(true); }));
+
+        auto notation = std::make_shared<NiceMock<NotationMock> >();
+        ON_CALL(*notation, undoStack()).WillByDefault(Return(undoStack));
+
+        auto context = std::make_shared<NiceMock<GlobalContextMock> >();
+        ON_CALL(*context, currentNotation()).WillByDefault(Return(notation));
+
+        apiScore.setcontext(context);
+    }
+
+    engraving::Chord* chordAt(engraving::Score* score, int tick) const
+    {
+        engraving::Segment* segment = score->tick2segment(engraving::Fraction::fromTicks(tick), true,
+                                                          engraving::SegmentType::ChordRest);
+        return segment ? engraving::toChord(segment->element(0)) : nullptr;
+    }
 };
 
 TEST_F(Plugins_ApiTests, Enums)
@@ -46,3 +96,137 @@ TEST_F(Plugins_ApiTests, Enums)
 
     EXPECT_EQ(view.qmlPlugin()->property("errorCount").toInt(), 0);
 }
+
+TEST_F(Plugins_ApiTests, NoteData)
+{
+    //! [GIVEN] A grace note before a two-note chord, then a single note
+    engraving::MasterScore* score = readScore(u"api_data/notedata/notedata.mscx");
+    ASSERT_TRUE(score);
+
+    api::Score apiScore(score);
+
+    //! [WHEN] The notes of the score are requested
+    QVariantList notes = apiScore.noteData();
+
+    //! [THEN] The grace note comes first, then the notes of its chord from the bottom
+    ASSERT_EQ(notes.size(), 4);
+
+    QVariantMap grace = notes.at(0).toMap();
+    EXPECT_EQ(grace.value("pitch").toInt(), 74);
+    EXPECT_EQ(grace.value("tick").toInt(), 0);
+    EXPECT_EQ(grace.value("grace").toInt(), 0);
+    EXPECT_EQ(grace.value("index").toInt(), 0);
+
+    QVariantMap lower = notes.at(1).toMap();
+    EXPECT_EQ(lower.value("pitch").toInt(), 60);
+    EXPECT_EQ(lower.value("grace").toInt(), -1);
+    EXPECT_EQ(lower.value("index").toInt(), 0);
+    EXPECT_EQ(lower.value("duration").toInt(), 480);
+
+    QVariantMap upper = notes.at(2).toMap();
+    EXPECT_EQ(upper.value("pitch").toInt(), 64);
+    EXPECT_EQ(upper.value("index").toInt(), 1);
+
+    QVariantMap single = notes.at(3).toMap();
+    EXPECT_EQ(single.value("pitch").toInt(), 67);
+    EXPECT_EQ(single.value("tick").toInt(), 480);
+    EXPECT_EQ(single.value("track").toInt(), 0);
+
+    //! [THEN] A range gives only its notes
+    QVariantList rangeNotes = apiScore.noteData(480, 960);
+    ASSERT_EQ(rangeNotes.size(), 1);
+    EXPECT_EQ(rangeNotes.at(0).toMap().value("pitch").toInt(), 67);
+
+    delete score;
+}
+
+TEST_F(Plugins_ApiTests, MeasureData)
+{
+    engraving::MasterScore* score = readScore(u"api_data/notedata/notedata.mscx");
+    ASSERT_TRUE(score);
+
+    api::Score apiScore(score);
+
+    QVariantList measures = apiScore.measureData();
+    ASSERT_EQ(measures.size(), 2);
+
+    QVariantMap second = measures.at(1).toMap();
+    EXPECT_EQ(second.value("index").toInt(), 1);
+    EXPECT_EQ(second.value("tick").toInt(), 1920);
+    EXPECT_EQ(second.value("ticks").toInt(), 1440);
+    EXPECT_EQ(second.value("timesigNumerator").toInt(), 3);
+    EXPECT_EQ(second.value("timesigDenominator").toInt(), 4);
+
+    delete score;
+}
+
+TEST_F(Plugins_ApiTests, ApplyNoteChanges_SingleUndoCommand)
+{
+    engraving::MasterScore* score = readScore(u"api_data/notedata/notedata.mscx");
+    ASSERT_TRUE(score);
+
+    api::Score apiScore(score);
+    setCurrentScore(apiScore, score);
+
+    engraving::Chord* chord = chordAt(score, 0);
+    ASSERT_TRUE(chord);
+    ASSERT_EQ(chord->graceNotes().size(), 1);
+
+    size_t undoIdx = score->undoStack()->getCurIdx();
+
+    //! [WHEN] A note of the chord and its grace note are changed
+    QVariantList changes;
+    changes << QVariantMap { { "track", 0 }, { "tick", 0 }, { "index", 1 }, { "pitch", 65 } };
+    changes << QVariantMap { { "track", 0 }, { "tick", 0 }, { "grace", 0 }, { "index", 0 }, { "pitch", 76 } };
+
+    //! [THEN] Both are applied
+    EXPECT_EQ(apiScore.applyNoteChanges(changes), 2);
+    EXPECT_EQ(chord->notes().at(1)->pitch(), 65);
+    EXPECT_EQ(chord->graceNotes().at(0)->notes().at(0)->pitch(), 76);
+
+    //! [THEN] As a single undoable command
+    EXPECT_EQ(score->undoStack()->getCurIdx(), undoIdx + 1);
+
+    score->undoRedo(true, nullptr);
+    EXPECT_EQ(chord->notes().at(1)->pitch(), 64);
+    EXPECT_EQ(chord->graceNotes().at(0)->notes().at(0)->pitch(), 74);
+
+    delete score;
+}
+
+TEST_F(Plugins_ApiTests, ApplyNoteChanges_RejectsInvalidChanges)
+{
+    engraving::MasterScore* score = readScore(u"api_data/notedata/notedata.mscx");
+    ASSERT_TRUE(score);
+
+    api::Score apiScore(score);
+    setCurrentScore(apiScore, score);
+
+    QVariantList changes;
+    //! unknown property
+    changes << QVariantMap { { "track", 0 }, { "tick", 0 }, { "index", 0 }, { "pitch", 62 }, { "colour", "red" } };
+    //! read-only property
+    changes << QVariantMap { { "track", 0 }, { "tick", 0 }, { "index", 0 }, { "pitch", 62 }, { "noteType", 1 } };
+    //! no such note in the chord
+    changes << QVariantMap { { "track", 0 }, { "tick", 0 }, { "index", 2 }, { "pitch", 62 } };
+    //! no such grace note
+    changes << QVariantMap { { "track", 0 }, { "tick", 0 }, { "grace", 1 }, { "index", 0 }, { "pitch", 62 } };
+    //! invalid tick
+    changes << QVariantMap { { "track", 0 }, { "tick", "start" }, { "index", 0 }, { "pitch", 62 } };
+    //! the only valid one
+    changes << QVariantMap { { "track", 0 }, { "tick", 480 }, { "index", 0 }, { "pitch", 69 } };
+
+    EXPECT_EQ(apiScore.applyNoteChanges(changes), 1);
+
+    engraving::Chord* chord = chordAt(score, 0);
+    ASSERT_TRUE(chord);
+    EXPECT_EQ(chord->notes().at(0)->pitch(), 60);
+    EXPECT_EQ(chord->notes().at(1)->pitch(), 64);
+    EXPECT_EQ(chord->graceNotes().at(0)->notes().at(0)->pitch(), 74);
+
+    engraving::Chord* single = chordAt(score, 480);
+    ASSERT_TRUE(single);
+    EXPECT_EQ(single->notes().at(0)->pitch(), 69);
+
+    delete score;
+}
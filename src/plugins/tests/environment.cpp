@@ -24,6 +24,9 @@
 
 #include <QQmlEngine>
 
+#include "draw/drawmodule.h"
+#include "fonts/fontsmodule.h"
+#include "engraving/engravingmodule.h"
 #include "plugins/pluginsmodule.h"
 
 #include "modularity/ioc.h"
@@ -33,6 +36,9 @@
 
 static mu::testing::SuiteEnvironment plugins_env(
 {
+    new mu::draw::DrawModule(),
+    new mu::fonts::FontsModule(), // needs for engraving
+    new mu::engraving::EngravingModule(),
     new mu::plugins::PluginsModule()
 },
     []() {
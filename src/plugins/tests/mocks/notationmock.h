@@ -0,0 +1,64 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_PLUGINS_NOTATIONMOCK_H
+#define MU_PLUGINS_NOTATIONMOCK_H
+
+#include <gmock/gmock.h>
+
+#include "notation/inotation.h"
+
+namespace mu::plugins {
+class NotationMock : public notation::INotation
+{
+public:
+    MOCK_METHOD(QString, name, (), (const, override));
+
+    MOCK_METHOD(QString, projectName, (), (const, override));
+    MOCK_METHOD(QString, projectNameAndPartName, (), (const, override));
+
+    MOCK_METHOD(QString, workTitle, (), (const, override));
+    MOCK_METHOD(QString, projectWorkTitle, (), (const, override));
+    MOCK_METHOD(QString, projectWorkTitleAndPartName, (), (const, override));
+
+    MOCK_METHOD(bool, isOpen, (), (const, override));
+    MOCK_METHOD(void, setIsOpen, (bool), (override));
+    MOCK_METHOD(async::Notification, openChanged, (), (const, override));
+
+    MOCK_METHOD(notation::ViewMode, viewMode, (), (const, override));
+    MOCK_METHOD(void, setViewMode, (const notation::ViewMode&), (override));
+
+    MOCK_METHOD(notation::INotationPaintingPtr, painting, (), (const, override));
+    MOCK_METHOD(notation::INotationViewStatePtr, viewState, (), (const, override));
+    MOCK_METHOD(notation::INotationInteractionPtr, interaction, (), (const, override));
+    MOCK_METHOD(notation::INotationMidiInputPtr, midiInput, (), (const, override));
+    MOCK_METHOD(notation::INotationUndoStackPtr, undoStack, (), (const, override));
+    MOCK_METHOD(notation::INotationStylePtr, style, (), (const, override));
+    MOCK_METHOD(notation::INotationElementsPtr, elements, (), (const, override));
+    MOCK_METHOD(notation::INotationAccessibilityPtr, accessibility, (), (const, override));
+    MOCK_METHOD(notation::INotationPartsPtr, parts, (), (const, override));
+
+    MOCK_METHOD(async::Notification, notationChanged, (), (const, override));
+    MOCK_METHOD(RectF, changedRegion, (), (const, override));
+};
+}
+
+#endif // MU_PLUGINS_NOTATIONMOCK_H
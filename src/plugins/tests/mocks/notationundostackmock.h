@@ -0,0 +1,56 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_PLUGINS_NOTATIONUNDOSTACKMOCK_H
+#define MU_PLUGINS_NOTATIONUNDOSTACKMOCK_H
+
+#include <gmock/gmock.h>
+
+#include "notation/internal/inotationundostack.h"
+
+namespace mu::plugins {
+class NotationUndoStackMock : public notation::INotationUndoStack
+{
+public:
+    MOCK_METHOD(bool, canUndo, (), (const, override));
+    MOCK_METHOD(void, undo, (engraving::EditData*), (override));
+    MOCK_METHOD(async::Notification, undoNotification, (), (const, override));
+
+    MOCK_METHOD(bool, canRedo, (), (const, override));
+    MOCK_METHOD(void, redo, (engraving::EditData*), (override));
+    MOCK_METHOD(async::Notification, redoNotification, (), (const, override));
+
+    MOCK_METHOD(void, prepareChanges, (), (override));
+    MOCK_METHOD(void, rollbackChanges, (), (override));
+    MOCK_METHOD(void, commitChanges, (), (override));
+
+    MOCK_METHOD(bool, isStackClean, (), (const, override));
+
+    MOCK_METHOD(void, lock, (), (override));
+    MOCK_METHOD(void, unlock, (), (override));
+    MOCK_METHOD(bool, isLocked, (), (const, override));
+
+    MOCK_METHOD(async::Notification, stackChanged, (), (const, override));
+    MOCK_METHOD(async::Channel<notation::ChangesRange>, changesChannel, (), (const, override));
+};
+}
+
+#endif // MU_PLUGINS_NOTATIONUNDOSTACKMOCK_H
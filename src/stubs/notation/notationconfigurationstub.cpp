@@ -267,6 +267,15 @@ void NotationConfigurationStub::setIsAutomaticallyPanEnabled(bool)
 {
 }
 
+bool NotationConfigurationStub::isSmoothPanning() const
+{
+    return false;
+}
+
+void NotationConfigurationStub::setIsSmoothPanning(bool)
+{
+}
+
 bool NotationConfigurationStub::isPlayRepeatsEnabled() const
 {
     return false;
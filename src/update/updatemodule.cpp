@@ -53,6 +53,11 @@ std::string UpdateModule::moduleName() const
     return "update";
 }
 
+bool UpdateModule::isInitOnDemandAllowed() const
+{
+    return true;
+}
+
 void UpdateModule::registerExports()
 {
     m_scenario = std::make_shared<UpdateScenario>();
@@ -54,6 +54,11 @@ std::string WorkspaceModule::moduleName() const
     return "workspace";
 }
 
+bool WorkspaceModule::isInitOnDemandAllowed() const
+{
+    return true;
+}
+
 void WorkspaceModule::registerExports()
 {
     m_manager = std::make_shared<WorkspaceManager>();
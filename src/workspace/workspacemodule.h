@@ -35,6 +35,7 @@ class WorkspaceModule : public modularity::IModuleSetup
 {
 public:
     std::string moduleName() const override;
+    bool isInitOnDemandAllowed() const override;
     void registerExports() override;
     void resolveImports() override;
     void registerUiTypes() override;